@@ -19,6 +19,8 @@
 #include "TransactionalAbstractionReader.h"
 #include "PacketReader.h"
 
+#include <IPXACTmodels/common/DocumentStreamReader.h>
+
 //-----------------------------------------------------------------------------
 // Function: AbstractionDefinitionReader::createAbstractionDefinitionFrom()
 //-----------------------------------------------------------------------------
@@ -57,6 +59,31 @@ QSharedPointer<AbstractionDefinition> AbstractionDefinitionReader::createAbstrac
     return abstractionDefinition;
 }
 
+//-----------------------------------------------------------------------------
+// Function: AbstractionDefinitionReader::createAbstractionDefinitionFrom()
+//-----------------------------------------------------------------------------
+QSharedPointer<AbstractionDefinition> AbstractionDefinitionReader::createAbstractionDefinitionFrom(
+    QXmlStreamReader& xmlReader)
+{
+    QList<QSharedPointer<PortAbstraction> > logicalPorts;
+
+    DocumentStreamReader streamReader;
+    streamReader.streamSection({ QStringLiteral("ipxact:ports") }, QStringLiteral("ipxact:port"),
+        [&logicalPorts](QDomNode const& portNode, Document::Revision revision)
+        { logicalPorts.append(Details::parsePort(portNode, revision)); });
+
+    QDomDocument document = streamReader.read(xmlReader);
+    if (document.isNull())
+    {
+        return QSharedPointer<AbstractionDefinition>();
+    }
+
+    QSharedPointer<AbstractionDefinition> abstractionDefinition = createAbstractionDefinitionFrom(document);
+    abstractionDefinition->getLogicalPorts()->append(logicalPorts);
+
+    return abstractionDefinition;
+}
+
 //-----------------------------------------------------------------------------
 // Function: AbstractionDefinitionReader::Details::parseBusType()
 //-----------------------------------------------------------------------------
@@ -18,6 +18,7 @@
 
 #include <QDomNode>
 #include <QSharedPointer>
+#include <QXmlStreamReader>
 
 class AbstractionDefinition;
 class PortAbstraction;
@@ -36,6 +37,17 @@ namespace AbstractionDefinitionReader
      *      @return The created abstraction definition.
      */
     IPXACTMODELS_EXPORT QSharedPointer<AbstractionDefinition> createAbstractionDefinitionFrom(QDomNode const& document);
+
+    /*!
+     *  Creates an abstraction definition from a stream. The logical ports are parsed one at a time while
+     *  reading, so that the whole document is never held in memory as a DOM tree.
+     *
+     *      @param [in] xmlReader   The reader positioned at the start of the abstraction definition document.
+     *
+     *      @return The created abstraction definition, or null if the document could not be read.
+     */
+    IPXACTMODELS_EXPORT QSharedPointer<AbstractionDefinition> createAbstractionDefinitionFrom(
+        QXmlStreamReader& xmlReader);
     
     namespace Details
     {
@@ -242,7 +242,7 @@ QString PacketValidator::parseConstantFieldValue(QString token) const
     int base = baseOf(token);
 
     // Remove formating of the number.
-    static QRegularExpression prefix(QStringLiteral("^([1-9][0-9_]*)?'[sS]?[dDbBoOhH]?"));
+    static const QRegularExpression prefix(QStringLiteral("^([1-9][0-9_]*)?'[sS]?[dDbBoOhH]?"));
     token.remove(0, prefix.match(token).capturedLength());
     token.remove(QLatin1Char('_'));
 
@@ -275,7 +275,7 @@ int PacketValidator::baseOf(QString const& constantNumber) const
         { QStringLiteral("B"), 2 },
     };
 
-    static QRegularExpression baseFormat(QStringLiteral("'[sS]?([dDbBoOhH]?)"));
+    static const QRegularExpression baseFormat(QStringLiteral("'[sS]?([dDbBoOhH]?)"));
 
     QString format = baseFormat.match(constantNumber).captured(1);
 
@@ -40,6 +40,8 @@
 
 #include <IPXACTmodels/Component/Model.h>
 
+#include <IPXACTmodels/common/DocumentStreamReader.h>
+
 //-----------------------------------------------------------------------------
 // Function: ComponentReader::ComponentReader()
 //-----------------------------------------------------------------------------
@@ -117,6 +119,42 @@ QSharedPointer<Component> ComponentReader::createComponentFrom(QDomDocument cons
     return newComponent;
 }
 
+//-----------------------------------------------------------------------------
+// Function: ComponentReader::createComponentFrom()
+//-----------------------------------------------------------------------------
+QSharedPointer<Component> ComponentReader::createComponentFrom(QXmlStreamReader& xmlReader) const
+{
+    QList<QSharedPointer<MemoryMap> > memoryMaps;
+    QList<QSharedPointer<Port> > ports;
+
+    DocumentStreamReader streamReader;
+    streamReader.streamSection({ QStringLiteral("ipxact:memoryMaps") }, QStringLiteral("ipxact:memoryMap"),
+        [&memoryMaps](QDomNode const& memoryMapNode, Document::Revision revision)
+        { memoryMaps.append(MemoryMapReader::createMemoryMapFrom(memoryMapNode, revision)); });
+
+    streamReader.streamSection({ QStringLiteral("ipxact:model"), QStringLiteral("ipxact:ports") },
+        QStringLiteral("ipxact:port"),
+        [&ports](QDomNode const& portNode, Document::Revision revision)
+        { ports.append(PortReader::createPortFrom(portNode, revision)); });
+
+    QDomDocument componentDocument = streamReader.read(xmlReader);
+    if (componentDocument.isNull())
+    {
+        return QSharedPointer<Component>();
+    }
+
+    // The sections of the streamed items are empty in the document, so the items are added last.
+    QSharedPointer<Component> newComponent = createComponentFrom(componentDocument);
+    newComponent->getMemoryMaps()->append(memoryMaps);
+
+    if (ports.isEmpty() == false)
+    {
+        newComponent->getModel()->getPorts()->append(ports);
+    }
+
+    return newComponent;
+}
+
 //-----------------------------------------------------------------------------
 // Function: ComponentReader::parsePowerDomains()
 //-----------------------------------------------------------------------------
@@ -18,6 +18,7 @@
 
 #include <QSharedPointer>
 #include <QDomNode>
+#include <QXmlStreamReader>
 
 class Component;
 class Model;
@@ -46,6 +47,16 @@ public:
      */
     QSharedPointer<Component> createComponentFrom(QDomDocument const& componentDocument) const;
 
+    /*!
+     *  Creates a new component from a stream. The memory maps and ports are parsed one at a time while
+     *  reading, so that the whole document is never held in memory as a DOM tree.
+     *
+     *      @param [in] xmlReader   The reader positioned at the start of the component document.
+     *
+     *      @return The created component, or null if the document could not be read.
+     */
+    QSharedPointer<Component> createComponentFrom(QXmlStreamReader& xmlReader) const;
+
 private:
 
     //! No copying allowed.
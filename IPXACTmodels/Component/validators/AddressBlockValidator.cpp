@@ -29,7 +29,9 @@
 #include <IPXACTmodels/Component/MemoryArray.h>
 #include <IPXACTmodels/common/Parameter.h>
 
+#include <QHash>
 #include <QRegularExpression>
+#include <QSet>
 
 //-----------------------------------------------------------------------------
 // Function: AddressBlockValidator::AddressBlockValidator()
@@ -151,10 +153,12 @@ bool AddressBlockValidator::hasValidRegisterData(QSharedPointer<AddressBlock> ad
         return true;
     }
 
-    QStringList registerNames;
-    QStringList registerFileNames;
+    QSet<QString> registerNames;
+    QSet<QString> registerFileNames;
 
-    QStringList typeIdentifiers;
+    // The index of the first register with each type identifier, counting registers only.
+    QHash<QString, int> typeIdentifierIndexes;
+    int registerIndex = 0;
     MemoryReserve reservedArea;
 
     bool aubChangeOk = true;
@@ -176,9 +180,9 @@ bool AddressBlockValidator::hasValidRegisterData(QSharedPointer<AddressBlock> ad
             }
             
             if (!targetRegister->getTypeIdentifier().isEmpty() &&
-                typeIdentifiers.contains(targetRegister->getTypeIdentifier()))
+                typeIdentifierIndexes.contains(targetRegister->getTypeIdentifier()))
             {
-                int typeIdentifierIndex = typeIdentifiers.indexOf(targetRegister->getTypeIdentifier());
+                int typeIdentifierIndex = typeIdentifierIndexes.value(targetRegister->getTypeIdentifier());
                 if (!registersHaveSimilarDefinitionGroups(targetRegister, addressBlock,
                     typeIdentifierIndex))
                 {
@@ -208,8 +212,12 @@ bool AddressBlockValidator::hasValidRegisterData(QSharedPointer<AddressBlock> ad
                 }
             }
 
-            registerNames.append(targetRegister->name());
-            typeIdentifiers.append(targetRegister->getTypeIdentifier());
+            registerNames.insert(targetRegister->name());
+            if (typeIdentifierIndexes.contains(targetRegister->getTypeIdentifier()) == false)
+            {
+                typeIdentifierIndexes.insert(targetRegister->getTypeIdentifier(), registerIndex);
+            }
+            ++registerIndex;
         }
         else if (QSharedPointer<RegisterFile> targetRegisterFile = registerData.dynamicCast<RegisterFile>())
         {
@@ -237,7 +245,7 @@ bool AddressBlockValidator::hasValidRegisterData(QSharedPointer<AddressBlock> ad
                 return false;
             }
 
-            registerFileNames.append(targetRegisterFile->name());
+            registerFileNames.insert(targetRegisterFile->name());
         }
     }
 
@@ -556,11 +564,14 @@ void AddressBlockValidator::findErrorsInRegisterData(QVector<QString>& errors,
         return;
     }
 
-    QStringList registerNames;
-    QStringList registerFileNames;
-    QStringList duplicateRegisterNames;
-    QStringList duplicateRegisterFileNames;
-    QStringList typeIdentifiers;
+    QSet<QString> registerNames;
+    QSet<QString> registerFileNames;
+    QSet<QString> duplicateRegisterNames;
+    QSet<QString> duplicateRegisterFileNames;
+
+    // The index of the first register with each type identifier, counting registers only.
+    QHash<QString, int> typeIdentifierIndexes;
+    int registerIndex = 0;
 
     MemoryReserve reservedArea;
     bool aubChangeOk = true;
@@ -577,11 +588,11 @@ void AddressBlockValidator::findErrorsInRegisterData(QVector<QString>& errors,
             {
                 errors.append(QObject::tr("Name %1 of registers in addressBlock %2 is not unique.")
                     .arg(targetRegister->name()).arg(addressBlock->name()));
-                duplicateRegisterNames.append(targetRegister->name());
+                duplicateRegisterNames.insert(targetRegister->name());
             }
             else
             {
-                registerNames.append(targetRegister->name());
+                registerNames.insert(targetRegister->name());
             }
 
             registerValidator_->findErrorsIn(errors, targetRegister, context);
@@ -599,9 +610,9 @@ void AddressBlockValidator::findErrorsInRegisterData(QVector<QString>& errors,
             }
 
             if (!targetRegister->getTypeIdentifier().isEmpty() &&
-                typeIdentifiers.contains(targetRegister->getTypeIdentifier()))
+                typeIdentifierIndexes.contains(targetRegister->getTypeIdentifier()))
             {
-                int typeIdentifierIndex = typeIdentifiers.indexOf(targetRegister->getTypeIdentifier());
+                int typeIdentifierIndex = typeIdentifierIndexes.value(targetRegister->getTypeIdentifier());
 
                 if (!registersHaveSimilarDefinitionGroups(targetRegister, addressBlock, typeIdentifierIndex))
                 {
@@ -609,7 +620,11 @@ void AddressBlockValidator::findErrorsInRegisterData(QVector<QString>& errors,
                         "similar register definitions within %1").arg(context));
                 }
             }
-            typeIdentifiers.append(targetRegister->getTypeIdentifier());
+            if (typeIdentifierIndexes.contains(targetRegister->getTypeIdentifier()) == false)
+            {
+                typeIdentifierIndexes.insert(targetRegister->getTypeIdentifier(), registerIndex);
+            }
+            ++registerIndex;
 
             if (docRevision_ == Document::Revision::Std14 && !hasValidAccessWithRegister(addressBlock, targetRegister))
             {
@@ -650,11 +665,11 @@ void AddressBlockValidator::findErrorsInRegisterData(QVector<QString>& errors,
             {
                 errors.append(QObject::tr("Name %1 of register files in addressBlock %2 is not unique.")
                     .arg(targetRegisterFile->name()).arg(addressBlock->name()));
-                duplicateRegisterFileNames.append(targetRegisterFile->name());
+                duplicateRegisterFileNames.insert(targetRegisterFile->name());
             }
             else
             {
-                registerFileNames.append(targetRegisterFile->name());
+                registerFileNames.insert(targetRegisterFile->name());
             }
 
             registerFileValidator_->findErrorsIn(errors, targetRegisterFile, context, addressUnitBits, addressBlock->getWidth());
@@ -25,6 +25,9 @@
 #include <IPXACTmodels/Component/validators/SubspaceMapValidator.h>
 
 #include <QRegularExpression>
+#include <QSet>
+
+#include <algorithm>
 
 //-----------------------------------------------------------------------------
 // Function: MemoryMapBaseValidator::MemoryMapBaseValidator()
@@ -134,7 +137,7 @@ bool MemoryMapBaseValidator::hasValidMemoryBlocks(QSharedPointer<MemoryMapBase>
 {
     if (!memoryMapBase->getMemoryBlocks()->isEmpty())
     {
-        QStringList memoryBlockNames;
+        QSet<QString> memoryBlockNames;
         for (int blockIndex = 0; blockIndex < memoryMapBase->getMemoryBlocks()->size(); ++blockIndex)
         {
             QSharedPointer<MemoryBlockBase> blockData = memoryMapBase->getMemoryBlocks()->at(blockIndex);
@@ -143,7 +146,7 @@ bool MemoryMapBaseValidator::hasValidMemoryBlocks(QSharedPointer<MemoryMapBase>
                 return false;
             }
 
-            memoryBlockNames.append(blockData->name());
+            memoryBlockNames.insert(blockData->name());
 
             QSharedPointer<AddressBlock> addressBlock = blockData.dynamicCast<AddressBlock>();
             if (addressBlock &&
@@ -160,11 +163,11 @@ bool MemoryMapBaseValidator::hasValidMemoryBlocks(QSharedPointer<MemoryMapBase>
                     return false;
                 }
             }
+        }
 
-            if (memoryBlockOverlaps(blockData, memoryMapBase, blockIndex))
-            {
-                return false;
-            }
+        if (hasOverlappingBlocks(memoryMapBase))
+        {
+            return false;
         }
     }
 
@@ -188,71 +191,172 @@ bool MemoryMapBaseValidator::addressBlockWidthIsMultiplicationOfAUB(QString cons
 }
 
 //-----------------------------------------------------------------------------
-// Function: MemoryMapBaseValidator::addressBlockOverlap()
+// Function: MemoryMapBaseValidator::evaluateBlockExpressions()
 //-----------------------------------------------------------------------------
-bool MemoryMapBaseValidator::memoryBlockOverlaps(QSharedPointer<MemoryBlockBase> memoryBlock,
-    QSharedPointer<MemoryMapBase> memoryMapBase, int memoryBlockIndex) const
+ExpressionParser::ResultTable MemoryMapBaseValidator::evaluateBlockExpressions(
+    QSharedPointer<MemoryMapBase> memoryMapBase) const
 {
-    for (int blockIndex = memoryBlockIndex + 1; blockIndex < memoryMapBase->getMemoryBlocks()->size();
-        ++blockIndex)
+    QStringList expressions;
+    for (QSharedPointer<MemoryBlockBase> block : *memoryMapBase->getMemoryBlocks())
     {
-        QSharedPointer<MemoryBlockBase> comparisonBlock = memoryMapBase->getMemoryBlocks()->at(blockIndex);
-        if (twoMemoryBlocksOverlap(memoryBlock, comparisonBlock))
+        if (block)
         {
-            return true;
+            expressions.append(block->getIsPresent());
+            expressions.append(block->getBaseAddress());
+            expressions.append(getBlockRangeExpression(block));
         }
     }
 
-    return false;
+    return expressionParser_->parseExpressions(expressions);
 }
 
 //-----------------------------------------------------------------------------
-// Function: MemoryMapBaseValidator::twoAddressBlocksOverlap()
+// Function: MemoryMapBaseValidator::getBlockAreas()
 //-----------------------------------------------------------------------------
-bool MemoryMapBaseValidator::twoMemoryBlocksOverlap(QSharedPointer<MemoryBlockBase> memoryBlock,
-    QSharedPointer<MemoryBlockBase> comparedBlock) const
+QVector<MemoryMapBaseValidator::BlockArea> MemoryMapBaseValidator::getBlockAreas(
+    QSharedPointer<MemoryMapBase> memoryMapBase) const
 {
-    bool blockPresent = memoryBlock->getIsPresent().isEmpty() ||
-        expressionParser_->parseExpression(memoryBlock->getIsPresent()).toInt();
-    bool comparedPresent = comparedBlock->getIsPresent().isEmpty() ||
-        expressionParser_->parseExpression(comparedBlock->getIsPresent()).toInt();
+    const ExpressionParser::ResultTable blockValues = evaluateBlockExpressions(memoryMapBase);
 
-    if (blockPresent && comparedPresent)
+    QVector<BlockArea> areas;
+    areas.reserve(memoryMapBase->getMemoryBlocks()->size());
+
+    for (int blockIndex = 0; blockIndex < memoryMapBase->getMemoryBlocks()->size(); ++blockIndex)
     {
-        quint64 blockBegin = expressionParser_->parseExpression(memoryBlock->getBaseAddress()).toULongLong();
-        quint64 blockEnd = blockBegin + getBlockRange(memoryBlock) - 1;
+        QSharedPointer<MemoryBlockBase> block = memoryMapBase->getMemoryBlocks()->at(blockIndex);
+        if (block && (block->getIsPresent().isEmpty() || blockValues.value(block->getIsPresent()).value.toInt()))
+        {
+            BlockArea area;
+            area.index_ = blockIndex;
+            area.begin_ = blockValues.value(block->getBaseAddress()).value.toULongLong();
+            area.end_ = area.begin_ + blockValues.value(getBlockRangeExpression(block)).value.toULongLong() - 1;
 
-        quint64 compareBegin = expressionParser_->parseExpression(comparedBlock->getBaseAddress()).toULongLong();
-        quint64 compareEnd = compareBegin + getBlockRange(comparedBlock) - 1;
+            areas.append(area);
+        }
+    }
 
-        if (((blockBegin >= compareBegin && blockBegin <= compareEnd) ||
-            (blockEnd >= compareBegin && blockEnd <= compareEnd)) ||
-            ((compareBegin >= blockBegin && compareBegin <= blockEnd) ||
-            (compareEnd >= blockBegin && compareEnd <= blockEnd)))
+    return areas;
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryMapBaseValidator::hasOverlappingBlocks()
+//-----------------------------------------------------------------------------
+bool MemoryMapBaseValidator::hasOverlappingBlocks(QSharedPointer<MemoryMapBase> memoryMapBase) const
+{
+    QVector<BlockArea> areas = getBlockAreas(memoryMapBase);
+    const int rangedCount = sortBlockAreas(areas);
+
+    // Ranged areas are sorted by their first address, so any overlap shows between neighbours.
+    for (int areaIndex = 0; areaIndex < rangedCount - 1; ++areaIndex)
+    {
+        if (areas.at(areaIndex + 1).begin_ <= areas.at(areaIndex).end_)
         {
             return true;
         }
     }
 
+    // Areas without range are rare and compared with all the other areas.
+    for (int areaIndex = rangedCount; areaIndex < areas.size(); ++areaIndex)
+    {
+        for (int comparedIndex = 0; comparedIndex < areas.size(); ++comparedIndex)
+        {
+            if (comparedIndex != areaIndex && blockAreasOverlap(areas.at(areaIndex), areas.at(comparedIndex)))
+            {
+                return true;
+            }
+        }
+    }
+
     return false;
 }
 
 //-----------------------------------------------------------------------------
-// Function: MemoryMapBaseValidator::getBlockEnd()
+// Function: MemoryMapBaseValidator::findOverlappingBlocks()
 //-----------------------------------------------------------------------------
-quint64 MemoryMapBaseValidator::getBlockRange(QSharedPointer<MemoryBlockBase> block) const
+QVector<QVector<int> > MemoryMapBaseValidator::findOverlappingBlocks(QSharedPointer<MemoryMapBase> memoryMapBase)
+    const
 {
-    quint64 memoryRange = 0;
+    QVector<QVector<int> > overlappingBlocks(memoryMapBase->getMemoryBlocks()->size());
+
+    auto addOverlap = [&overlappingBlocks](BlockArea const& area, BlockArea const& comparedArea)
+    {
+        overlappingBlocks[qMin(area.index_, comparedArea.index_)].append(qMax(area.index_, comparedArea.index_));
+    };
+
+    QVector<BlockArea> areas = getBlockAreas(memoryMapBase);
+    const int rangedCount = sortBlockAreas(areas);
+
+    // Sweep the ranged areas in the order of their first address until an area begins after the current one.
+    for (int areaIndex = 0; areaIndex < rangedCount; ++areaIndex)
+    {
+        BlockArea const& area = areas.at(areaIndex);
+        for (int nextIndex = areaIndex + 1; nextIndex < rangedCount && areas.at(nextIndex).begin_ <= area.end_;
+            ++nextIndex)
+        {
+            addOverlap(area, areas.at(nextIndex));
+        }
+    }
+
+    for (int areaIndex = rangedCount; areaIndex < areas.size(); ++areaIndex)
+    {
+        for (int comparedIndex = 0; comparedIndex < areaIndex; ++comparedIndex)
+        {
+            if (blockAreasOverlap(areas.at(areaIndex), areas.at(comparedIndex)))
+            {
+                addOverlap(areas.at(areaIndex), areas.at(comparedIndex));
+            }
+        }
+    }
+
+    for (QVector<int>& laterBlocks : overlappingBlocks)
+    {
+        std::sort(laterBlocks.begin(), laterBlocks.end());
+    }
+
+    return overlappingBlocks;
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryMapBaseValidator::blockAreasOverlap()
+//-----------------------------------------------------------------------------
+bool MemoryMapBaseValidator::blockAreasOverlap(BlockArea const& area, BlockArea const& comparedArea)
+{
+    return (area.begin_ >= comparedArea.begin_ && area.begin_ <= comparedArea.end_) ||
+        (area.end_ >= comparedArea.begin_ && area.end_ <= comparedArea.end_) ||
+        (comparedArea.begin_ >= area.begin_ && comparedArea.begin_ <= area.end_) ||
+        (comparedArea.end_ >= area.begin_ && comparedArea.end_ <= area.end_);
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryMapBaseValidator::sortBlockAreas()
+//-----------------------------------------------------------------------------
+int MemoryMapBaseValidator::sortBlockAreas(QVector<BlockArea>& areas)
+{
+    auto rangedEnd = std::stable_partition(areas.begin(), areas.end(),
+        [](BlockArea const& area) { return area.begin_ <= area.end_; });
+
+    std::stable_sort(areas.begin(), rangedEnd,
+        [](BlockArea const& area, BlockArea const& other) { return area.begin_ < other.begin_; });
+
+    return static_cast<int>(rangedEnd - areas.begin());
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryMapBaseValidator::getBlockRangeExpression()
+//-----------------------------------------------------------------------------
+QString MemoryMapBaseValidator::getBlockRangeExpression(QSharedPointer<MemoryBlockBase> block) const
+{
+    QString memoryRange = QStringLiteral("0");
     QSharedPointer<AddressBlock> addressBlock = block.dynamicCast<AddressBlock>();
     if (addressBlock)
     {
-        memoryRange = expressionParser_->parseExpression(addressBlock->getRange()).toULongLong();
+        memoryRange = addressBlock->getRange();
     }
 
     QSharedPointer<SubSpaceMap> subspace = block.dynamicCast<SubSpaceMap>();
     if (subspace)
     {
-        memoryRange = 1;
+        memoryRange = QStringLiteral("1");
 
         QSharedPointer<AddressSpace> referencedSpace = getReferencedAddressSpace(subspace);
         if (referencedSpace)
@@ -261,11 +365,11 @@ quint64 MemoryMapBaseValidator::getBlockRange(QSharedPointer<MemoryBlockBase> bl
 
             if (referencedSegment)
             {
-                memoryRange = expressionParser_->parseExpression(referencedSegment->getRange()).toULongLong();
+                memoryRange = referencedSegment->getRange();
             }
             else
             {
-                memoryRange = expressionParser_->parseExpression(referencedSpace->getRange()).toULongLong();
+                memoryRange = referencedSpace->getRange();
             }
         }
     }
@@ -362,7 +466,9 @@ void MemoryMapBaseValidator::findErrorsInAddressBlocks(QVector<QString>& errors,
 {
     if (!memoryMapBase->getMemoryBlocks()->isEmpty())
     {
-        QStringList memoryBlockNames;
+        const QVector<QVector<int> > overlappingBlocks = findOverlappingBlocks(memoryMapBase);
+
+        QSet<QString> memoryBlockNames;
         for (int blockIndex = 0; blockIndex < memoryMapBase->getMemoryBlocks()->size(); ++blockIndex)
         {
             QSharedPointer<MemoryBlockBase> memoryBlock = memoryMapBase->getMemoryBlocks()->at(blockIndex);
@@ -372,7 +478,7 @@ void MemoryMapBaseValidator::findErrorsInAddressBlocks(QVector<QString>& errors,
                     .arg(memoryBlock->name()).arg(context));
             }
 
-            memoryBlockNames.append(memoryBlock->name());
+            memoryBlockNames.insert(memoryBlock->name());
 
             QSharedPointer<AddressBlock> addressBlock = memoryBlock.dynamicCast<AddressBlock>();
             QSharedPointer<SubSpaceMap> subspace = memoryBlock.dynamicCast<SubSpaceMap>();
@@ -395,7 +501,8 @@ void MemoryMapBaseValidator::findErrorsInAddressBlocks(QVector<QString>& errors,
                     subspaceValidator_->findErrorsIn(errors, subspace, context);
                 }
 
-                findErrorsInOverlappingBlocks(errors, memoryMapBase, memoryBlock, blockIndex, context);
+                findErrorsInOverlappingBlocks(errors, memoryMapBase, memoryBlock, overlappingBlocks.at(blockIndex),
+                    context);
             }
         }
     }
@@ -405,21 +512,14 @@ void MemoryMapBaseValidator::findErrorsInAddressBlocks(QVector<QString>& errors,
 // Function: MemoryMapBaseValidator::findErrorsInOverlappingBlocks()
 //-----------------------------------------------------------------------------
 void MemoryMapBaseValidator::findErrorsInOverlappingBlocks(QVector<QString>& errors,
-    QSharedPointer<MemoryMapBase> memoryMapBase, QSharedPointer<MemoryBlockBase> memoryBlock, int blockIndex,
-    QString const& context) const
+    QSharedPointer<MemoryMapBase> memoryMapBase, QSharedPointer<MemoryBlockBase> memoryBlock,
+    QVector<int> const& overlappingBlocks, QString const& context) const
 {
-    for (int comparisonIndex = blockIndex + 1; comparisonIndex < memoryMapBase->getMemoryBlocks()->size();
-        ++comparisonIndex)
+    for (int comparisonIndex : overlappingBlocks)
     {
         QSharedPointer<MemoryBlockBase> comparisonBlock = memoryMapBase->getMemoryBlocks()->at(comparisonIndex);
-        if (comparisonBlock)
-        {
-            if (twoMemoryBlocksOverlap(memoryBlock, comparisonBlock))
-            {
-                errors.append(QObject::tr("Memory blocks %1 and %2 overlap in %3")
-                    .arg(memoryBlock->name()).arg(comparisonBlock->name()).arg(context));
-            }
-        }
+        errors.append(QObject::tr("Memory blocks %1 and %2 overlap in %3")
+            .arg(memoryBlock->name()).arg(comparisonBlock->name()).arg(context));
     }
 }
 
@@ -16,10 +16,12 @@
 
 #include <IPXACTmodels/common/Document.h>
 
+#include <KactusAPI/include/ExpressionParser.h>
+
 #include <QSharedPointer>
 #include <QString>
+#include <QVector>
 
-class ExpressionParser;
 class MemoryMapBase;
 class MemoryBlockBase;
 class AddressBlockValidator;
@@ -143,35 +145,82 @@ protected:
 
 private:
 
+    //! The address area of a present memory block.
+    struct BlockArea
+    {
+        //! Index of the memory block in the memory map base.
+        int index_ = 0;
+
+        //! The first address of the memory block.
+        quint64 begin_ = 0;
+
+        //! The last address of the memory block. Less than the first address for blocks without range.
+        quint64 end_ = 0;
+    };
+
     /*!
-     *  Check if the memory block overlaps with another memory block.
+     *  Evaluates the expressions used for locating the memory blocks of a memory map base.
      *
-     *      @param [in] memoryBlock         The selected memory block.
-     *      @param [in] memoryMapBase       The selected memory map base.
-     *      @param [in] memoryBlockIndex    The index of the memory block.
+     *      @param [in] memoryMapBase   The selected memory map base.
+     *
+     *      @return The isPresent, base address and range expressions of the memory blocks evaluated.
+     */
+    ExpressionParser::ResultTable evaluateBlockExpressions(QSharedPointer<MemoryMapBase> memoryMapBase) const;
+
+    /*!
+     *  Get the address areas of the present memory blocks.
+     *
+     *      @param [in] memoryMapBase   The selected memory map base.
+     *
+     *      @return The address areas of the memory blocks in the order of the memory blocks.
+     */
+    QVector<BlockArea> getBlockAreas(QSharedPointer<MemoryMapBase> memoryMapBase) const;
+
+    /*!
+     *  Check if any of the memory blocks overlap.
+     *
+     *      @param [in] memoryMapBase   The selected memory map base.
      *
      *      @return True, if the memory blocks overlap, otherwise false.
      */
-    bool memoryBlockOverlaps(QSharedPointer<MemoryBlockBase> memoryBlock,
-        QSharedPointer<MemoryMapBase> memoryMapBase, int memoryBlockIndex) const;
+    bool hasOverlappingBlocks(QSharedPointer<MemoryMapBase> memoryMapBase) const;
 
     /*!
-     *  Check if two memory blocks overlap.
+     *  Find the overlapping memory blocks.
      *
-     *      @param [in] memoryBlock     The selected memory block.
-     *      @param [in] comparedBlock   The compared memory block.
+     *      @param [in] memoryMapBase   The selected memory map base.
+     *
+     *      @return For each memory block index, the ascending indices of the later blocks overlapping it.
+     */
+    QVector<QVector<int> > findOverlappingBlocks(QSharedPointer<MemoryMapBase> memoryMapBase) const;
+
+    /*!
+     *  Check if two memory block areas overlap.
+     *
+     *      @param [in] area            The selected memory block area.
+     *      @param [in] comparedArea    The compared memory block area.
+     *
+     *      @return True, if the areas overlap, otherwise false.
      */
-    bool twoMemoryBlocksOverlap(QSharedPointer<MemoryBlockBase> memoryBlock,
-        QSharedPointer<MemoryBlockBase> comparedBlock) const;
+    static bool blockAreasOverlap(BlockArea const& area, BlockArea const& comparedArea);
 
     /*!
-     *  Get the range of the selected memory block
+     *  Sort the memory block areas for sweeping.
+     *
+     *      @param [in/out] areas           The areas to sort. Areas without range are moved to the end.
+     *
+     *      @return The number of areas with a range, in ascending order of the first address.
+     */
+    static int sortBlockAreas(QVector<BlockArea>& areas);
+
+    /*!
+     *  Get the range expression of the selected memory block.
      *
      *      @param [in] block   The selected memory block.
      *
-     *      @return Range of the selected memory block.
+     *      @return Range expression of the selected memory block.
      */
-    quint64 getBlockRange(QSharedPointer<MemoryBlockBase> block) const;
+    QString getBlockRangeExpression(QSharedPointer<MemoryBlockBase> block) const;
 
     /*!
      *  Get the address space referenced by the selected subspace map.
@@ -238,14 +287,15 @@ private:
     /*!
      *  Find errors within overlapping memory blocks.
      *
-     *      @param [in] errors          List of found errors.
-     *      @param [in] memoryMapBase   The selected memory map base.
-     *      @param [in] memoryBlock     The selected memory block.
-     *      @param [in] blockIndex      The index of the address block.
-     *      @param [in] context         Context to help locate the error.
+     *      @param [in] errors              List of found errors.
+     *      @param [in] memoryMapBase       The selected memory map base.
+     *      @param [in] memoryBlock         The selected memory block.
+     *      @param [in] overlappingBlocks   The indices of the later memory blocks overlapping the selected block.
+     *      @param [in] context             Context to help locate the error.
      */
     void findErrorsInOverlappingBlocks(QVector<QString>& errors, QSharedPointer<MemoryMapBase> memoryMapBase,
-        QSharedPointer<MemoryBlockBase> memoryBlock, int blockIndex, QString const& context) const;
+        QSharedPointer<MemoryBlockBase> memoryBlock, QVector<int> const& overlappingBlocks,
+        QString const& context) const;
 
     //-----------------------------------------------------------------------------
     // Data.
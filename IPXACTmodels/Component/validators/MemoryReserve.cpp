@@ -115,11 +115,11 @@ void MemoryReserve::findErrorsInOverlap(QVector<QString>& errors, QString const&
 
 	for (int i = 0; i < reservedArea_.size(); ++i)
 	{
-		MemoryArea area = reservedArea_.at(i);
+		MemoryArea const& area = reservedArea_.at(i);
 
 		for (int j = i + 1; j < reservedArea_.size(); ++j)
 		{
-			MemoryArea nextArea = reservedArea_.at(j);
+			MemoryArea const& nextArea = reservedArea_.at(j);
 
 			if (nextArea.begin_ > area.end_)
 			{
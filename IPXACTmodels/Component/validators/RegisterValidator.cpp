@@ -28,7 +28,9 @@
 #include <IPXACTmodels/Component/EnumeratedValue.h>
 #include <IPXACTmodels/Component/WriteValueConstraint.h>
 
+#include <QHash>
 #include <QRegularExpression>
+#include <QSet>
 
 //-----------------------------------------------------------------------------
 // Function: RegisterValidator::RegisterValidator()
@@ -105,8 +107,10 @@ bool RegisterValidator::hasValidFields(QSharedPointer<RegisterDefinition> select
 
     MemoryReserve reservedArea;
 
-    QVector<QString> fieldNames;
-    QVector<QString> fieldTypeIdentifiers;
+    QSet<QString> fieldNames;
+
+    // The index of the first field with each type identifier.
+    QHash<QString, int> fieldTypeIdentifierIndexes;
     for (int fieldIndex = 0; fieldIndex < selectedRegister->getFields()->size(); ++fieldIndex)
     {
         QSharedPointer<Field> field = selectedRegister->getFields()->at(fieldIndex);
@@ -134,9 +138,10 @@ bool RegisterValidator::hasValidFields(QSharedPointer<RegisterDefinition> select
               reservedArea.addArea(field->name(), rangeBegin, rangeEnd);
             }
 
-            if (!field->getTypeIdentifier().isEmpty() && fieldTypeIdentifiers.contains(field->getTypeIdentifier()))
+            if (!field->getTypeIdentifier().isEmpty() &&
+                fieldTypeIdentifierIndexes.contains(field->getTypeIdentifier()))
             {
-                int typeIdIndex = fieldTypeIdentifiers.indexOf(field->getTypeIdentifier());
+                int typeIdIndex = fieldTypeIdentifierIndexes.value(field->getTypeIdentifier());
 
                 QSharedPointer<Field> comparedField = selectedRegister->getFields()->at(typeIdIndex);
                 if (!fieldsHaveSimilarDefinitionGroups(field, comparedField))
@@ -145,8 +150,11 @@ bool RegisterValidator::hasValidFields(QSharedPointer<RegisterDefinition> select
                 }
             }
 
-            fieldNames.append(field->name());
-            fieldTypeIdentifiers.append(field->getTypeIdentifier());
+            fieldNames.insert(field->name());
+            if (fieldTypeIdentifierIndexes.contains(field->getTypeIdentifier()) == false)
+            {
+                fieldTypeIdentifierIndexes.insert(field->getTypeIdentifier(), fieldIndex);
+            }
 
             if (field->getVolatile().toBool() == true && selectedRegister->getVolatile() == QLatin1String("false"))
             {
@@ -393,8 +401,11 @@ void RegisterValidator::findErrorsInFields(QVector<QString>& errors,
 {
     if (!selectedRegister->getFields()->isEmpty())
     {
-        QStringList fieldNames;
-        QStringList fieldTypeIdentifiers;
+        QSet<QString> fieldNames;
+
+        // The index of the first field with each type identifier.
+        QHash<QString, int> fieldTypeIdentifierIndexes;
+        int fieldIndex = 0;
 
         qint64 registerSizeInt = expressionParser_->parseExpression(registerSize).toLongLong();
         MemoryReserve reservedArea;
@@ -427,9 +438,10 @@ void RegisterValidator::findErrorsInFields(QVector<QString>& errors,
               reservedArea.addArea(field->name(), rangeBegin, rangeEnd);
             }
 
-            if (!field->getTypeIdentifier().isEmpty() && fieldTypeIdentifiers.contains(field->getTypeIdentifier()))
+            if (!field->getTypeIdentifier().isEmpty() &&
+                fieldTypeIdentifierIndexes.contains(field->getTypeIdentifier()))
             {
-                int typeIdIndex = fieldTypeIdentifiers.indexOf(field->getTypeIdentifier());
+                int typeIdIndex = fieldTypeIdentifierIndexes.value(field->getTypeIdentifier());
                 QSharedPointer<Field> comparedField = selectedRegister->getFields()->at(typeIdIndex);
                 if (!fieldsHaveSimilarDefinitionGroups(field, comparedField))
                 {
@@ -439,8 +451,12 @@ void RegisterValidator::findErrorsInFields(QVector<QString>& errors,
                 }
             }
 
-            fieldNames.append(field->name());
-            fieldTypeIdentifiers.append(field->getTypeIdentifier());
+            fieldNames.insert(field->name());
+            if (fieldTypeIdentifierIndexes.contains(field->getTypeIdentifier()) == false)
+            {
+                fieldTypeIdentifierIndexes.insert(field->getTypeIdentifier(), fieldIndex);
+            }
+            ++fieldIndex;
 
             if (field->getVolatile().toBool() == true && selectedRegister->getVolatile() == QLatin1String("false"))
             {
@@ -23,6 +23,8 @@
 
 #include <IPXACTmodels/utilities/XmlUtils.h>
 
+#include <IPXACTmodels/common/DocumentStreamReader.h>
+
 
 //-----------------------------------------------------------------------------
 // Function: DesignReader::createDesignFrom()
@@ -59,6 +61,62 @@ QSharedPointer<Design> DesignReader::createDesignFrom(QDomDocument const& docume
     return newDesign;
 }
 
+//-----------------------------------------------------------------------------
+// Function: DesignReader::createDesignFrom()
+//-----------------------------------------------------------------------------
+QSharedPointer<Design> DesignReader::createDesignFrom(QXmlStreamReader& xmlReader)
+{
+    // The streamed connections are collected into a separate design, since the parsers add them directly.
+    QSharedPointer<Design> streamedItems;
+    auto getStreamedItems = [&streamedItems](Document::Revision revision)
+    {
+        if (streamedItems.isNull())
+        {
+            streamedItems = QSharedPointer<Design>(new Design(VLNV(), revision));
+        }
+
+        return streamedItems;
+    };
+
+    // All child nodes are streamed, since the DOM parsers also read all of them.
+    DocumentStreamReader streamReader;
+    streamReader.streamSection({ QStringLiteral("ipxact:componentInstances") }, QString(),
+        [&getStreamedItems](QDomNode const& instanceNode, Document::Revision revision)
+        {
+            getStreamedItems(revision)->getComponentInstances()->append(
+                ComponentInstanceReader::createComponentInstanceFrom(instanceNode, revision));
+        });
+
+    streamReader.streamSection({ QStringLiteral("ipxact:interconnections") }, QString(),
+        [&getStreamedItems](QDomNode const& interconnectionNode, Document::Revision revision)
+        { Details::parseSingleInterconnection(interconnectionNode, getStreamedItems(revision)); });
+
+    streamReader.streamSection({ QStringLiteral("ipxact:adHocConnections") }, QString(),
+        [&getStreamedItems](QDomNode const& adHocNode, Document::Revision revision)
+        { Details::parseSingleAdHocConnection(adHocNode, getStreamedItems(revision)); });
+
+    QDomDocument document = streamReader.read(xmlReader);
+    if (document.isNull())
+    {
+        return QSharedPointer<Design>();
+    }
+
+    // The sections of the streamed items are empty in the document, so the items are added afterwards.
+    QSharedPointer<Design> newDesign = createDesignFrom(document);
+    if (streamedItems)
+    {
+        // The SW instances from the vendor extensions follow the HW instances, as in the DOM read.
+        QSharedPointer<QList<QSharedPointer<ComponentInstance> > > instances = newDesign->getComponentInstances();
+        *instances = *streamedItems->getComponentInstances() + *instances;
+
+        newDesign->getInterconnections()->append(*streamedItems->getInterconnections());
+        newDesign->getMonitorInterconnecions()->append(*streamedItems->getMonitorInterconnecions());
+        newDesign->getAdHocConnections()->append(*streamedItems->getAdHocConnections());
+    }
+
+    return newDesign;
+}
+
 //-----------------------------------------------------------------------------
 // Function: DesignReader::parseComponentInstances()
 //-----------------------------------------------------------------------------
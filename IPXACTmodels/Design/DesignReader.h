@@ -22,6 +22,7 @@
 
 #include <QDomNode>
 #include <QDomNodeList>
+#include <QXmlStreamReader>
 
 //-----------------------------------------------------------------------------
 //! XML reader for IP-XACT design element.
@@ -38,6 +39,16 @@ namespace DesignReader
      */
     IPXACTMODELS_EXPORT QSharedPointer<Design> createDesignFrom(QDomDocument const& document);
 
+    /*!
+     *  Creates a design from a stream. The component instances and connections are parsed one at a time
+     *  while reading, so that the whole document is never held in memory as a DOM tree.
+     *
+     *      @param [in] xmlReader   The reader positioned at the start of the design document.
+     *
+     *      @return The created design, or null if the document could not be read.
+     */
+    IPXACTMODELS_EXPORT QSharedPointer<Design> createDesignFrom(QXmlStreamReader& xmlReader);
+
     namespace Details
     {
         /*!
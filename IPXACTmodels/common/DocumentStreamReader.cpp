@@ -0,0 +1,231 @@
+//-----------------------------------------------------------------------------
+// File: DocumentStreamReader.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 17.10.2026
+//
+// Description:
+// Pull parser for IP-XACT documents that hands out large element lists one item at a time.
+//-----------------------------------------------------------------------------
+
+#include "DocumentStreamReader.h"
+
+#include "DocumentReader.h"
+
+//-----------------------------------------------------------------------------
+// Function: DocumentStreamReader::streamSection()
+//-----------------------------------------------------------------------------
+void DocumentStreamReader::streamSection(QStringList const& sectionPath, QString const& itemName,
+    ItemHandler const& handler)
+{
+    sections_.append(Section{ sectionPath, itemName, handler });
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentStreamReader::read()
+//-----------------------------------------------------------------------------
+QDomDocument DocumentStreamReader::read(QXmlStreamReader& xmlReader) const
+{
+    // Element and attribute names are kept qualified like in the DOM readers.
+    xmlReader.setNamespaceProcessing(false);
+
+    QDomDocument document;
+    QDomNode parentNode = document;
+
+    // The names of the open elements below the document element.
+    QStringList openElements;
+    bool rootFound = false;
+
+    Document::Revision revision = Document::Revision::Unknown;
+
+    while (xmlReader.atEnd() == false)
+    {
+        xmlReader.readNext();
+
+        if (xmlReader.isEndElement())
+        {
+            parentNode = parentNode.parentNode();
+            if (openElements.isEmpty() == false)
+            {
+                openElements.removeLast();
+            }
+            continue;
+        }
+
+        if (Section const* section = findSection(openElements, xmlReader); section != nullptr)
+        {
+            // The item is built under a copy of its section element, so that all node types can be stored.
+            QDomDocument itemDocument;
+            QDomNode itemParent = itemDocument.appendChild(itemDocument.createElement(openElements.last()));
+            readNode(xmlReader, itemDocument, itemParent);
+
+            QDomNode itemNode = itemParent.firstChild();
+            if (itemNode.isNull() == false)
+            {
+                section->handler(itemNode, revision);
+            }
+            continue;
+        }
+
+        QDomNode node = createNode(xmlReader, document);
+        if (node.isNull())
+        {
+            continue;
+        }
+
+        parentNode.appendChild(node);
+
+        if (node.isElement())
+        {
+            if (rootFound)
+            {
+                openElements.append(node.nodeName());
+            }
+            else
+            {
+                rootFound = true;
+                revision = DocumentReader::getXMLDocumentRevision(node);
+            }
+
+            parentNode = node;
+        }
+    }
+
+    if (xmlReader.hasError() || rootFound == false)
+    {
+        return QDomDocument();
+    }
+
+    return document;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentStreamReader::findSection()
+//-----------------------------------------------------------------------------
+DocumentStreamReader::Section const* DocumentStreamReader::findSection(QStringList const& openElements,
+    QXmlStreamReader const& xmlReader) const
+{
+    if (openElements.isEmpty())
+    {
+        return nullptr;
+    }
+
+    for (Section const& section : sections_)
+    {
+        if (section.path != openElements)
+        {
+            continue;
+        }
+
+        if (section.itemName.isEmpty())
+        {
+            // Tokens that do not become DOM nodes are not items.
+            if (xmlReader.isStartElement() || xmlReader.isComment() || xmlReader.isProcessingInstruction() ||
+                (xmlReader.isCharacters() && (xmlReader.isWhitespace() == false || xmlReader.isCDATA())))
+            {
+                return &section;
+            }
+        }
+        else if (xmlReader.isStartElement() && xmlReader.qualifiedName() == section.itemName)
+        {
+            return &section;
+        }
+    }
+
+    return nullptr;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentStreamReader::readNode()
+//-----------------------------------------------------------------------------
+void DocumentStreamReader::readNode(QXmlStreamReader& xmlReader, QDomDocument& document, QDomNode& parentNode)
+{
+    QDomNode node = createNode(xmlReader, document);
+    if (node.isNull())
+    {
+        return;
+    }
+
+    parentNode.appendChild(node);
+    if (node.isElement() == false)
+    {
+        return;
+    }
+
+    QDomNode currentNode = node;
+    int depth = 1;
+    while (depth > 0 && xmlReader.atEnd() == false)
+    {
+        xmlReader.readNext();
+
+        if (xmlReader.isEndElement())
+        {
+            currentNode = currentNode.parentNode();
+            --depth;
+        }
+        else if (QDomNode childNode = createNode(xmlReader, document); childNode.isNull() == false)
+        {
+            currentNode.appendChild(childNode);
+            if (childNode.isElement())
+            {
+                currentNode = childNode;
+                ++depth;
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentStreamReader::createNode()
+//-----------------------------------------------------------------------------
+QDomNode DocumentStreamReader::createNode(QXmlStreamReader const& xmlReader, QDomDocument& document)
+{
+    if (xmlReader.isStartElement())
+    {
+        QDomElement element = document.createElement(xmlReader.qualifiedName().toString());
+        for (QXmlStreamAttribute const& attribute : xmlReader.attributes())
+        {
+            element.setAttribute(attribute.qualifiedName().toString(), attribute.value().toString());
+        }
+
+        // Namespace declarations are attributes in the DOM tree.
+        for (QXmlStreamNamespaceDeclaration const& declaration : xmlReader.namespaceDeclarations())
+        {
+            QString attributeName = declaration.prefix().isEmpty() ? QStringLiteral("xmlns") :
+                QStringLiteral("xmlns:") + declaration.prefix().toString();
+
+            if (element.hasAttribute(attributeName) == false)
+            {
+                element.setAttribute(attributeName, declaration.namespaceUri().toString());
+            }
+        }
+
+        return element;
+    }
+    else if (xmlReader.isCDATA())
+    {
+        return document.createCDATASection(xmlReader.text().toString());
+    }
+    else if (xmlReader.isCharacters())
+    {
+        // Whitespace between elements is not kept, like in QDomDocument::setContent().
+        if (xmlReader.isWhitespace())
+        {
+            return QDomNode();
+        }
+
+        return document.createTextNode(xmlReader.text().toString());
+    }
+    else if (xmlReader.isComment())
+    {
+        return document.createComment(xmlReader.text().toString());
+    }
+    else if (xmlReader.isProcessingInstruction())
+    {
+        return document.createProcessingInstruction(xmlReader.processingInstructionTarget().toString(),
+            xmlReader.processingInstructionData().toString());
+    }
+
+    return QDomNode();
+}
@@ -0,0 +1,124 @@
+//-----------------------------------------------------------------------------
+// File: DocumentStreamReader.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 17.10.2026
+//
+// Description:
+// Pull parser for IP-XACT documents that hands out large element lists one item at a time.
+//-----------------------------------------------------------------------------
+
+#ifndef DOCUMENTSTREAMREADER_H
+#define DOCUMENTSTREAMREADER_H
+
+#include "Document.h"
+
+#include <IPXACTmodels/ipxactmodels_global.h>
+
+#include <QDomDocument>
+#include <QDomNode>
+#include <QStringList>
+#include <QVector>
+#include <QXmlStreamReader>
+
+#include <functional>
+
+//-----------------------------------------------------------------------------
+//! Pull parser for IP-XACT documents that hands out large element lists one item at a time.
+//
+// The document is read with QXmlStreamReader. The items in the registered sections are built into small
+// separate DOM trees, passed to their handler and released immediately. The rest of the document is
+// collected into a DOM tree like the one built by QDomDocument::setContent(), so that the existing DOM
+// readers can parse it. Only one streamed item is in memory at a time in addition to the remaining document.
+//-----------------------------------------------------------------------------
+class IPXACTMODELS_EXPORT DocumentStreamReader
+{
+public:
+
+    /*!
+     *  Handler for a single streamed item.
+     *
+     *      @param [in] itemNode    The XML description of the item.
+     *      @param [in] revision    The revision of the read document.
+     */
+    using ItemHandler = std::function<void(QDomNode const& itemNode, Document::Revision revision)>;
+
+    //! The constructor.
+    DocumentStreamReader() = default;
+
+    //! The destructor.
+    ~DocumentStreamReader() = default;
+
+    // Disable copying.
+    DocumentStreamReader(DocumentStreamReader const& rhs) = delete;
+    DocumentStreamReader& operator=(DocumentStreamReader const& rhs) = delete;
+
+    /*!
+     *  Registers a section of the document to be streamed.
+     *
+     *      @param [in] sectionPath     The element names from the document element to the section element,
+     *                                  e.g. ipxact:model, ipxact:ports.
+     *      @param [in] itemName        The name of the item elements in the section. If empty, all the child
+     *                                  nodes of the section are streamed.
+     *      @param [in] handler         The handler for the streamed items, called in document order.
+     */
+    void streamSection(QStringList const& sectionPath, QString const& itemName, ItemHandler const& handler);
+
+    /*!
+     *  Reads the document without the streamed items.
+     *
+     *      @param [in] xmlReader   The reader positioned at the start of the document.
+     *
+     *      @return The document with the streamed section elements left empty, or a null document on error.
+     */
+    QDomDocument read(QXmlStreamReader& xmlReader) const;
+
+private:
+
+    //! A streamed section of the document.
+    struct Section
+    {
+        QStringList path;       //!< The element names from the document element to the section element.
+        QString itemName;       //!< The name of the items, or empty for all child nodes.
+        ItemHandler handler;    //!< The handler for the items.
+    };
+
+    /*!
+     *  Finds the section for the current node of the reader.
+     *
+     *      @param [in] openElements    The names of the currently open elements below the document root.
+     *      @param [in] xmlReader       The reader positioned at a node within the open elements.
+     *
+     *      @return The section the node is an item of, or nullptr if the node is not streamed.
+     */
+    Section const* findSection(QStringList const& openElements, QXmlStreamReader const& xmlReader) const;
+
+    /*!
+     *  Reads the current node of the reader, including the children of an element, into the DOM tree.
+     *
+     *      @param [in]     xmlReader   The reader positioned at the node.
+     *      @param [in/out] document    The document to create the node in.
+     *      @param [in/out] parentNode  The node to append the created node to.
+     */
+    static void readNode(QXmlStreamReader& xmlReader, QDomDocument& document, QDomNode& parentNode);
+
+    /*!
+     *  Creates a DOM node for the current token of the reader. Elements are created without children.
+     *
+     *      @param [in]     xmlReader   The reader positioned at the node.
+     *      @param [in/out] document    The document to create the node in.
+     *
+     *      @return The created node, or a null node for tokens that are not kept in the DOM tree.
+     */
+    static QDomNode createNode(QXmlStreamReader const& xmlReader, QDomDocument& document);
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The sections to stream.
+    QVector<Section> sections_;
+};
+
+#endif // DOCUMENTSTREAMREADER_H
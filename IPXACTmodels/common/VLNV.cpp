@@ -41,7 +41,7 @@ namespace
 //-----------------------------------------------------------------------------
 VLNV::VLNV()
 {
-
+    updateHash();
 }
 
 //-----------------------------------------------------------------------------
@@ -55,6 +55,7 @@ VLNV::VLNV(QString const& type,
     version_(version)
 {
 	type_ = string2Type(type);
+    updateHash();
 }
 
 //-----------------------------------------------------------------------------
@@ -68,6 +69,7 @@ VLNV::VLNV(IPXactType const& type,
     version_(version),
     type_(type)
 {
+    updateHash();
 }
 
 //-----------------------------------------------------------------------------
@@ -84,6 +86,8 @@ VLNV::VLNV(IPXactType const& type, QString const& parseStr, QString const& separ
         name_ = vlnvFields.at(2);
         version_ = vlnvFields.at(3);
     }
+
+    updateHash();
 }
 
 //-----------------------------------------------------------------------------
@@ -100,6 +104,7 @@ QString VLNV::getVendor() const
 void VLNV::setVendor(QString const& vendor)
 {
     vendor_ = vendor.simplified();
+    updateHash();
 }
 
 //-----------------------------------------------------------------------------
@@ -116,6 +121,7 @@ QString VLNV::getLibrary() const
 void VLNV::setLibrary(QString const& library)
 {
     library_ = library.simplified();
+    updateHash();
 }
 
 //-----------------------------------------------------------------------------
@@ -132,6 +138,7 @@ QString VLNV::getName() const
 void VLNV::setName(QString const& name)
 {
     name_ = name.simplified();
+    updateHash();
 }
 
 //-----------------------------------------------------------------------------
@@ -148,6 +155,7 @@ QString VLNV::getVersion() const
 void VLNV::setVersion(QString const& version)
 {
     version_ = version.simplified();
+    updateHash();
 }
 
 //-----------------------------------------------------------------------------
@@ -192,6 +200,7 @@ void VLNV::clear()
     name_.clear();
     version_.clear();
     type_ = VLNV::INVALID;
+    updateHash();
 }
 
 //-----------------------------------------------------------------------------
@@ -252,6 +261,14 @@ QString VLNV::toString(QString const& separator) const
     return vendor_ % separator % library_ % separator % name_ % separator % version_;
 }
 
+//-----------------------------------------------------------------------------
+// Function: VLNV::getHash()
+//-----------------------------------------------------------------------------
+size_t VLNV::getHash() const noexcept
+{
+    return hash_;
+}
+
 //-----------------------------------------------------------------------------
 // Function: VLNV::operator<()
 //-----------------------------------------------------------------------------
@@ -321,7 +338,9 @@ bool VLNV::operator>(const VLNV &other) const
 //-----------------------------------------------------------------------------
 bool VLNV::operator==(VLNV const& other) const
 {
-	return vendor_.compare(other.vendor_, Qt::CaseInsensitive) == 0 &&
+	// Different hashes can only come from different fields, which rejects most comparisons quickly.
+	return hash_ == other.hash_ &&
+		vendor_.compare(other.vendor_, Qt::CaseInsensitive) == 0 &&
 		library_.compare(other.library_, Qt::CaseInsensitive) == 0 &&
 		name_.compare(other.name_, Qt::CaseInsensitive) == 0 &&
 		version_.compare(other.version_, Qt::CaseInsensitive) == 0;
@@ -335,6 +354,27 @@ bool VLNV::operator!=(VLNV const& other) const
 	return !operator==(other);
 }
 
+//-----------------------------------------------------------------------------
+// Function: VLNV::updateHash()
+//-----------------------------------------------------------------------------
+void VLNV::updateHash()
+{
+    // Case folding matches the case insensitive comparison in operator==.
+    size_t hash = 0;
+    for (QString const* field : { &vendor_, &library_, &name_, &version_ })
+    {
+        for (QChar const character : *field)
+        {
+            hash = hash * 31 + character.toCaseFolded().unicode();
+        }
+
+        // Separate the fields so that moving characters between them changes the hash.
+        hash = hash * 31 + ':';
+    }
+
+    hash_ = hash;
+}
+
 //-----------------------------------------------------------------------------
 // Function: VLNV::string2Type()
 //-----------------------------------------------------------------------------
@@ -192,6 +192,12 @@ public:
 	*/
 	QString toString(QString const& separator = QLatin1String(":")) const;
 
+	/*! Get the hash of the vlnv fields. The hash is case insensitive like the comparison for equality.
+	 *
+	 *      @return The precomputed hash value.
+	*/
+	size_t getHash() const noexcept;
+
 	//! The assignment operator for the class
 	VLNV &operator=(const VLNV &other) = default;
 
@@ -244,6 +250,9 @@ public:
    
 private:
 
+	//! Computes the hash of the vlnv fields. Must be called whenever a field changes.
+	void updateHash();
+
 	//! The name of the vendor
 	QString vendor_;
 
@@ -258,8 +267,23 @@ private:
 
 	//! The type of the document the VLNV-tag belongs to
 	IPXactType type_ = VLNV::INVALID;
+
+	//! The case insensitive hash of the vlnv fields.
+	size_t hash_ = 0;
 };
 
+/*! Get the hash of a vlnv for the Qt hash containers.
+ *
+ *      @param [in] vlnv    The vlnv to hash.
+ *      @param [in] seed    The seed for the hash.
+ *
+ *      @return The hash value.
+*/
+inline size_t qHash(VLNV const& vlnv, size_t seed = 0) noexcept
+{
+	return vlnv.getHash() ^ seed;
+}
+
 // With this declaration, VLNV can be used as a QVariant.
 Q_DECLARE_METATYPE(VLNV);
 
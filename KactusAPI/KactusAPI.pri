@@ -92,7 +92,11 @@ HEADERS += ./KactusAPI.h \
     ./include/LibraryLoader.h \
     ./include/LibraryTreeModel.h \
     ./include/ParameterCache.h \
-    ./include/NullChannel.h
+    ./include/NullChannel.h \
+    ./include/LibraryIndex.h \
+    ./include/SystemVerilogExpressionLexer.h \
+    ./include/MemoryMapIndex.h \
+    ./include/NameIndex.h
 SOURCES += ./KactusAPI.cpp \
     ./expressions/AddressBlockExpressionsGatherer.cpp \
     ./expressions/AddressSpaceExpressionsGatherer.cpp \
@@ -163,4 +167,7 @@ SOURCES += ./KactusAPI.cpp \
     ./library/LibraryLoader.cpp \
     ./library/LibraryTreeModel.cpp \
     ./library/TagManager.cpp \
-    ./utilities/NullChannel.cpp
+    ./utilities/NullChannel.cpp \
+    ./library/LibraryIndex.cpp \
+    ./expressions/SystemVerilogExpressionLexer.cpp \
+    ./utilities/MemoryMapIndex.cpp
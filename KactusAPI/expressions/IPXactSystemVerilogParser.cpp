@@ -22,6 +22,42 @@ SystemVerilogExpressionParser(), finder_(finder)
 
 }
 
+//-----------------------------------------------------------------------------
+// Function: IPXactSystemVerilogParser::parseExpression()
+//-----------------------------------------------------------------------------
+QString IPXactSystemVerilogParser::parseExpression(QStringView expression, bool* validExpression) const
+{
+    // The parameters cannot change while the expression is parsed, so one round covers all its symbols.
+    if (parseDepth_ == 0)
+    {
+        ++evaluationRound_;
+    }
+
+    ++parseDepth_;
+    QString value = SystemVerilogExpressionParser::parseExpression(expression, validExpression);
+    --parseDepth_;
+
+    return value;
+}
+
+//-----------------------------------------------------------------------------
+// Function: IPXactSystemVerilogParser::parseExpressions()
+//-----------------------------------------------------------------------------
+ExpressionParser::ResultTable IPXactSystemVerilogParser::parseExpressions(QStringList const& expressions) const
+{
+    // The parameters cannot change while the set is parsed, so one round covers all the expressions.
+    if (parseDepth_ == 0)
+    {
+        ++evaluationRound_;
+    }
+
+    ++parseDepth_;
+    ResultTable results = SystemVerilogExpressionParser::parseExpressions(expressions);
+    --parseDepth_;
+
+    return results;
+}
+
 //-----------------------------------------------------------------------------
 // Function: IPXactSystemVerilogParser::isSymbol()
 //-----------------------------------------------------------------------------
@@ -35,27 +71,97 @@ bool IPXactSystemVerilogParser::isSymbol(QStringView expression) const
 //-----------------------------------------------------------------------------
 QString IPXactSystemVerilogParser::findSymbolValue(QStringView expression) const
 {
+    const QString id = expression.toString();
+
+    // The parameters may change between rounds, but not while a value is resolved.
+    if (dependencyStack_.isEmpty())
+    {
+        if (parseDepth_ == 0)
+        {
+            ++evaluationRound_;
+        }
+
+        loopFound_ = false;
+    }
+    else
+    {
+        dependencyStack_.last().append(id);
+    }
+
+    if (isUpToDate(id))
+    {
+        return resolvedValues_.value(id).value;
+    }
+
     // Check for ring references.
     if (symbolStack_.contains(expression))
     {
         symbolStack_.clear();
+        loopFound_ = true;
         return QStringLiteral("x");
     }
 
     symbolStack_.append(expression);
-    QString value = parseExpression(finder_->valueForId(expression));
+    dependencyStack_.append(QStringList());
+
+    const QString valueExpression = finder_->valueForId(expression);
+
+    bool isValid = false;
+    QString value = parseExpression(valueExpression, &isValid);
     if (symbolStack_.isEmpty() == false)
     {
         symbolStack_.removeLast();
     }
 
+    const QStringList dependencies = dependencyStack_.takeLast();
+
+    // Invalid values may depend on symbols that do not exist yet, so only valid values are memoized.
+    if (isValid && loopFound_ == false)
+    {
+        resolvedValues_.insert(id, ResolvedValue{ valueExpression, value, dependencies, evaluationRound_ });
+    }
+
     return value;
 }
 
 //-----------------------------------------------------------------------------
-// Function: IPXactSystemVerilogParser::findSymbolValue()
+// Function: IPXactSystemVerilogParser::getBaseForSymbol()
 //-----------------------------------------------------------------------------
 int IPXactSystemVerilogParser::getBaseForSymbol(QStringView symbol) const
 {
     return baseForExpression(finder_->valueForId(symbol));
 }
+
+//-----------------------------------------------------------------------------
+// Function: IPXactSystemVerilogParser::isUpToDate()
+//-----------------------------------------------------------------------------
+bool IPXactSystemVerilogParser::isUpToDate(QString const& id) const
+{
+    auto resolved = resolvedValues_.find(id);
+    if (resolved == resolvedValues_.end())
+    {
+        return false;
+    }
+
+    if (resolved->checkedRound == evaluationRound_)
+    {
+        return true;
+    }
+
+    // Marked as checked before the dependencies, so that the check always terminates.
+    resolved->checkedRound = evaluationRound_;
+    const QStringList dependencies = resolved->dependencies;
+
+    bool upToDate = finder_->hasId(id) && finder_->valueForId(id) == resolved->expression;
+    for (int i = 0; upToDate && i < dependencies.size(); ++i)
+    {
+        upToDate = isUpToDate(dependencies.at(i));
+    }
+
+    if (upToDate == false)
+    {
+        resolvedValues_.remove(id);
+    }
+
+    return upToDate;
+}
@@ -0,0 +1,470 @@
+//-----------------------------------------------------------------------------
+// File: SystemVerilogExpressionLexer.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 17.10.2026
+//
+// Description:
+// Splits SystemVerilog expressions into tokens.
+//-----------------------------------------------------------------------------
+
+#include "SystemVerilogExpressionLexer.h"
+#include "SystemVerilogSyntax.h"
+
+#include <QRegularExpression>
+#include <QStringBuilder>
+
+#include <algorithm>
+#include <array>
+
+using namespace SystemVerilogExpressionLexer;
+
+namespace
+{
+    const QRegularExpression PRIMARY_LITERAL(SystemVerilogSyntax::REAL_NUMBER % QStringLiteral("|") %
+        SystemVerilogSyntax::INTEGRAL_NUMBER % QStringLiteral("|") %
+        SystemVerilogSyntax::BOOLEAN_VALUE % QStringLiteral("|") %
+        SystemVerilogSyntax::STRING_LITERAL);
+
+    const QRegularExpression ANY_OPERATOR(SystemVerilogSyntax::BINARY_OPERATOR % QStringLiteral("|") %
+        SystemVerilogSyntax::UNARY_OPERATOR % QStringLiteral("|") %
+        SystemVerilogSyntax::TERNARY_OPERATOR);
+
+    const QRegularExpression SEPARATOR(ANY_OPERATOR.pattern() % QStringLiteral("|[(){},]"));
+
+    //! The maximum digit counts of the number formats in SystemVerilogSyntax.
+    const qsizetype MAX_DECIMAL_DIGITS = 20;
+    const qsizetype MAX_HEXADECIMAL_DIGITS = 16;
+    const qsizetype MAX_OCTAL_DIGITS = 22;
+    const qsizetype MAX_BINARY_DIGITS = 64;
+
+    //! The functions used as operators, without the leading $.
+    const std::array<QLatin1String, 7> FUNCTION_OPERATORS = {
+        QLatin1String("pow"), QLatin1String("clog2"), QLatin1String("exp"), QLatin1String("sqrt"),
+        QLatin1String("ipxact_mode_condition"), QLatin1String("ipxact_port_value"),
+        QLatin1String("ipxact_field_value") };
+
+    //! Character classes in the lexer table.
+    enum CharacterClass : quint8
+    {
+        DECIMAL_DIGIT = 0x01,       //!< [0-9]
+        DIGIT_SEPARATOR = 0x02,     //!< _
+        HEXADECIMAL_DIGIT = 0x04,   //!< [0-9a-fA-F]
+        OCTAL_DIGIT = 0x08,         //!< [0-7]
+        BINARY_DIGIT = 0x10,        //!< [01]
+        SEPARATOR_START = 0x20      //!< Characters that always start an operator or a delimiter.
+    };
+
+    //! Creates the character class table for ASCII characters.
+    constexpr std::array<quint8, 128> createCharacterClasses()
+    {
+        std::array<quint8, 128> classes{};
+
+        for (char c = '0'; c <= '9'; ++c)
+        {
+            classes[c] |= DECIMAL_DIGIT | HEXADECIMAL_DIGIT;
+        }
+        for (char c = '0'; c <= '7'; ++c)
+        {
+            classes[c] |= OCTAL_DIGIT;
+        }
+        for (char c = 'a'; c <= 'f'; ++c)
+        {
+            classes[c] |= HEXADECIMAL_DIGIT;
+            classes[c - 'a' + 'A'] |= HEXADECIMAL_DIGIT;
+        }
+
+        classes['0'] |= BINARY_DIGIT;
+        classes['1'] |= BINARY_DIGIT;
+        classes['_'] |= DIGIT_SEPARATOR;
+
+        for (char c : { '/', '%', '^', '+', '-', '<', '>', '&', '|', '*', '~', '?', ':', '(', ')', '{', '}', ',' })
+        {
+            classes[c] |= SEPARATOR_START;
+        }
+
+        return classes;
+    }
+
+    constexpr std::array<quint8, 128> CHARACTER_CLASSES = createCharacterClasses();
+
+    //! Gets the character at the given position, or zero if the position is past the end.
+    inline char16_t characterAt(QStringView expression, qsizetype position) noexcept
+    {
+        return position < expression.size() ? expression.at(position).unicode() : u'\0';
+    }
+
+    //! Checks if the character at the given position belongs to any of the given classes.
+    inline bool isClass(QStringView expression, qsizetype position, quint8 characterClass) noexcept
+    {
+        const char16_t character = characterAt(expression, position);
+        return character < 128 && (CHARACTER_CLASSES[character] & characterClass) != 0;
+    }
+
+    //! Counts the characters of the given classes starting at the given position.
+    qsizetype countClass(QStringView expression, qsizetype position, quint8 characterClass) noexcept
+    {
+        qsizetype count = 0;
+        while (isClass(expression, position + count, characterClass))
+        {
+            ++count;
+        }
+
+        return count;
+    }
+
+    //! Finds the length of the digits of the given class and the digit separators starting at the given position.
+    //! The separators are not counted in the maximum number of digits. Returns zero, if there are no digits.
+    qsizetype digitsLength(QStringView expression, qsizetype position, quint8 digitClass,
+        qsizetype maximumDigits) noexcept
+    {
+        qsizetype length = 0;
+        qsizetype digits = 0;
+        while (true)
+        {
+            if (isClass(expression, position + length, DIGIT_SEPARATOR))
+            {
+                ++length;
+            }
+            else if (digits < maximumDigits && isClass(expression, position + length, digitClass))
+            {
+                ++length;
+                ++digits;
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        return digits == 0 ? 0 : length;
+    }
+
+    //! Checks if the text at the given position begins with the given word, ignoring the case of letters.
+    bool startsWithWord(QStringView expression, qsizetype position, QLatin1String word) noexcept
+    {
+        return expression.mid(position).startsWith(word, Qt::CaseInsensitive);
+    }
+
+    //! Finds the length of a real number (REAL_NUMBER) at the given position, or zero if there is none.
+    qsizetype realNumberLength(QStringView expression, qsizetype position) noexcept
+    {
+        qsizetype end = position;
+        if (characterAt(expression, end) == u'+' || characterAt(expression, end) == u'-')
+        {
+            ++end;
+        }
+
+        const qsizetype integerDigits = countClass(expression, end, DECIMAL_DIGIT | DIGIT_SEPARATOR);
+        end += integerDigits;
+        if (integerDigits == 0 || characterAt(expression, end) != u'.')
+        {
+            return 0;
+        }
+
+        const qsizetype fractionDigits = countClass(expression, end + 1, DECIMAL_DIGIT | DIGIT_SEPARATOR);
+        if (fractionDigits == 0)
+        {
+            return 0;
+        }
+
+        return end + 1 + fractionDigits - position;
+    }
+
+    //! Finds the length of an integral number (INTEGRAL_NUMBER) at the given position, or zero if there is none.
+    qsizetype integralNumberLength(QStringView expression, qsizetype position) noexcept
+    {
+        qsizetype start = position;
+        if (characterAt(expression, start) == u'+' || characterAt(expression, start) == u'-')
+        {
+            ++start;
+        }
+
+        // Sized and based formats: size, apostrophe, optional sign flag and the base.
+        const qsizetype apostrophe = start + countClass(expression, start, DECIMAL_DIGIT);
+        if (characterAt(expression, apostrophe) == u'\'')
+        {
+            qsizetype base = apostrophe + 1;
+            if (characterAt(expression, base) == u's' || characterAt(expression, base) == u'S')
+            {
+                ++base;
+            }
+
+            quint8 digitClass = 0;
+            qsizetype maximumDigits = 0;
+            switch (characterAt(expression, base))
+            {
+            case u'h':
+            case u'H':
+                digitClass = HEXADECIMAL_DIGIT;
+                maximumDigits = MAX_HEXADECIMAL_DIGITS;
+                break;
+            case u'o':
+            case u'O':
+                digitClass = OCTAL_DIGIT;
+                maximumDigits = MAX_OCTAL_DIGITS;
+                break;
+            case u'b':
+            case u'B':
+                digitClass = BINARY_DIGIT;
+                maximumDigits = MAX_BINARY_DIGITS;
+                break;
+            case u'd':
+            case u'D':
+                ++base;
+                break;
+            default:
+                break;
+            }
+
+            // Decimal numbers may also omit the base character.
+            if (digitClass == 0)
+            {
+                digitClass = DECIMAL_DIGIT;
+                maximumDigits = MAX_DECIMAL_DIGITS;
+            }
+            else
+            {
+                ++base;
+            }
+
+            if (const qsizetype digits = digitsLength(expression, base, digitClass, maximumDigits); digits != 0)
+            {
+                return base + digits - position;
+            }
+        }
+
+        // Plain decimal number.
+        if (const qsizetype digits = digitsLength(expression, start, DECIMAL_DIGIT, MAX_DECIMAL_DIGITS);
+            digits != 0)
+        {
+            return start + digits - position;
+        }
+
+        return 0;
+    }
+
+    //! Finds the length of a literal (PRIMARY_LITERAL) at the given position, or zero if there is none.
+    qsizetype literalLength(QStringView expression, qsizetype position) noexcept
+    {
+        // The formats are tried in the order of the alternatives in the regular expression.
+        if (const qsizetype length = realNumberLength(expression, position); length != 0)
+        {
+            return length;
+        }
+
+        if (const qsizetype length = integralNumberLength(expression, position); length != 0)
+        {
+            return length;
+        }
+
+        if (startsWithWord(expression, position, QLatin1String("true")))
+        {
+            return 4;
+        }
+
+        if (startsWithWord(expression, position, QLatin1String("false")))
+        {
+            return 5;
+        }
+
+        if (characterAt(expression, position) == u'"')
+        {
+            if (const qsizetype end = expression.indexOf(u'"', position + 1); end != -1)
+            {
+                return end + 1 - position;
+            }
+        }
+
+        return 0;
+    }
+
+    //! Finds the length of an operator (ANY_OPERATOR) at the given position, or zero if there is none.
+    qsizetype operatorLength(QStringView expression, qsizetype position) noexcept
+    {
+        const char16_t current = characterAt(expression, position);
+        const char16_t next = characterAt(expression, position + 1);
+
+        switch (current)
+        {
+        case u'/':
+        case u'%':
+        case u'^':
+        case u'+':
+        case u'-':
+        case u'~':
+        case u'?':
+        case u':':
+            return 1;
+        case u'<':
+        case u'>':
+            return (next == current || next == u'=') ? 2 : 1;
+        case u'!':
+        case u'=':
+            if (next != u'=')
+            {
+                return 0;
+            }
+            return characterAt(expression, position + 2) == u'=' ? 3 : 2;
+        case u'&':
+        case u'|':
+        case u'*':
+            return (next == u'&' || next == u'|' || next == u'*') ? 2 : 1;
+        case u'$':
+            for (QLatin1String const& function : FUNCTION_OPERATORS)
+            {
+                if (expression.mid(position + 1).startsWith(function))
+                {
+                    return function.size() + 1;
+                }
+            }
+            return 0;
+        default:
+            return 0;
+        }
+    }
+
+    //! Finds the position of the next operator or delimiter (SEPARATOR) from the given position, or -1.
+    qsizetype separatorPosition(QStringView expression, qsizetype position) noexcept
+    {
+        const qsizetype size = expression.size();
+        for (qsizetype index = position; index < size; ++index)
+        {
+            if (isClass(expression, index, SEPARATOR_START) || operatorLength(expression, index) != 0)
+            {
+                return index;
+            }
+        }
+
+        return -1;
+    }
+
+    //! Checks if the expression can be tokenized using the character class table.
+    bool isTableCharacters(QStringView expression) noexcept
+    {
+        return std::all_of(expression.cbegin(), expression.cend(),
+            [](QChar character) { return character.unicode() < 128; });
+    }
+
+    //! Gets the type of a delimiter character.
+    TokenType delimiterType(QChar character) noexcept
+    {
+        switch (character.unicode())
+        {
+        case u'(':
+            return TokenType::OpenParenthesis;
+        case u')':
+            return TokenType::CloseParenthesis;
+        case u'{':
+            return TokenType::OpenArray;
+        case u'}':
+            return TokenType::CloseArray;
+        case u',':
+            return TokenType::Comma;
+        default:
+            return TokenType::Symbol;
+        }
+    }
+
+    /*!
+     *  Splits the expression into tokens using the given matching functions.
+     *
+     *      @param [in] expression          The expression to tokenize.
+     *      @param [in] findLiteral         Finds the length of a literal at a position.
+     *      @param [in] findOperator        Finds the length of an operator at a position.
+     *      @param [in] findSeparator       Finds the position of the next operator or delimiter from a position.
+     *
+     *      @return The tokens in the expression.
+     */
+    template <typename LiteralMatcher, typename OperatorMatcher, typename SeparatorFinder>
+    QVector<Token> split(QStringView expression, LiteralMatcher findLiteral, OperatorMatcher findOperator,
+        SeparatorFinder findSeparator)
+    {
+        QVector<Token> tokens;
+
+        // Literals are only accepted where an operand is expected, e.g. in 2-1 the - is an operator.
+        bool nextMayBeLiteral = true;
+
+        const auto SIZE = expression.size();
+        for (qsizetype index = 0; index < SIZE; /*index incremented inside loop*/)
+        {
+            const QChar current = expression.at(index);
+            if (current.isSpace())
+            {
+                ++index;
+                continue;
+            }
+
+            qsizetype length = 0;
+            if (nextMayBeLiteral && (length = findLiteral(expression, index)) != 0)
+            {
+                tokens.append(Token{ TokenType::Literal, expression.mid(index, length) });
+                nextMayBeLiteral = false;
+            }
+            else if ((length = findOperator(expression, index)) != 0)
+            {
+                tokens.append(Token{ TokenType::Operator, expression.mid(index, length) });
+                nextMayBeLiteral = true;
+            }
+            else if (const TokenType type = delimiterType(current); type != TokenType::Symbol)
+            {
+                tokens.append(Token{ type, expression.mid(index, 1) });
+                length = 1;
+                nextMayBeLiteral = (type != TokenType::CloseParenthesis && type != TokenType::CloseArray);
+            }
+            else
+            {
+                const qsizetype end = findSeparator(expression, index);
+                length = (end == -1 ? SIZE : end) - index;
+
+                tokens.append(Token{ TokenType::Symbol, expression.mid(index, length).trimmed() });
+                nextMayBeLiteral = false;
+            }
+
+            index += length;
+        }
+
+        return tokens;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: SystemVerilogExpressionLexer::tokenize()
+//-----------------------------------------------------------------------------
+QVector<Token> SystemVerilogExpressionLexer::tokenize(QStringView expression)
+{
+    // Case-insensitive matching of booleans may match non-ASCII letters, leave those to the regular expressions.
+    if (isTableCharacters(expression) == false)
+    {
+        return tokenizeWithRegularExpressions(expression);
+    }
+
+    return split(expression, literalLength, operatorLength, separatorPosition);
+}
+
+//-----------------------------------------------------------------------------
+// Function: SystemVerilogExpressionLexer::tokenizeWithRegularExpressions()
+//-----------------------------------------------------------------------------
+QVector<Token> SystemVerilogExpressionLexer::tokenizeWithRegularExpressions(QStringView expression)
+{
+    auto matchLength = [](QRegularExpression const& pattern, QStringView text, qsizetype position)
+    {
+        return pattern.match(text, position, QRegularExpression::NormalMatch,
+            QRegularExpression::AnchorAtOffsetMatchOption).capturedLength();
+    };
+
+    return split(expression,
+        [&matchLength](QStringView text, qsizetype position)
+        {
+            return matchLength(PRIMARY_LITERAL, text, position);
+        },
+        [&matchLength](QStringView text, qsizetype position)
+        {
+            return matchLength(ANY_OPERATOR, text, position);
+        },
+        [](QStringView text, qsizetype position)
+        {
+            return SEPARATOR.match(text, position).capturedStart();
+        });
+}
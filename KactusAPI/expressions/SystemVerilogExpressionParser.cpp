@@ -10,6 +10,7 @@
 //-----------------------------------------------------------------------------
 
 #include "SystemVerilogExpressionParser.h"
+#include "SystemVerilogExpressionLexer.h"
 #include "SystemVerilogSyntax.h"
 
 #include <QRegularExpression>
@@ -18,26 +19,21 @@
 #include <QStringList>
 #include <QVector>
 
+#include <QtNumeric>
+
 #include <qmath.h>
 
 #include <algorithm>
+#include <limits>
 
 namespace
 {
-    const QRegularExpression PRIMARY_LITERAL(SystemVerilogSyntax::REAL_NUMBER % QStringLiteral("|") %
-        SystemVerilogSyntax::INTEGRAL_NUMBER % QStringLiteral("|") %
-        SystemVerilogSyntax::BOOLEAN_VALUE % QStringLiteral("|") %
-        SystemVerilogSyntax::STRING_LITERAL);
-
-    const QRegularExpression BINARY_OPERATOR(QStringLiteral("[/%^+-]|<<|>>|<=?|>=?|!==?|===?|[&|*]{1,2}|[$]pow"));
+    const QRegularExpression BINARY_OPERATOR(SystemVerilogSyntax::BINARY_OPERATOR);
 
-    const QRegularExpression UNARY_OPERATOR(QStringLiteral(
-        "[$]clog2|[$]exp|[$]sqrt|[$]ipxact_mode_condition|[$]ipxact_port_value|[$]ipxact_field_value|~"));
+    const QRegularExpression UNARY_OPERATOR(SystemVerilogSyntax::UNARY_OPERATOR);
 
-    const QRegularExpression TERNARY_OPERATOR(QStringLiteral("[?:]"));
+    const QRegularExpression TERNARY_OPERATOR(SystemVerilogSyntax::TERNARY_OPERATOR);
 
-    const QLatin1Char OPEN_PARENTHESIS('(');
-    const QLatin1Char CLOSE_PARENTHESIS(')');
     const QLatin1Char OPEN_ARRAY('{');
     const QLatin1Char CLOSE_ARRAY('}');
 
@@ -48,15 +44,13 @@ namespace
     const QString TERNARY_QUESTION_STRING(QStringLiteral("?"));
     const QString TERNARY_COLON_STRING(QStringLiteral(":"));
 
-    const QRegularExpression ANY_OPERATOR(
-        BINARY_OPERATOR.pattern() % QStringLiteral("|") %
-        UNARY_OPERATOR.pattern() % QStringLiteral("|") %
-        TERNARY_OPERATOR.pattern());
-
     const QRegularExpression LITERAL_EXPRESSION(QStringLiteral("^\\s*(") % SystemVerilogSyntax::INTEGRAL_NUMBER%
         QStringLiteral("|") % SystemVerilogSyntax::REAL_NUMBER% QStringLiteral(")\\s*$"));
 
     const QRegularExpression BASE_FORMAT(QStringLiteral("'[sS]?([dDbBoOhH]?)"));
+
+    //! The maximum number of compiled expressions kept in the cache.
+    const int COMPILED_EXPRESSION_CACHE_SIZE = 4096;
 }
 
 //-----------------------------------------------------------------------------
@@ -64,7 +58,7 @@ namespace
 //-----------------------------------------------------------------------------
 QString SystemVerilogExpressionParser::parseExpression(QStringView expression, bool* validExpression) const
 {
-    return solveRPN(convertToRPN(expression), validExpression);
+    return solveRPN(compiledExpression(expression), validExpression);
 }
 
 //-----------------------------------------------------------------------------
@@ -90,21 +84,119 @@ int SystemVerilogExpressionParser::baseForExpression(QStringView expression) con
 {
     int greatestBase = 0;
 
-    for (auto const& token : convertToRPN(expression))
+    for (auto const& token : compiledExpression(expression).tokens)
     {
-        if (isLiteral(token))
+        if (isLiteral(token.text))
         {
-            greatestBase = qMax(greatestBase, baseOf(token));
+            greatestBase = qMax(greatestBase, baseOf(token.text));
         }
-        else if (isSymbol(token))
+        else if (isSymbol(token.text))
         {
-            greatestBase = qMax(greatestBase, getBaseForSymbol(token));
+            greatestBase = qMax(greatestBase, getBaseForSymbol(token.text));
         }
     }
 
     return greatestBase;
 }
 
+//-----------------------------------------------------------------------------
+// Function: SystemVerilogExpressionParser::compiledExpression()
+//-----------------------------------------------------------------------------
+SystemVerilogExpressionParser::CompiledExpression SystemVerilogExpressionParser::compiledExpression(
+    QStringView expression) const
+{
+    // Returned as a copy, since evaluating symbols may add expressions to the cache.
+    const QString key = expression.toString();
+    if (auto cached = compiledExpressions_.constFind(key); cached != compiledExpressions_.cend())
+    {
+        return cached.value();
+    }
+
+    if (compiledExpressions_.size() >= COMPILED_EXPRESSION_CACHE_SIZE)
+    {
+        compiledExpressions_.clear();
+    }
+
+    CompiledExpression compiled = compile(expression);
+    compiledExpressions_.insert(key, compiled);
+    return compiled;
+}
+
+//-----------------------------------------------------------------------------
+// Function: SystemVerilogExpressionParser::compile()
+//-----------------------------------------------------------------------------
+SystemVerilogExpressionParser::CompiledExpression SystemVerilogExpressionParser::compile(
+    QStringView expression) const
+{
+    CompiledExpression compiled;
+    QHash<QStringView, int> operandSlots;
+
+    const QVector<QStringView> rpn = convertToRPN(expression);
+    compiled.tokens.reserve(rpn.size());
+
+    // The classification order must match the evaluation order in solveRPN().
+    for (auto const& token : rpn)
+    {
+        CompiledToken compiledToken;
+        compiledToken.text = token.toString();
+
+        if (isUnaryOperator(token))
+        {
+            compiledToken.kind = CompiledToken::Kind::UnaryOperator;
+        }
+        else if (isBinaryOperator(token))
+        {
+            compiledToken.kind = CompiledToken::Kind::BinaryOperator;
+        }
+        else if (isTernaryOperator(token))
+        {
+            compiledToken.kind = token.compare(TERNARY_COLON_STRING) == 0 ?
+                CompiledToken::Kind::TernaryColon : CompiledToken::Kind::TernaryQuestion;
+        }
+        else if (token.compare(OPEN_ARRAY_STRING) == 0)
+        {
+            compiledToken.kind = CompiledToken::Kind::OpenArray;
+        }
+        else if (token.compare(CLOSE_ARRAY_STRING) == 0)
+        {
+            compiledToken.kind = CompiledToken::Kind::CloseArray;
+        }
+        else if (token.compare(QLatin1String("true"), Qt::CaseInsensitive) == 0)
+        {
+            compiledToken.value = StackValue{ true, 1, QString() };
+        }
+        else if (token.compare(QLatin1String("false"), Qt::CaseInsensitive) == 0)
+        {
+            compiledToken.value = StackValue{ true, 0, QString() };
+        }
+        else if (isStringLiteral(token))
+        {
+            compiledToken.value.text = compiledToken.text;
+        }
+        else if (isLiteral(token))
+        {
+            // Numbers cannot be symbols, so they can be solved once.
+            compiledToken.value = toStackValue(parseConstant(token));
+        }
+        else
+        {
+            // Symbols can be added or removed between evaluations, so they are checked when evaluating.
+            compiledToken.kind = CompiledToken::Kind::Operand;
+            compiledToken.value = toStackValue(parseConstant(token));
+            compiledToken.slot = operandSlots.value(token, compiled.slotCount);
+            if (compiledToken.slot == compiled.slotCount)
+            {
+                operandSlots.insert(token, compiled.slotCount);
+                ++compiled.slotCount;
+            }
+        }
+
+        compiled.tokens.append(compiledToken);
+    }
+
+    return compiled;
+}
+
 //-----------------------------------------------------------------------------
 // Function: SystemVerilogExpressionParser::convertToRPN()
 //-----------------------------------------------------------------------------
@@ -115,32 +207,17 @@ QVector<QStringView> SystemVerilogExpressionParser::convertToRPN(QStringView exp
     QVector<QStringView> stack;
 
     int openParenthesis = 0;
-    bool nextMayBeLiteral = true;
 
-    const auto SIZE = expression.size();
-    for (qsizetype index = 0; index < SIZE; /*index incremented inside loop*/)
+    using SystemVerilogExpressionLexer::TokenType;
+    for (SystemVerilogExpressionLexer::Token const& token : SystemVerilogExpressionLexer::tokenize(expression))
     {
-        const QChar current = expression.at(index);
-        if (current.isSpace())
+        if (token.type == TokenType::Literal || token.type == TokenType::Symbol)
         {
-            ++index;
-            continue;
-        }
-
-        if (QRegularExpressionMatch literalMatch = PRIMARY_LITERAL.match(expression, index,
-            QRegularExpression::NormalMatch, QRegularExpression::AnchorAtOffsetMatchOption);
-            nextMayBeLiteral && literalMatch.hasMatch())
-        {
-            output.append(literalMatch.capturedView());
-
-            index += literalMatch.capturedLength();
-            nextMayBeLiteral = false;
+            output.append(token.text);
         }
-        else if (QRegularExpressionMatch operatorMatch = ANY_OPERATOR.match(expression, index,
-                 QRegularExpression::NormalMatch, QRegularExpression::AnchorAtOffsetMatchOption); 
-            operatorMatch.hasMatch())
+        else if (token.type == TokenType::Operator)
         {
-            const auto operation = operatorMatch.capturedView();
+            const auto operation = token.text;
             while (stack.isEmpty() == false &&
                 stack.last() != OPEN_PARENTHESIS_STRING &&
                 stack.last() != TERNARY_QUESTION_STRING &&
@@ -150,18 +227,13 @@ QVector<QStringView> SystemVerilogExpressionParser::convertToRPN(QStringView exp
             }
 
             stack.append(operation);
-
-            index += operation.length();
-            nextMayBeLiteral = true;
         }
-        else if (current == OPEN_PARENTHESIS)
+        else if (token.type == TokenType::OpenParenthesis)
         {
             stack.append(OPEN_PARENTHESIS_STRING);
-            ++index;
             ++openParenthesis;
-            nextMayBeLiteral = true;
         }
-        else if (current == CLOSE_PARENTHESIS)
+        else if (token.type == TokenType::CloseParenthesis)
         {
             while (stack.isEmpty() == false && (stack.last() != OPEN_PARENTHESIS_STRING))
             {
@@ -173,18 +245,14 @@ QVector<QStringView> SystemVerilogExpressionParser::convertToRPN(QStringView exp
                 stack.removeLast(); //!< Remove open parenthesis.
             }
 
-            ++index;
             --openParenthesis;
-            nextMayBeLiteral = false;
         }
-        else if (current == OPEN_ARRAY)
+        else if (token.type == TokenType::OpenArray)
         {
             output.append(OPEN_ARRAY_STRING);
-            ++index;
             ++openParenthesis;
-            nextMayBeLiteral = true;
         }
-        else if (current == CLOSE_ARRAY)
+        else if (token.type == TokenType::CloseArray)
         {
             while (stack.isEmpty() == false && stack.last() != OPEN_ARRAY_STRING)
             {
@@ -197,30 +265,15 @@ QVector<QStringView> SystemVerilogExpressionParser::convertToRPN(QStringView exp
             }
             stack.append(CLOSE_ARRAY_STRING); //!< Add close array.
 
-            ++index;
             --openParenthesis;
-            nextMayBeLiteral = false;
         }
-        else if (current == QLatin1Char(','))
+        else if (token.type == TokenType::Comma)
         {
             while (stack.isEmpty() == false &&
                 (stack.last() != OPEN_ARRAY_STRING && stack.last() != OPEN_PARENTHESIS_STRING))
             {
                 output.append(stack.takeLast());
             }
-
-            ++index;
-            nextMayBeLiteral = true;
-        }
-        else
-        {
-            static const QRegularExpression separator(ANY_OPERATOR.pattern() % QStringLiteral("|[(){},]"));
-            const auto unknown = expression.mid(index, separator.match(expression, index).capturedStart() - index);
-
-            output.append(unknown.trimmed());
-
-            index += unknown.length();
-            nextMayBeLiteral = false;
         }
     }
 
@@ -241,15 +294,22 @@ QVector<QStringView> SystemVerilogExpressionParser::convertToRPN(QStringView exp
 //-----------------------------------------------------------------------------
 // Function: SystemVerilogExpressionParser::solveRPN()
 //-----------------------------------------------------------------------------
-QString SystemVerilogExpressionParser::solveRPN(QVector<QStringView> rpn, bool* validExpression) const
+QString SystemVerilogExpressionParser::solveRPN(CompiledExpression const& rpn, bool* validExpression) const
 {
-    QStringList result;
+    QVector<StackValue> result;
+    result.reserve(rpn.tokens.size());
+
     bool isWellFormed = true;
     int ternaryCount = 0;
 
-    for (auto const& token : rpn)
+    // Each distinct symbol is looked up only once per evaluation.
+    enum class SlotState { Unresolved, Symbol, Constant };
+    QVector<SlotState> slotStates(rpn.slotCount, SlotState::Unresolved);
+    QVector<StackValue> slotValues(rpn.slotCount);
+
+    for (auto const& token : rpn.tokens)
     {
-        if (isUnaryOperator(token))
+        if (token.kind == CompiledToken::Kind::UnaryOperator)
         {
             if (result.isEmpty())
             {
@@ -257,10 +317,10 @@ QString SystemVerilogExpressionParser::solveRPN(QVector<QStringView> rpn, bool*
             }
             else
             {
-                result.append(solveUnary(token, result.takeLast()));
+                result.append(toStackValue(solveUnary(token.text, toText(result.takeLast()))));
             }
         }
-        else if (isBinaryOperator(token))
+        else if (token.kind == CompiledToken::Kind::BinaryOperator)
         {
             if (result.size() < 2)
             {
@@ -268,39 +328,45 @@ QString SystemVerilogExpressionParser::solveRPN(QVector<QStringView> rpn, bool*
             }
             else
             {
-                result.append(solveBinary(token, result.takeLast(), result.takeLast()));
+                const StackValue rightTerm = result.takeLast();
+                const StackValue leftTerm = result.takeLast();
+                result.append(solveBinary(token.text, leftTerm, rightTerm));
             }
         }
-        else if (isTernaryOperator(token))
+        else if (token.kind == CompiledToken::Kind::TernaryColon)
         {
-            if (token.compare(TERNARY_COLON_STRING) == 0)
-            {
-                ++ternaryCount;
+            ++ternaryCount;
 
-                if (result.size() < 3)
-                {
-                    isWellFormed = false;
-                }
-                else
-                {
-                    result.append(solveTernary(result.takeLast(), result.takeLast(), result.takeLast()));
-                }
+            if (result.size() < 3)
+            {
+                isWellFormed = false;
             }
             else
             {
-                --ternaryCount;
+                const StackValue falseCase = result.takeLast();
+                const StackValue trueCase = result.takeLast();
+                const StackValue condition = result.takeLast();
+
+                const bool conditionHolds = condition.isInteger ? condition.integer != 0 :
+                    condition.text.toDouble() != 0;
+                result.append(conditionHolds ? trueCase : falseCase);
             }
         }
-        else if (token.compare(OPEN_ARRAY_STRING) == 0)
+        else if (token.kind == CompiledToken::Kind::TernaryQuestion)
         {
-            result.append(token.toString());
+            --ternaryCount;
         }
-        else if (token.compare(CLOSE_ARRAY_STRING) == 0)
+        else if (token.kind == CompiledToken::Kind::OpenArray)
+        {
+            result.append(StackValue{ false, 0, token.text });
+        }
+        else if (token.kind == CompiledToken::Kind::CloseArray)
         {
             QStringList items;
-            while (result.isEmpty() == false && result.last().compare(OPEN_ARRAY_STRING) != 0)
+            while (result.isEmpty() == false &&
+                (result.last().isInteger || result.last().text.compare(OPEN_ARRAY_STRING) != 0))
             {
-                items.prepend(result.takeLast());
+                items.prepend(toText(result.takeLast()));
             }
 
             if (result.isEmpty())
@@ -309,50 +375,411 @@ QString SystemVerilogExpressionParser::solveRPN(QVector<QStringView> rpn, bool*
             }
             else
             {
-                QString arrayItem(result.takeLast() % items.join(QLatin1Char(',')) % token);
-                result.append(arrayItem);
+                QString arrayItem(result.takeLast().text % items.join(QLatin1Char(',')) % token.text);
+                result.append(StackValue{ false, 0, arrayItem });
             }
         }
-        else if (token.compare(QLatin1String("true"), Qt::CaseInsensitive) == 0)
+        else
+        {
+            SlotState state = SlotState::Constant;
+            if (token.kind == CompiledToken::Kind::Operand)
+            {
+                if (slotStates.at(token.slot) == SlotState::Unresolved)
+                {
+                    const bool symbol = isSymbol(token.text);
+                    slotStates[token.slot] = symbol ? SlotState::Symbol : SlotState::Constant;
+                    slotValues[token.slot] = symbol ? toStackValue(findSymbolValue(token.text)) : token.value;
+                }
+
+                state = slotStates.at(token.slot);
+            }
+
+            StackValue const& value = token.kind == CompiledToken::Kind::Operand ? slotValues.at(token.slot) :
+                token.value;
+
+            if (state == SlotState::Constant && value.isInteger == false && value.text == QLatin1String("x"))
+            {
+                isWellFormed = false;
+            }
+
+            result.append(value);
+        }
+
+        if (isWellFormed == false)
         {
-            result.append(QStringLiteral("1"));
+            break;
         }
-        else if (token.compare(QLatin1String("false"), Qt::CaseInsensitive) == 0)
+    }
+
+    QString resultText;
+    bool hasUnknownValue = false;
+    for (auto const& value : result)
+    {
+        if (value.isInteger == false && value.text == QLatin1String("x"))
         {
-            result.append(QStringLiteral("0"));
+            hasUnknownValue = true;
         }
-        else if (isStringLiteral(token))
+
+        resultText.append(toText(value));
+    }
+
+    if (validExpression != nullptr)
+    {
+        *validExpression = (isWellFormed && hasUnknownValue == false && ternaryCount == 0);
+    }
+
+    return resultText;
+}
+
+//-----------------------------------------------------------------------------
+// Function: SystemVerilogExpressionParser::toStackValue()
+//-----------------------------------------------------------------------------
+SystemVerilogExpressionParser::StackValue SystemVerilogExpressionParser::toStackValue(QString const& text)
+{
+    StackValue value;
+
+    // Only plain decimal integers are converted, other formats are kept exactly as they were.
+    const auto length = text.size();
+    const qsizetype firstDigit = text.startsWith(QLatin1Char('-')) ? 1 : 0;
+
+    bool isDecimal = length > firstDigit;
+    for (qsizetype i = firstDigit; isDecimal && i < length; ++i)
+    {
+        isDecimal = text.at(i) >= QLatin1Char('0') && text.at(i) <= QLatin1Char('9');
+    }
+
+    if (isDecimal)
+    {
+        value.integer = text.toLongLong(&value.isInteger);
+    }
+
+    if (isDecimal && value.isInteger == false && firstDigit == 0)
+    {
+        bool isUnsigned = false;
+        if (const quint64 unsignedValue = text.toULongLong(&isUnsigned); isUnsigned)
+        {
+            return toStackValue(unsignedValue);
+        }
+    }
+
+    if (value.isInteger == false)
+    {
+        value.text = text;
+    }
+
+    return value;
+}
+
+//-----------------------------------------------------------------------------
+// Function: SystemVerilogExpressionParser::toStackValue()
+//-----------------------------------------------------------------------------
+SystemVerilogExpressionParser::StackValue SystemVerilogExpressionParser::toStackValue(quint64 value) noexcept
+{
+    StackValue result;
+    result.isInteger = true;
+    result.integer = static_cast<qint64>(value);
+    result.isUnsigned = value > static_cast<quint64>(std::numeric_limits<qint64>::max());
+    return result;
+}
+
+//-----------------------------------------------------------------------------
+// Function: SystemVerilogExpressionParser::toText()
+//-----------------------------------------------------------------------------
+QString SystemVerilogExpressionParser::toText(StackValue const& value)
+{
+    if (value.isInteger && value.isUnsigned)
+    {
+        return QString::number(static_cast<quint64>(value.integer));
+    }
+
+    if (value.isInteger)
+    {
+        return QString::number(value.integer);
+    }
+
+    return value.text;
+}
+
+//-----------------------------------------------------------------------------
+// Function: SystemVerilogExpressionParser::solveBinary()
+//-----------------------------------------------------------------------------
+SystemVerilogExpressionParser::StackValue SystemVerilogExpressionParser::solveBinary(QStringView operation,
+    StackValue const& leftTerm, StackValue const& rightTerm) const
+{
+    if (leftTerm.isInteger && rightTerm.isInteger)
+    {
+        StackValue result;
+        if (leftTerm.isUnsigned == false && rightTerm.isUnsigned == false &&
+            solveIntegerBinary(operation, leftTerm.integer, rightTerm.integer, result))
         {
-            result.append(token.toString());
+            return result;
         }
-        else if (isSymbol(token))
+
+        if ((leftTerm.isUnsigned || leftTerm.integer >= 0) && (rightTerm.isUnsigned || rightTerm.integer >= 0) &&
+            solveUnsignedBinary(operation, static_cast<quint64>(leftTerm.integer),
+                static_cast<quint64>(rightTerm.integer), result))
         {
-            result.append(findSymbolValue(token));
+            return result;
+        }
+    }
+
+    return toStackValue(solveBinary(operation, toText(leftTerm), toText(rightTerm)));
+}
+
+//-----------------------------------------------------------------------------
+// Function: SystemVerilogExpressionParser::solveIntegerBinary()
+//-----------------------------------------------------------------------------
+bool SystemVerilogExpressionParser::solveIntegerBinary(QStringView operation, qint64 left, qint64 right,
+    StackValue& result)
+{
+    result.isInteger = true;
+    qint64& value = result.integer;
+
+    // Overflowing operations are left for the text solver, which solves them as real numbers.
+    if (operation.compare(QLatin1String("+")) == 0)
+    {
+        return qAddOverflow(left, right, &value) == false;
+    }
+    else if (operation.compare(QLatin1String("-")) == 0)
+    {
+        return qSubOverflow(left, right, &value) == false;
+    }
+    else if (operation.compare(QLatin1String("*")) == 0)
+    {
+        return qMulOverflow(left, right, &value) == false;
+    }
+    else if (operation.compare(QLatin1String("/")) == 0 || operation.compare(QLatin1String("%")) == 0)
+    {
+        if (right == 0 || (left == std::numeric_limits<qint64>::min() && right == -1))
+        {
+            return false;
+        }
+
+        value = operation.compare(QLatin1String("/")) == 0 ? left / right : left % right;
+    }
+    else if (operation.compare(QLatin1String("**")) == 0 || operation.compare(QLatin1String("$pow")) == 0)
+    {
+        // Negative exponents produce fractions, which are solved as real numbers.
+        if (right < 0)
+        {
+            return false;
+        }
+
+        value = 1;
+        for (qint64 base = left, exponent = right; exponent > 0; exponent >>= 1)
+        {
+            if ((exponent & 1) && qMulOverflow(value, base, &value))
+            {
+                return false;
+            }
+
+            if (exponent > 1 && qMulOverflow(base, base, &base))
+            {
+                return false;
+            }
+        }
+    }
+    else if (operation.compare(QLatin1String("<<")) == 0 || operation.compare(QLatin1String(">>")) == 0)
+    {
+        if (right < 0 || right > 63)
+        {
+            return false;
+        }
+
+        if (operation.compare(QLatin1String(">>")) == 0)
+        {
+            value = left >> right;
         }
         else
         {
-            const auto constant = parseConstant(token);
+            // Shifted out bits are left for the unsigned solver or the text solver.
+            value = static_cast<qint64>(static_cast<quint64>(left) << right);
+            if ((value >> right) != left)
+            {
+                return false;
+            }
+        }
+    }
+    else if (operation.compare(QLatin1String(">")) == 0)
+    {
+        value = left > right;
+    }
+    else if (operation.compare(QLatin1String("<")) == 0)
+    {
+        value = left < right;
+    }
+    else if (operation.compare(QLatin1String("==")) == 0)
+    {
+        value = left == right;
+    }
+    else if (operation.compare(QLatin1String(">=")) == 0)
+    {
+        value = left >= right;
+    }
+    else if (operation.compare(QLatin1String("<=")) == 0)
+    {
+        value = left <= right;
+    }
+    else if (operation.compare(QLatin1String("!=")) == 0)
+    {
+        value = left != right;
+    }
+    else if (operation.compare(QLatin1String("||")) == 0)
+    {
+        value = left || right;
+    }
+    else if (operation.compare(QLatin1String("&&")) == 0)
+    {
+        value = left && right;
+    }
+    else if (operation.compare(QLatin1String("|")) == 0)
+    {
+        value = left | right;
+    }
+    else if (operation.compare(QLatin1String("^")) == 0)
+    {
+        value = left ^ right;
+    }
+    else if (operation.compare(QLatin1String("&")) == 0)
+    {
+        value = left & right;
+    }
+    else
+    {
+        return false;
+    }
 
-            if (constant == QLatin1String("x"))
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: SystemVerilogExpressionParser::solveUnsignedBinary()
+//-----------------------------------------------------------------------------
+bool SystemVerilogExpressionParser::solveUnsignedBinary(QStringView operation, quint64 left, quint64 right,
+    StackValue& result)
+{
+    quint64 value = 0;
+
+    // Overflowing operations are left for the text solver, which solves them as real numbers.
+    if (operation.compare(QLatin1String("+")) == 0)
+    {
+        if (qAddOverflow(left, right, &value))
+        {
+            return false;
+        }
+    }
+    else if (operation.compare(QLatin1String("-")) == 0)
+    {
+        if (left < right)
+        {
+            // Negative results are exact down to the smallest signed value.
+            if (right - left > static_cast<quint64>(std::numeric_limits<qint64>::max()) + 1)
             {
-                isWellFormed = false;
+                return false;
             }
 
-            result.append(constant);
+            result = StackValue{ true, static_cast<qint64>(left - right), QString() };
+            return true;
         }
 
-        if (isWellFormed == false)
+        value = left - right;
+    }
+    else if (operation.compare(QLatin1String("*")) == 0)
+    {
+        if (qMulOverflow(left, right, &value))
         {
-            break;
+            return false;
+        }
+    }
+    else if (operation.compare(QLatin1String("/")) == 0 || operation.compare(QLatin1String("%")) == 0)
+    {
+        if (right == 0)
+        {
+            return false;
         }
+
+        value = operation.compare(QLatin1String("/")) == 0 ? left / right : left % right;
     }
+    else if (operation.compare(QLatin1String("**")) == 0 || operation.compare(QLatin1String("$pow")) == 0)
+    {
+        value = 1;
+        for (quint64 base = left, exponent = right; exponent > 0; exponent >>= 1)
+        {
+            if ((exponent & 1) && qMulOverflow(value, base, &value))
+            {
+                return false;
+            }
 
-    if (validExpression != nullptr)
+            if (exponent > 1 && qMulOverflow(base, base, &base))
+            {
+                return false;
+            }
+        }
+    }
+    else if (operation.compare(QLatin1String("<<")) == 0 || operation.compare(QLatin1String(">>")) == 0)
+    {
+        if (right > 63)
+        {
+            return false;
+        }
+
+        value = operation.compare(QLatin1String("<<")) == 0 ? left << right : left >> right;
+        if (operation.compare(QLatin1String("<<")) == 0 && (value >> right) != left)
+        {
+            return false;
+        }
+    }
+    else if (operation.compare(QLatin1String(">")) == 0)
+    {
+        value = left > right;
+    }
+    else if (operation.compare(QLatin1String("<")) == 0)
+    {
+        value = left < right;
+    }
+    else if (operation.compare(QLatin1String("==")) == 0)
+    {
+        value = left == right;
+    }
+    else if (operation.compare(QLatin1String(">=")) == 0)
+    {
+        value = left >= right;
+    }
+    else if (operation.compare(QLatin1String("<=")) == 0)
+    {
+        value = left <= right;
+    }
+    else if (operation.compare(QLatin1String("!=")) == 0)
+    {
+        value = left != right;
+    }
+    else if (operation.compare(QLatin1String("||")) == 0)
+    {
+        value = left || right;
+    }
+    else if (operation.compare(QLatin1String("&&")) == 0)
+    {
+        value = left && right;
+    }
+    else if (operation.compare(QLatin1String("|")) == 0)
+    {
+        value = left | right;
+    }
+    else if (operation.compare(QLatin1String("^")) == 0)
+    {
+        value = left ^ right;
+    }
+    else if (operation.compare(QLatin1String("&")) == 0)
     {
-        *validExpression = (isWellFormed && result.contains(QLatin1String("x")) == false && ternaryCount == 0);
+        value = left & right;
+    }
+    else
+    {
+        return false;
     }
 
-    return result.join(QString());
+    result = toStackValue(value);
+    return true;
 }
 
 //-----------------------------------------------------------------------------
@@ -397,22 +824,6 @@ bool SystemVerilogExpressionParser::isTernaryOperator(QStringView token) const
     return TERNARY_OPERATOR.match(token).hasMatch();
 }
 
-//-----------------------------------------------------------------------------
-// Function: SystemVerilogExpressionParser::solveTernary()
-//-----------------------------------------------------------------------------
-QString SystemVerilogExpressionParser::solveTernary(QStringView condition,
-    QString const& trueCase, QString const& falseCase) const
-{
-    if (condition.toDouble() != 0)
-    {
-        return trueCase;
-    }
-    else
-    {
-        return falseCase;
-    }
-}
-
 //-----------------------------------------------------------------------------
 // Function: SystemVerilogExpressionParser::solveBinary()
 //-----------------------------------------------------------------------------
@@ -587,6 +998,14 @@ QString SystemVerilogExpressionParser::solveUnary(QStringView operation, QString
     }
     else if (operation.compare(QLatin1String("~")) == 0)
     {
+        // Values of 2^63 and above are complemented as unsigned numbers.
+        bool isUnsigned = false;
+        if (const qulonglong value = term.toULongLong(&isUnsigned);
+            isUnsigned && value > static_cast<qulonglong>(std::numeric_limits<qlonglong>::max()))
+        {
+            return QString::number(~value);
+        }
+
         return QString::number(~term.toLongLong());
     }
 
@@ -643,18 +1062,25 @@ QString SystemVerilogExpressionParser::parseConstant(QStringView token) const
 
     // Remove formating of the number.
     auto formattedToken = token.toString();
-    static QRegularExpression prefix(QStringLiteral("^([1-9][0-9_]*)?'[sS]?[dDbBoOhH]?"));
+    static const QRegularExpression prefix(QStringLiteral("^([1-9][0-9_]*)?'[sS]?[dDbBoOhH]?"));
     formattedToken.remove(0, prefix.match(token).capturedLength());
     formattedToken.remove(QLatin1Char('_'));
 
     bool valid = false;
     const qlonglong value = formattedToken.toLongLong(&valid, base);
-    if (valid == false)
+    if (valid)
+    {
+        return QString::number(value);
+    }
+
+    // Values of 2^63 and above are valid unsigned numbers.
+    const qulonglong unsignedValue = formattedToken.toULongLong(&valid, base);
+    if (valid == false || formattedToken.startsWith(QLatin1Char('-')))
     {
         return QStringLiteral("x");
     }
 
-    return QString::number(value);
+    return QString::number(unsignedValue);
 }
 
 //-----------------------------------------------------------------------------
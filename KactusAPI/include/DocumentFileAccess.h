@@ -26,8 +26,15 @@ class MessageMediator;
 //-----------------------------------------------------------------------------
 namespace DocumentFileAccess 
 {
+    //! The ways to read a document from a file.
+    enum class ReadMode
+    {
+        Dom,        //!< Read the whole file into a DOM tree before creating the model.
+        Streaming   //!< Create the large element lists directly while reading the file, if supported for the type.
+    };
+
     //! Reads the document from given path.
-    KACTUS2_API QSharedPointer<Document> readDocument(QString const& path);
+    KACTUS2_API QSharedPointer<Document> readDocument(QString const& path, ReadMode mode = ReadMode::Dom);
 
     //! Writes to document model to the given path.
     KACTUS2_API bool writeDocument(QSharedPointer<Document> model, QString const& path);
@@ -38,6 +38,12 @@ class Design;
 class DesignConfiguration;
 class LibraryInterface;
 
+//-----------------------------------------------------------------------------
+//! Validator for all IP-XACT document types.
+//
+// The validator keeps per-document state in its parameter finders and must not be shared between threads.
+// Distinct documents can be validated concurrently using a separate validator instance in each thread.
+//-----------------------------------------------------------------------------
 class DocumentValidator 
 {
 public:
@@ -12,7 +12,9 @@
 #ifndef EXPRESSIONPARSER_H
 #define EXPRESSIONPARSER_H
 
+#include <QHash>
 #include <QString>
+#include <QStringList>
 #include <QPair>
 
 //-----------------------------------------------------------------------------
@@ -22,6 +24,16 @@ class ExpressionParser
 {
 public:
 
+    //! The result of an evaluated expression.
+    struct Result
+    {
+        QString value;          //!< The evaluated value.
+        bool valid = false;     //!< Flag for a successful evaluation.
+    };
+
+    //! The evaluated expressions with the expression as key.
+    using ResultTable = QHash<QString, Result>;
+
 	//! The destructor.
     virtual ~ExpressionParser() = default;
 
@@ -35,6 +47,30 @@ public:
      */
     virtual QString parseExpression(QStringView expression, bool* validExpression = nullptr) const = 0;
 
+    /*!
+     *  Parses a set of expressions at once. Each distinct expression is evaluated only once.
+     *
+     *      @param [in] expressions     The expressions to parse, e.g. all the expressions of a memory map.
+     *
+     *      @return The results of the evaluated expressions with the expression as key.
+     */
+    virtual ResultTable parseExpressions(QStringList const& expressions) const
+    {
+        ResultTable results;
+        results.reserve(expressions.size());
+
+        for (QString const& expression : expressions)
+        {
+            if (results.contains(expression) == false)
+            {
+                Result& result = results[expression];
+                result.value = parseExpression(expression, &result.valid);
+            }
+        }
+
+        return results;
+    }
+
     /*!
      *  Checks if the given expression is a plain value and does not need evaluation.
      *
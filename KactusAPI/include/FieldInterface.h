@@ -16,6 +16,7 @@
 
 #include <ParameterizableInterface.h>
 #include <NameGroupInterface.h>
+#include <NameIndex.h>
 
 #include <IPXACTmodels/generaldeclarations.h>
 #include <IPXACTmodels/common/AccessTypes.h>
@@ -183,6 +184,38 @@ public:
      */
     bool setWidth(std::string const& fieldName, std::string const& newWidth);
 
+    /*!
+     *  Get the calculated bit offsets of all the fields.
+     *
+     *      @param [in] baseNumber  Base for displaying the values.
+     *
+     *      @return The bit offsets in the order of getItemNames().
+     */
+    std::vector<std::string> getOffsetValues(int const& baseNumber = 0) const;
+
+    /*!
+     *  Get the calculated bit widths of all the fields.
+     *
+     *      @param [in] baseNumber  Base for displaying the values.
+     *
+     *      @return The bit widths in the order of getItemNames().
+     */
+    std::vector<std::string> getWidthValues(int const& baseNumber = 0) const;
+
+    /*!
+     *  Set the values of a batch of fields. Each value column is either empty to keep the current values, or
+     *  has a value for each field. The changed fields are validated once after all the changes.
+     *
+     *      @param [in] fieldNames  Names of the fields.
+     *      @param [in] offsets     New bit offsets of the fields.
+     *      @param [in] widths      New bit widths of the fields.
+     *
+     *      @return Names of the fields that were not found or are not valid after the changes. If the size of a
+     *              column does not match the fields, nothing is changed and all the given names are returned.
+     */
+    std::vector<std::string> setFieldValues(std::vector<std::string> const& fieldNames,
+        std::vector<std::string> const& offsets, std::vector<std::string> const& widths);
+
     /*!
      *  Get the reset values of the selected field.
      *
@@ -961,6 +994,9 @@ private:
     //! List of the contained fields.
     QSharedPointer<QList<QSharedPointer<Field> > > fields_;
 
+    //! Positions of the contained fields by name.
+    NameIndex nameIndex_;
+
     //! Validator for fields.
     QSharedPointer<FieldValidator> validator_;
 
@@ -16,14 +16,24 @@
 
 #include "KactusAPI/KactusAPIGlobal.h"
 
+#include <QHash>
 #include <QSharedPointer>
 #include <QString>
+#include <QStringList>
 #include <QVector>
 
 class ParameterFinder;
 
 //-----------------------------------------------------------------------------
 // Parser for SystemVerilog expressions with parameter references.
+//
+// The parser tracks the symbols under evaluation and must not be shared between threads.
+//
+// Resolved parameter values are memoized together with the expression they were solved from and the
+// parameters referenced in it. A memoized value is used only if none of the expressions in its dependency
+// graph have changed since, so changes in the parameters are always taken into account. The parameters are
+// checked for changes once per evaluation round, which covers one call of parseExpression() or
+// parseExpressions() including all the symbols referenced in the parsed expressions.
 //-----------------------------------------------------------------------------
 class KACTUS2_API IPXactSystemVerilogParser : public SystemVerilogExpressionParser
 {
@@ -43,6 +53,27 @@ public:
     IPXactSystemVerilogParser(IPXactSystemVerilogParser const& rhs) = delete;
     IPXactSystemVerilogParser& operator=(IPXactSystemVerilogParser const& rhs) = delete;
 
+    /*!
+     *  Parses an expression to decimal number. The memoized parameter values are checked only once for the
+     *  whole expression.
+     *
+     *      @param [in]  expression         The expression to parse.
+     *      @param [out] validExpression    Set to true, if the parsing was successful, otherwise false.
+     *
+     *      @return The decimal value of the evaluated expression.
+     */
+    QString parseExpression(QStringView expression, bool* validExpression = nullptr) const override;
+
+    /*!
+     *  Parses a set of expressions at once. Each distinct expression is evaluated only once and the memoized
+     *  parameter values are checked only once for the whole set.
+     *
+     *      @param [in] expressions     The expressions to parse.
+     *
+     *      @return The results of the evaluated expressions with the expression as key.
+     */
+    ResultTable parseExpressions(QStringList const& expressions) const override;
+
     /*!
      *  Checks if the given expression is a symbol e.g. reference.
      *
@@ -72,6 +103,24 @@ public:
 
 private:
 
+    //! A memoized value of a parameter.
+    struct ResolvedValue
+    {
+        QString expression;         //!< The value expression of the parameter when resolved.
+        QString value;              //!< The resolved value.
+        QStringList dependencies;   //!< The ids of the parameters referenced in the expression.
+        quint64 checkedRound = 0;   //!< The evaluation round in which the value was last found up to date.
+    };
+
+    /*!
+     *  Checks if the memoized value of a parameter is up to date. Outdated values are removed.
+     *
+     *      @param [in] id  The id of the parameter to check.
+     *
+     *      @return True, if the parameter has an up-to-date memoized value, otherwise false.
+     */
+    bool isUpToDate(QString const& id) const;
+
     //-----------------------------------------------------------------------------
     // Data.
     //-----------------------------------------------------------------------------
@@ -81,6 +130,22 @@ private:
 
     //! Stack for tracking already evaluated symbols to check for loops in references.
     mutable QVector<QStringView> symbolStack_;
+
+    //! The referenced parameter ids for each parameter currently being resolved.
+    mutable QVector<QStringList> dependencyStack_;
+
+    //! The memoized parameter values with parameter id as key.
+    mutable QHash<QString, ResolvedValue> resolvedValues_;
+
+    //! The current evaluation round. A round starts each time an expression or a symbol is parsed outside
+    //! other expressions.
+    mutable quint64 evaluationRound_ = 0;
+
+    //! Flag for a reference loop found in the current round. Values are not memoized after a loop.
+    mutable bool loopFound_ = false;
+
+    //! The depth of the expressions being parsed. Zero when called from outside the parser.
+    mutable int parseDepth_ = 0;
 };
 
 #endif // IPXACTSYSTEMVERILOGPARSER_H
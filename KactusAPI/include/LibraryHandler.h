@@ -33,6 +33,10 @@
 #include <QString>
 #include <QStringList>
 #include <QList>
+#include <QFutureWatcher>
+#include <QHash>
+#include <QMap>
+#include <QMutex>
 #include <QSharedPointer>
 #include <QObject>
 
@@ -57,11 +61,57 @@ public:
     //! No assignment
     LibraryHandler& operator=(const LibraryHandler& other) = delete;
 
+    //! The available modes for validating the documents after a library search.
+    enum class ValidationMode
+    {
+        Immediate,  //!< All documents are validated before the search completes.
+        Background, //!< Documents are validated in small batches in the event loop after the search.
+        Parallel    //!< All documents are validated concurrently in the global thread pool.
+    };
+
+    //! Counters for the use of the parsed documents in the library cache.
+    struct CacheStatistics
+    {
+        qint64 hitCount = 0;        //!< The number of requests served with an already parsed document.
+        qint64 missCount = 0;       //!< The number of requests that required reading the document file.
+        qint64 evictionCount = 0;   //!< The number of parsed documents released to stay within the limit.
+        qint64 residentSize = 0;    //!< The estimated memory used by the parsed documents in bytes.
+    };
+
     //! The destructor
     ~LibraryHandler() final = default;
 
     void setOutputChannel(MessageMediator* messageChannel);
 
+    /*! Set the memory limit for the parsed documents kept in the library cache.
+     *  The least recently used documents are released when the limit is exceeded and read again on demand.
+     *  The paths and validity of the documents are always kept.
+     *
+     *      @param [in] limitInBytes    The limit for the estimated memory use. Zero or less disables the limit.
+     */
+    void setCacheLimit(qint64 limitInBytes);
+
+    /*! Get the usage counters of the library cache.
+     *
+     *      @return The cache statistics.
+     */
+    CacheStatistics getCacheStatistics() const;
+
+    //! Shows the usage counters of the library cache in the message channel.
+    void showCacheStatistics() const;
+
+    /*! Set the mode for validating the documents after a library search.
+     *
+     *      @param [in] mode    The validation mode to use.
+     */
+    void setValidationMode(ValidationMode mode);
+
+    /*! Check if the background validation of the library is in progress.
+     *
+     *      @return True, if documents are waiting for background validation, otherwise false.
+     */
+    bool isValidationInProgress() const;
+
     /*! Get a model that matches given VLNV.
      *
      * This function can be called to get a model that matches an IP-Xact document.
@@ -242,6 +292,9 @@ public:
     QSharedPointer<Design> getDesign(VLNV const& hierarchyRef) final;
 
     /*! Check if the identified object is in valid state.
+     *
+     * If the object has not been validated yet, it is validated on demand, also while the background
+     * validation is in progress.
      *
      *      @param [in] vlnv Identifies the object to check.
      *
@@ -272,6 +325,12 @@ public slots:
     */
     void onCheckLibraryIntegrity() final;
 
+    /*! Cancel the ongoing parallel library validation.
+     *
+     * Documents not validated before the cancellation are validated on demand.
+     */
+    void cancelValidation();
+
     /*! Edit an item in the library
      *
      *      @param [in] vlnv Reference to the vlnv that identifies the object to edit.
@@ -398,7 +457,23 @@ signals:
     //! Inform both models that the content must be reset.
     void resetModel();
 
+    //! Inform that the background or parallel validation of the library has been completed.
+    void validationFinished();
+
+    /*! Inform the progress of the parallel library validation.
+     *
+     *      @param [in] checkedCount    The number of documents validated so far.
+     *      @param [in] totalCount      The total number of documents to validate.
+     */
+    void validationProgress(int checkedCount, int totalCount);
+
 private slots:
+
+    //! Validates the next batch of documents waiting for background validation.
+    void onValidateNextDocuments();
+
+    //! Stores the results of the parallel validation once all the tasks have finished or been cancelled.
+    void onParallelValidationFinished();
     
     /*! This function should be called every time an object is written to disk.
     * 
@@ -419,11 +494,17 @@ private:
         QSharedPointer<Document> document;  //<! The model for the document.
         QString path;                       //<! The path to the file containing the document.
         bool isValid;                       //<! Flag for well-formed content.
+        bool isValidated;                   //<! Flag for validity checked after loading.
+        qint64 estimatedSize = 0;           //<! The estimated memory use of the parsed model in bytes.
+        quint64 lastAccess = 0;             //<! The key of the parsed model in the access order, larger is more recent.
+        QList<VLNV> dependentVLNVs;         //<! The VLNVs referenced in the document, if known.
+        bool dependenciesKnown = false;     //<! Flag for referenced VLNVs known without reading the document.
 
         //! Constructor.
         explicit DocumentInfo(QString const& filePath = QString(), 
             QSharedPointer<Document> doc = QSharedPointer<Document>(),
-            bool valid = false): document(doc), path(filePath), isValid(valid) {}
+            bool valid = false, bool validated = true): 
+            document(doc), path(filePath), isValid(valid), isValidated(validated) {}
     };
 
     //! Struct for collecting document statistics e.g. in export.
@@ -433,6 +514,26 @@ private:
         int documentCount = 0;
     };
 
+    //! A single document to validate in the parallel validation.
+    struct ValidationTask
+    {
+        VLNV vlnv;                          //<! The VLNV of the document.
+        QString path;                       //<! The path to the file containing the document.
+        QSharedPointer<Document> document;  //<! The already parsed model, if any.
+    };
+
+    //! The outcome of validating a single document in the parallel validation.
+    struct ValidationResult
+    {
+        VLNV vlnv;                          //<! The VLNV of the document.
+        QString path;                       //<! The path to the validated file.
+        bool isValid = false;               //<! Flag for well-formed content.
+        int fileCount = 0;                  //<! The number of valid file references in the document.
+        QVector<TagData> tags;              //<! The tags in the document.
+        QList<VLNV> dependentVLNVs;         //<! The VLNVs referenced in the document.
+        bool isRead = false;                //<! Flag for the document model read successfully.
+    };
+
     //-----------------------------------------------------------------------------
     // The private functions used by public class methods
     //-----------------------------------------------------------------------------
@@ -457,6 +558,52 @@ private:
     //! Clears the library cache of documents.
     void clearCache();
 
+    /*! Gets the parsed model of a document in the cache, reading it from the disk if needed.
+     *  The cache mutex must not be held by the caller. It is released while the file is read.
+     *
+     *      @param [in] vlnv    The VLNV of the document.
+     *
+     *      @return The parsed model or null, if the document is not in the library or could not be read.
+     */
+    QSharedPointer<Document> getCachedDocument(VLNV const& vlnv);
+
+    /*! Sets the parsed model of a document in the cache and updates the memory accounting.
+     *  The cache mutex must be held by the caller.
+     *
+     *      @param [in] vlnv        The VLNV of the document.
+     *      @param [in] info        The cached document.
+     *      @param [in] document    The parsed model to keep in the cache.
+     */
+    void cacheDocument(VLNV const& vlnv, DocumentInfo& info, QSharedPointer<Document> document);
+
+    /*! Marks a parsed model as the most recently used one. The cache mutex must be held by the caller.
+     *
+     *      @param [in] vlnv    The VLNV of the document.
+     *      @param [in] info    The cached document.
+     */
+    void touchDocument(VLNV const& vlnv, DocumentInfo& info);
+
+    /*! Stores the VLNVs referenced in a document to the cache and to the library index.
+     *
+     *      @param [in] info            The cached document.
+     *      @param [in] dependentVLNVs  The VLNVs referenced in the document.
+     */
+    void storeDependentVLNVs(DocumentInfo& info, QList<VLNV> const& dependentVLNVs);
+
+    /*! Gets the VLNVs referenced in a document. The document is only read, if the references are not known
+     *  from the library index or an earlier read. The cache mutex must not be held by the caller.
+     *
+     *      @param [in] vlnv    The VLNV of the document.
+     *
+     *      @return The VLNVs referenced in the document.
+     */
+    QList<VLNV> getDependentVLNVs(VLNV const& vlnv);
+
+    /*! Releases the least recently used parsed models until the cache is within its memory limit.
+     *  The most recently used model is always kept. The cache mutex must be held by the caller.
+     */
+    void evictDocuments();
+
     //! Loads all available VLNVs into the library cache.
     void loadAvailableVLNVs();
 
@@ -466,6 +613,44 @@ private:
     //! Shows the results of the library integrity check.
     void showIntegrityResults() const;
 
+    //! Queues all the documents in the library for background validation.
+    void startBackgroundValidation();
+
+    //! Starts validating all the documents in the library using the global thread pool.
+    //! The results are stored in onParallelValidationFinished().
+    void checkIntegrityInParallel();
+
+    //! Cancels the ongoing parallel validation and waits for it to stop. The results of it are discarded.
+    void stopParallelValidation();
+
+    /*!
+     *  Validates a single document. Called concurrently from the thread pool.
+     *
+     *      @param [in] task    The document to validate.
+     *
+     *      @return The validation outcome.
+     */
+    ValidationResult validateInWorker(ValidationTask const& task);
+
+    /*!
+     *  Validates a document in the library cache and updates the check statistics.
+     *
+     *  If the document model is read only for the validation, it is released afterwards.
+     *
+     *      @param [in] info    The cached document to validate.
+     *      @param [out] tags   The tags of the document are appended here.
+     */
+    void validateCachedDocument(DocumentInfo& info, QVector<TagData>& tags);
+
+    /*!
+     *  Stores the validation outcome of a document into the library cache.
+     *  The outcome is discarded, if the document has been removed or replaced during the validation.
+     *
+     *      @param [in] vlnv    The VLNV of the validated document.
+     *      @param [in] info    The validated copy of the cached document.
+     */
+    void storeValidationResult(VLNV const& vlnv, DocumentInfo const& info);
+
     /*!
      * Removes the given file from the file system.
      *
@@ -524,11 +709,13 @@ private:
 
     /*! Check the validity of file references within a document.
      *
-     *      @param [in] document    The document to check.
+     *      @param [in] document        The document to check.
+     *      @param [in] documentPath    The path to the document XML file.
+     *      @param [in/out] fileCount   The count of valid file references, increased for each valid file.
      *
      *      @return True if the file references are valid, otherwise false.
      */
-    bool validateDependentFiles(QSharedPointer<Document> document, QString const& documentPath);
+    bool validateDependentFiles(QSharedPointer<Document> document, QString const& documentPath, int& fileCount);
 
     /*!
      *  Finds any errors within a given document file references.
@@ -556,10 +743,29 @@ private:
 
     /*! Cache of documents in the library.
      *
-     * Key = VLNV that identifies the library object.
+     * Key = VLNV that identifies the library object, hashed and compared case insensitively.
      * Value = Information on the document.
      */
-    QMap<VLNV, DocumentInfo> documentCache_;
+    QHash<VLNV, DocumentInfo> documentCache_;
+
+    //! Guards the document cache against concurrent access from the validation threads.
+    mutable QMutex cacheMutex_;
+
+    //! The limit for the estimated memory use of the parsed documents in bytes, zero for no limit.
+    qint64 cacheLimit_{ 0 };
+
+    //! The usage counters of the document cache.
+    CacheStatistics cacheStatistics_;
+
+    //! Counter for ordering the accesses to the parsed documents.
+    quint64 accessCounter_{ 0 };
+
+    /*! The parsed documents in the order of their last access, the least recently used first.
+     *
+     * Key = The last access of the document.
+     * Value = VLNV that identifies the document in the cache.
+     */
+    QMap<quint64, VLNV> accessOrder_;
 
     //! Checks if the given string is a URL (invalids are allowed) or not.
     QRegularExpressionValidator urlTester_{ Utils::URL_VALIDITY_REG_EXP, this };
@@ -579,6 +785,21 @@ private:
     //! Statistics for library integrity check.
     DocumentStatistics checkResults_;
 
+    //! The mode for validating the documents after a library search.
+    ValidationMode validationMode_{ ValidationMode::Immediate };
+
+    //! The documents waiting for background validation.
+    QVector<VLNV> validationQueue_;
+
+    //! The tags collected in the background validation.
+    QVector<TagData> validatedTags_;
+
+    //! Watcher for the ongoing parallel validation.
+    QFutureWatcher<ValidationResult> validationWatcher_;
+
+    //! Flag for the results of the current parallel validation not yet stored in the cache.
+    bool parallelResultsPending_{ false };
+
 };
 
 #endif // LIBRARYHANDLER_H
@@ -0,0 +1,128 @@
+//-----------------------------------------------------------------------------
+// File: LibraryIndex.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 17.10.2026
+//
+// Description:
+// Persistent index of the IP-XACT files found in the library.
+//-----------------------------------------------------------------------------
+
+#ifndef LIBRARYINDEX_H
+#define LIBRARYINDEX_H
+
+#include <IPXACTmodels/common/VLNV.h>
+
+#include <QDateTime>
+#include <QFileInfo>
+#include <QHash>
+#include <QList>
+#include <QString>
+#include <QStringList>
+
+//-----------------------------------------------------------------------------
+//! Persistent index of the IP-XACT files found in the library.
+//
+// The index stores the identifier of each scanned file together with the file size and modification time,
+// so that unchanged files do not have to be read again on the next library scan.
+//-----------------------------------------------------------------------------
+class LibraryIndex
+{
+public:
+
+    //! Indexed data of a single file.
+    struct Entry
+    {
+        QString path;                   //!< The path to the file.
+        qint64 size = -1;               //!< The file size at the time of indexing.
+        qint64 lastModified = -1;       //!< The modification time in ms since epoch at the time of indexing.
+        VLNV vlnv;                      //!< The VLNV and document type in the file, invalid if none.
+        QList<VLNV> dependentVLNVs;     //!< The VLNVs referenced in the document, if known.
+        bool dependenciesKnown = false; //!< Flag for referenced VLNVs stored after reading the document.
+    };
+
+    /*! The constructor.
+     *
+     *      @param [in] indexPath   Path to the index file. If empty, the default location is used.
+     */
+    explicit LibraryIndex(QString const& indexPath = QString());
+
+    //! The destructor.
+    ~LibraryIndex() = default;
+
+    /*! Reads the index from the disk, replacing any current content.
+     *
+     *      @return True, if the index was read, otherwise false.
+     */
+    bool load();
+
+    /*! Writes the index to the disk, if it has been changed after loading or saving.
+     *
+     *      @return True, if the index is up to date on the disk, otherwise false.
+     */
+    bool save();
+
+    /*! Finds an entry for the given file, if the file has not changed since indexing.
+     *
+     *      @param [in] fileInfo    The current state of the file.
+     *
+     *      @return The up-to-date entry or nullptr, if the file has not been indexed or it has changed.
+     */
+    Entry const* findUpToDate(QFileInfo const& fileInfo) const;
+
+    /*! Adds or replaces the entry for the given file.
+     *
+     *      @param [in] fileInfo    The state of the file at the time of reading.
+     *      @param [in] vlnv        The VLNV found in the file.
+     */
+    void insert(QFileInfo const& fileInfo, VLNV const& vlnv);
+
+    /*! Sets the referenced VLNVs of an indexed file.
+     *
+     *      @param [in] path            The path to the file.
+     *      @param [in] dependentVLNVs  The VLNVs referenced in the file.
+     */
+    void setDependentVLNVs(QString const& path, QList<VLNV> const& dependentVLNVs);
+
+    /*! Removes all entries for files not in the given list.
+     *
+     *      @param [in] paths   The paths to keep in the index.
+     */
+    void retain(QStringList const& paths);
+
+    //! Removes all entries.
+    void clear();
+
+    /*! Gets the number of entries in the index.
+     *
+     *      @return The entry count.
+     */
+    int size() const;
+
+    /*! Gets the default location of the index file next to the settings file.
+     *
+     *      @return The default index file path.
+     */
+    static QString defaultIndexPath();
+
+private:
+
+    //! Gets the modification time of the given file in the stored format.
+    static qint64 modificationTime(QFileInfo const& fileInfo);
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! Path to the index file.
+    QString indexPath_;
+
+    //! The index entries with file path as key.
+    QHash<QString, Entry> entries_;
+
+    //! Flag for content not yet written to disk.
+    bool modified_ = false;
+};
+
+#endif // LIBRARYINDEX_H
@@ -30,7 +30,9 @@ class LibraryInterface
 public:
 
     /*! Get a model that matches given VLNV. Must be used when changes are made to the document.
-     *  The provided document is a copy, meaning that it must be explicitly saved after the changes.
+     *  The provided document is a deep copy, meaning that it must be explicitly saved after the changes.
+     *  Copying large documents is expensive, so callers that only read the document should use
+     *  getModelReadOnly() instead.
      * 
      *      @param [in] vlnv    Identifies the desired document.
      *
@@ -51,7 +53,8 @@ public:
     }
 
     /*! Get a model that matches given VLNV for read-only access. May be used when no changes are to be made
-     *  for the document.
+     *  for the document. The provided document is shared with the library and all other readers without
+     *  copying. It is replaced, not modified, when the document is saved, so the snapshot stays unchanged.
      * 
      *      @param [in] vlnv    Identifies the desired document.
      *
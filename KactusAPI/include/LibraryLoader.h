@@ -13,6 +13,7 @@
 #define LIBRARYLOADER_H
 
 #include "DocumentFileAccess.h"
+#include "LibraryIndex.h"
 
 #include <KactusAPI/include/MessageMediator.h>
 
@@ -32,12 +33,21 @@ public:
     {
         QString path; //!< The path to IP-XACT file.
         VLNV vlnv;    //!< The VLNV defined in the file.
+        QList<VLNV> dependentVLNVs; //!< The VLNVs referenced in the file, if known from the library index.
+        bool dependenciesKnown = false; //!< Flag for referenced VLNVs found in the library index.
 
 		//! Constructor.
         LoadTarget(VLNV const& targetVLNV = VLNV(), QString targetPath = QString()): 
             path(targetPath), vlnv(targetVLNV) {}
     };
 
+    //! The available modes for scanning the library files.
+    enum class ScanMode
+    {
+        Sequential, //!< Files are read one at a time in the calling thread.
+        Parallel    //!< Files are read concurrently using the global thread pool.
+    };
+
 	/*! Cleans the directory structure.
 	*
 	*      @param [in] changedDirectories	Changed directories (e.g. after a remove).
@@ -46,19 +56,53 @@ public:
 
 	/*! Searches for IP-XACT files and returns any found targets.
 	*
+	*  The targets are always returned in the order the files are found in the library locations,
+	*  regardless of the scan mode. Files that have not changed since the previous scan are not read,
+	*  but their targets are taken from the library index.
+	*
+	*      @param [in] messageChannel  The channel for reporting errors and notifications.
+	*      @param [in] mode            The mode for reading the found files.
+	*
 	*      @return The found IP-XACT targets.
 	*/
-    QVector<LoadTarget> parseLibrary(MessageMediator const* messageChannel) const;
+    QVector<LoadTarget> parseLibrary(MessageMediator const* messageChannel, 
+        ScanMode mode = ScanMode::Parallel);
+
+	/*! Stores the VLNVs referenced in a library file to the library index.
+	*
+	*      @param [in] path            The path to the file.
+	*      @param [in] dependentVLNVs  The VLNVs referenced in the file.
+	*/
+    void setDependentVLNVs(QString const& path, QList<VLNV> const& dependentVLNVs);
+
+	//! Writes any changes in the library index to the disk.
+    void saveIndex();
 
 private:
 
+    //! The result of reading the identifier from a single file.
+    struct ScanResult
+    {
+        VLNV vlnv;              //!< The VLNV found in the file.
+        QString error;          //!< Error found while reading the file, if any.
+        QString notification;   //!< Notification on the file content, if any.
+    };
+
+    /*! Finds all the IP-XACT candidate files in the active library locations.
+    *
+    *      @return The candidate files in the order of discovery.
+    */
+    QFileInfoList findLibraryFiles() const;
+
     /*! Finds the VLNV in the given file.
     *
+    *  The function does not report anything directly and can be called from any thread.
+    *
     *      @param [in]		path	The file path to search.
     *
-    *      @return The VLNV found in the given file.
+    *      @return The VLNV found in the given file and any messages to report.
     */
-    VLNV getDocumentVLNV(QString const& path, MessageMediator const* messageChannel) const;
+    ScanResult getDocumentVLNV(QString const& path) const;
 
     /*! Clear the empty directories from the disk within given path.
      *
@@ -75,6 +119,16 @@ private:
      *
     */
     bool containsPath(QString const& path, QStringList const& pathsToSearch) const;
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The persistent index of previously scanned files.
+    LibraryIndex index_;
+
+    //! Flag for index read from the disk.
+    bool indexLoaded_ = false;
 };
 
 Q_DECLARE_TYPEINFO(LibraryLoader::LoadTarget, Q_MOVABLE_TYPE);
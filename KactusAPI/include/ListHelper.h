@@ -50,6 +50,13 @@ namespace ListHelper
 
         return std::distance(container->cbegin(), pos);
     }
+
+    //! Checks that a column of values for a batch of items is either empty or has a value for each item.
+    template <typename T>
+    bool columnFitsBatch(std::vector<T> const& column, std::size_t itemCount)
+    {
+        return column.empty() || column.size() == itemCount;
+    }
 };
 
 #endif // LIST_HELPER_H 
\ No newline at end of file
@@ -16,6 +16,7 @@
 
 #include <ParameterizableInterface.h>
 #include <NameGroupInterface.h>
+#include <NameIndex.h>
 
 #include <QVector>
 #include <QMap>
@@ -313,7 +314,7 @@ public:
 protected:
 
     /*!
-     *  Get the available memory blocks.
+     *  Get the available memory blocks for editing.
      *
      *      @return List of available memory blocks.
      */
@@ -426,6 +427,9 @@ private:
     //! List of the contained memory blocks.
     QSharedPointer<QList<QSharedPointer<MemoryBlockBase> > > blockData_{ nullptr };
 
+    //! Positions of the contained memory blocks by name.
+    NameIndex nameIndex_;
+
     //! The address unit bits of the containing memory map.
     QString addressUnitBits_;
 
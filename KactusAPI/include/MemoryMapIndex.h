@@ -0,0 +1,246 @@
+//-----------------------------------------------------------------------------
+// File: MemoryMapIndex.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 17.10.2026
+//
+// Description:
+// Address index over the resolved registers and fields of the memory maps in a component.
+//-----------------------------------------------------------------------------
+
+#ifndef MEMORYMAPINDEX_H
+#define MEMORYMAPINDEX_H
+
+#include <KactusAPI/KactusAPIGlobal.h>
+
+#include <QHash>
+#include <QSharedPointer>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+class Component;
+class ExpressionParser;
+class MemoryArray;
+class MemoryMap;
+class MemoryMapBase;
+class Register;
+class RegisterBase;
+
+//-----------------------------------------------------------------------------
+//! Address index over the resolved registers and fields of the memory maps in a component.
+//
+// All the expressions are evaluated once when the index is built. The registers and fields are stored in an
+// interval tree keyed on their address range within the memory map, so that an address query takes
+// logarithmic time in the number of indexed items. Register and register file arrays are indexed element by
+// element up to a limit on the total number of elements, and the items left out are reported. The index does
+// not follow changes in the component, it must be rebuilt after them.
+//-----------------------------------------------------------------------------
+class KACTUS2_API MemoryMapIndex
+{
+public:
+
+    //! A register or a field located in a memory map.
+    struct Entry
+    {
+        QString memoryMapName;      //!< The name of the containing memory map.
+        QString addressBlockName;   //!< The name of the containing address block.
+        QString registerName;       //!< The register path with register files separated by dots.
+        QString fieldName;          //!< The name of the field, or empty for a register.
+        quint64 firstAddress = 0;   //!< The first address unit covered by the item.
+        quint64 lastAddress = 0;    //!< The last address unit covered by the item.
+        quint64 bitOffset = 0;      //!< The offset of a field within its register in bits.
+        quint64 bitWidth = 0;       //!< The width of the item in bits.
+
+        //! Checks if the entry is a field.
+        bool isField() const { return fieldName.isEmpty() == false; }
+    };
+
+    //! The default limit for the number of array elements, registers and fields expanded in a build.
+    static constexpr quint64 DEFAULT_ELEMENT_LIMIT = 1000000;
+
+    /*!
+     *  The constructor.
+     *
+     *      @param [in] expressionParser    The parser for the expressions in the memory maps.
+     *      @param [in] elementLimit        The maximum number of elements expanded in a build.
+     */
+    explicit MemoryMapIndex(QSharedPointer<ExpressionParser> expressionParser,
+        quint64 elementLimit = DEFAULT_ELEMENT_LIMIT);
+
+    //! The destructor.
+    ~MemoryMapIndex() = default;
+
+    // Disable copying.
+    MemoryMapIndex(MemoryMapIndex const& rhs) = delete;
+    MemoryMapIndex& operator=(MemoryMapIndex const& rhs) = delete;
+
+    /*!
+     *  Builds the index for the memory maps of a component.
+     *
+     *      @param [in] component   The component whose memory maps to index.
+     *      @param [in] remapState  The remap state or mode to index. The memory maps with a remap for the state
+     *                              are indexed with the blocks of the remap, others with their default blocks.
+     */
+    void build(QSharedPointer<Component> component, QString const& remapState = QString());
+
+    //! Removes all the items from the index.
+    void clear();
+
+    /*!
+     *  Gets the number of the indexed registers and fields.
+     *
+     *      @return The number of items in the index.
+     */
+    int size() const;
+
+    /*!
+     *  Gets the items which were not completely indexed, because the element limit was reached in the build.
+     *
+     *      @return The paths of the items in the form map.block.register[.field].
+     */
+    QStringList getTruncatedItems() const;
+
+    /*!
+     *  Finds the registers and fields covering an address.
+     *
+     *      @param [in] address         The address to find.
+     *      @param [in] memoryMapName   The memory map to search in. If empty, all memory maps are searched.
+     *
+     *      @return The items covering the address ordered by their first address.
+     */
+    QVector<Entry> findAt(quint64 address, QString const& memoryMapName = QString()) const;
+
+    /*!
+     *  Finds the registers and fields overlapping an address range.
+     *
+     *      @param [in] firstAddress    The first address of the range.
+     *      @param [in] lastAddress     The last address of the range.
+     *      @param [in] memoryMapName   The memory map to search in. If empty, all memory maps are searched.
+     *
+     *      @return The items overlapping the range ordered by their first address.
+     */
+    QVector<Entry> findInRange(quint64 firstAddress, quint64 lastAddress,
+        QString const& memoryMapName = QString()) const;
+
+private:
+
+    /*!
+     *  Adds the registers of the given memory blocks to the index.
+     *
+     *      @param [in] memoryMap       The memory map of the blocks.
+     *      @param [in] blockContainer  The memory map or remap containing the blocks.
+     */
+    void addMemoryBlocks(QSharedPointer<MemoryMap> memoryMap, QSharedPointer<MemoryMapBase> blockContainer);
+
+    /*!
+     *  Adds the registers and register files to the index.
+     *
+     *      @param [in] registerData    The registers and register files to add.
+     *      @param [in] baseAddress     The address the register offsets are relative to.
+     *      @param [in] namePrefix      The path of the containing register file, or empty.
+     *      @param [in] entry           The entry with the memory map and address block set.
+     */
+    void addRegisterData(QSharedPointer<QList<QSharedPointer<RegisterBase> > > registerData,
+        quint64 baseAddress, QString const& namePrefix, Entry const& entry);
+
+    /*!
+     *  Adds a register and its fields to the index.
+     *
+     *      @param [in] targetRegister  The register to add.
+     *      @param [in] address         The address of the register.
+     *      @param [in] entry           The entry with the memory map, address block and register name set.
+     */
+    void addRegister(QSharedPointer<Register> targetRegister, quint64 address, Entry entry);
+
+    /*!
+     *  Gets the array dimension sizes of an item.
+     *
+     *      @param [in] memoryArray     The array definition of the item, or null.
+     *      @param [in] dimension       The dimension of the item in IP-XACT 1685-2014, or empty.
+     *
+     *      @return The sizes of the dimensions, the slowest changing in address order first. Empty if not an array.
+     */
+    QVector<quint64> getDimensionSizes(QSharedPointer<MemoryArray> memoryArray, QString const& dimension);
+
+    /*!
+     *  Reserves an element from the element limit.
+     *
+     *      @param [in] itemPath    The path of the item the element belongs to.
+     *
+     *      @return True, if the element can be indexed, false if the limit has been reached.
+     */
+    bool reserveElement(QString const& itemPath);
+
+    /*!
+     *  Gets the value of an expression.
+     *
+     *      @param [in] expression  The expression to evaluate.
+     *
+     *      @return The value of the expression, or 0 if it cannot be evaluated.
+     */
+    quint64 valueOf(QString const& expression);
+
+    /*!
+     *  Checks if an item is present.
+     *
+     *      @param [in] isPresent   The presence expression of the item.
+     *
+     *      @return True, if the item is present, otherwise false.
+     */
+    bool isPresent(QString const& isPresent);
+
+    /*!
+     *  Builds the interval tree node for a range of the sorted entries.
+     *
+     *      @param [in] begin   The first entry of the range.
+     *      @param [in] end     One past the last entry of the range.
+     *
+     *      @return The largest last address in the range.
+     */
+    quint64 buildNode(int begin, int end);
+
+    /*!
+     *  Collects the entries overlapping an address range from the node of a range of the sorted entries.
+     *
+     *      @param [in]     begin           The first entry of the node range.
+     *      @param [in]     end             One past the last entry of the node range.
+     *      @param [in]     firstAddress    The first address to find.
+     *      @param [in]     lastAddress     The last address to find.
+     *      @param [in]     memoryMapName   The memory map to search in, or empty for all.
+     *      @param [in/out] found           The found entries.
+     */
+    void collect(int begin, int end, quint64 firstAddress, quint64 lastAddress, QString const& memoryMapName,
+        QVector<Entry>& found) const;
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The parser for the expressions in the memory maps.
+    QSharedPointer<ExpressionParser> expressionParser_;
+
+    //! The maximum number of elements expanded in a build.
+    quint64 elementLimit_;
+
+    //! The number of elements expanded in the current build.
+    quint64 expandedElements_ = 0;
+
+    //! The items not completely indexed because of the element limit.
+    QStringList truncatedItems_;
+
+    //! The evaluated expressions of the current build.
+    QHash<QString, quint64> values_;
+
+    //! The address unit bits of the memory map being indexed.
+    quint64 addressUnitBits_ = 8;
+
+    //! The indexed items sorted by their first address.
+    QVector<Entry> entries_;
+
+    //! The largest last address in the subtree of each node. The node of an entry range is its middle entry.
+    QVector<quint64> subtreeLastAddress_;
+};
+
+#endif // MEMORYMAPINDEX_H
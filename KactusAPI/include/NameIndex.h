@@ -0,0 +1,189 @@
+//-----------------------------------------------------------------------------
+// File: NameIndex.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 17.10.2026
+//
+// Description:
+// Maps the names of the items in a list to their positions.
+//-----------------------------------------------------------------------------
+
+#ifndef NAME_INDEX_H
+#define NAME_INDEX_H
+
+#include <QAnyStringView>
+#include <QList>
+#include <QSharedPointer>
+#include <QUtf8StringView>
+
+#include <string>
+#include <unordered_map>
+
+//-----------------------------------------------------------------------------
+//! Maps the names of the items in a list to their positions.
+//
+// A name lookup takes constant time and does not convert the item names. The index is built on the first
+// lookup after invalidate() and the owning interface should invalidate it when items are added, removed or
+// renamed. Editors and undo commands still change the lists and rename the items directly, so found positions
+// are checked against the list and names that are not found cause a rebuild. The lookups are therefore correct
+// even if the list has been changed elsewhere, and the checks cost nothing extra for found names.
+//-----------------------------------------------------------------------------
+class NameIndex
+{
+public:
+
+    //! Marks the index to be rebuilt on the next lookup.
+    void invalidate() const noexcept
+    {
+        valid_ = false;
+    }
+
+    /*!
+     *  Adds an item appended to the indexed list without rebuilding the index.
+     *
+     *      @param [in] name        The name of the appended item.
+     *      @param [in] position    The position of the appended item.
+     */
+    void append(std::string const& name, int position) const
+    {
+        if (valid_)
+        {
+            indices_.emplace(name, position);
+        }
+    }
+
+    /*!
+     *  Finds the position of an item by name.
+     *
+     *      @param [in] name            The name of the item.
+     *      @param [in] items           The indexed items.
+     *      @param [in] rebuildOnMiss   If false, a name not in the index is not searched from the list. Only for
+     *                                  batches of the owning interface that only append to the list after
+     *                                  rebuild().
+     *
+     *      @return The position of the first item with the given name, or -1 if not found.
+     */
+    template <typename Item>
+    int indexOf(std::string const& name, QList<QSharedPointer<Item> > const& items, bool rebuildOnMiss = true) const
+    {
+        if (valid_)
+        {
+            auto position = indices_.find(name);
+            if (position != indices_.cend() && position->second < items.size() &&
+                QAnyStringView::equal(items.at(position->second)->name(), QUtf8StringView(name)))
+            {
+                return position->second;
+            }
+
+            if (position == indices_.cend() && rebuildOnMiss == false)
+            {
+                return -1;
+            }
+        }
+
+        rebuild(items);
+
+        auto position = indices_.find(name);
+        if (position == indices_.cend())
+        {
+            return -1;
+        }
+
+        return position->second;
+    }
+
+    /*!
+     *  Finds the position of an item by name.
+     *
+     *      @param [in] name    The name of the item.
+     *      @param [in] items   The indexed items.
+     *
+     *      @return The position of the first item with the given name, or -1 if not found.
+     */
+    template <typename Item>
+    int indexOf(std::string const& name, QSharedPointer<QList<QSharedPointer<Item> > > const& items) const
+    {
+        if (items.isNull())
+        {
+            return -1;
+        }
+
+        return indexOf(name, *items);
+    }
+
+    /*!
+     *  Rebuilds the index from the given items.
+     *
+     *      @param [in] items   The items to index.
+     */
+    template <typename Item>
+    void rebuild(QList<QSharedPointer<Item> > const& items) const
+    {
+        indices_.clear();
+        indices_.reserve(items.size());
+
+        // The first item is kept for duplicate names, like in a linear search.
+        for (int i = 0; i < items.size(); ++i)
+        {
+            indices_.emplace(items.at(i)->name().toStdString(), i);
+        }
+
+        valid_ = true;
+    }
+
+    /*!
+     *  Finds an item by name.
+     *
+     *      @param [in] name    The name of the item.
+     *      @param [in] items   The indexed items.
+     *
+     *      @return The first item with the given name, or null if not found.
+     */
+    template <typename Item>
+    QSharedPointer<Item> find(std::string const& name, QList<QSharedPointer<Item> > const& items) const
+    {
+        int index = indexOf(name, items);
+        if (index < 0)
+        {
+            return QSharedPointer<Item>();
+        }
+
+        return items.at(index);
+    }
+
+    /*!
+     *  Finds an item by name.
+     *
+     *      @param [in] name    The name of the item.
+     *      @param [in] items   The indexed items.
+     *
+     *      @return The first item with the given name, or null if not found.
+     */
+    template <typename Item>
+    QSharedPointer<Item> find(std::string const& name,
+        QSharedPointer<QList<QSharedPointer<Item> > > const& items) const
+    {
+        int index = indexOf(name, items);
+        if (index < 0)
+        {
+            return QSharedPointer<Item>();
+        }
+
+        return items->at(index);
+    }
+
+private:
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The positions of the items with their names as keys.
+    mutable std::unordered_map<std::string, int> indices_;
+
+    //! Flag for an up-to-date index.
+    mutable bool valid_ = false;
+};
+
+#endif // NAME_INDEX_H
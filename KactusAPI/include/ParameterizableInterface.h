@@ -17,6 +17,11 @@
 #include <KactusAPI/include/ExpressionFormatter.h>
 #include <KactusAPI/include/ParameterFinder.h>
 
+#include <QStringList>
+
+#include <string>
+#include <vector>
+
 class ExpressionFormatter;
 class ValueFormatter;
 
@@ -85,6 +90,26 @@ protected:
      */
     QString parseExpressionToBaseNumber(QString const& expression, unsigned int baseNumber) const;
 
+    /*!
+     *  Parse a list of expressions to decimal. Each distinct expression is evaluated once.
+     *
+     *      @param [in] expressions     The selected expressions.
+     *
+     *      @return The values of the expressions in decimal form, in the order of the expressions.
+     */
+    QStringList parseExpressionsToDecimal(QStringList const& expressions) const;
+
+    /*!
+     *  Parse a list of expressions to the selected base number. Each distinct expression is evaluated once.
+     *
+     *      @param [in] expressions     The selected expressions.
+     *      @param [in] baseNumber      The selected base number.
+     *
+     *      @return The values of the expressions in the base number form, in the order of the expressions.
+     */
+    std::vector<std::string> parseExpressionsToBaseNumber(QStringList const& expressions,
+        unsigned int baseNumber) const;
+
 private:
 
     //-----------------------------------------------------------------------------
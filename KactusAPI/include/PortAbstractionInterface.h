@@ -13,6 +13,7 @@
 #define PORTABSTRACTIONINTERFACE_H
 
 #include <MasterPortInterface.h>
+#include <NameIndex.h>
 
 #include "KactusAPI/KactusAPIGlobal.h"
 
@@ -961,6 +962,9 @@ private:
     //! Pointer to the available port abstractions.
     QSharedPointer<QList<QSharedPointer<PortAbstraction> > > ports_;
 
+    //! Positions of the available port abstractions by name.
+    NameIndex nameIndex_;
+
     //! List of signals.
     QList<QSharedPointer<SignalRow> > signals_;
 
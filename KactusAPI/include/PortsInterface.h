@@ -16,11 +16,11 @@
 
 #include <ParameterizableInterface.h>
 #include <MasterPortInterface.h>
+#include <NameIndex.h>
 
 #include <IPXACTmodels/common/DirectionTypes.h>
 #include <IPXACTmodels/Component/Port.h>
 
-
 class PortValidator;
 
 //-----------------------------------------------------------------------------
@@ -658,6 +658,67 @@ public:
      */
     bool setMinConnections(std::string const& portName, std::string const& newMinConnections) const;
 
+    /*!
+     *  Get the directions of all the ports.
+     *
+     *      @return The directions in the order of getItemNames(). Empty for transactional ports.
+     */
+    std::vector<std::string> getDirections() const;
+
+    /*!
+     *  Get the calculated left bounds of all the ports.
+     *
+     *      @param [in] baseNumber  Base for displaying the values.
+     *
+     *      @return The left bounds in the order of getItemNames(). Empty for ports without a vector.
+     */
+    std::vector<std::string> getLeftBoundValues(unsigned int baseNumber = 10) const;
+
+    /*!
+     *  Get the calculated right bounds of all the ports.
+     *
+     *      @param [in] baseNumber  Base for displaying the values.
+     *
+     *      @return The right bounds in the order of getItemNames(). Empty for ports without a vector.
+     */
+    std::vector<std::string> getRightBoundValues(unsigned int baseNumber = 10) const;
+
+    /*!
+     *  Get the calculated widths of all the ports.
+     *
+     *      @return The widths in the order of getItemNames().
+     */
+    std::vector<std::string> getWidths() const;
+
+    /*!
+     *  Get the calculated default values of all the ports.
+     *
+     *      @param [in] baseNumber  Base for displaying the values.
+     *
+     *      @return The default values in the order of getItemNames(). Empty for transactional ports.
+     */
+    std::vector<std::string> getDefaultValues(unsigned int baseNumber = 10) const;
+
+    /*!
+     *  Set the values of a batch of wire ports. Ports that do not exist are added as wire ports. Each value
+     *  column is either empty to keep the current values, or has a value for each port. The whole batch is
+     *  validated before any port is changed, and nothing is changed if any of the ports is not valid.
+     *
+     *      @param [in] portNames       Names of the ports.
+     *      @param [in] directions      New directions of the ports.
+     *      @param [in] leftBounds      New left bounds of the ports.
+     *      @param [in] rightBounds     New right bounds of the ports.
+     *      @param [in] defaultValues   New default values of the ports.
+     *
+     *      @return Names of the transactional ports and the ports that would not be valid after the changes.
+     *              If the size of a column does not match the ports, all the given names are returned.
+     */
+    std::vector<std::string> setWirePorts(std::vector<std::string> const& portNames,
+        std::vector<std::string> const& directions,
+        std::vector<std::string> const& leftBounds = std::vector<std::string>(),
+        std::vector<std::string> const& rightBounds = std::vector<std::string>(),
+        std::vector<std::string> const& defaultValues = std::vector<std::string>());
+
 	/*!
 	 *  Add a wire port.
 	 *
@@ -856,6 +917,18 @@ private:
      */
     void setTypeNameAndDefinition(QSharedPointer<Port> port) const;
 
+    /*!
+     *  Get the calculated values of a wire expression in all the ports.
+     *
+     *      @param [in] getExpression   The wire function for getting the expression.
+     *      @param [in] isVectorValue   If true, the expression is only valid for wires with a vector.
+     *      @param [in] baseNumber      Base for displaying the values.
+     *
+     *      @return The values in the order of the ports. Empty for ports without a value.
+     */
+    std::vector<std::string> getWireValues(QString (Wire::*getExpression)() const, bool isVectorValue,
+        unsigned int baseNumber) const;
+
     //-----------------------------------------------------------------------------
     // Data.
     //-----------------------------------------------------------------------------
@@ -863,6 +936,9 @@ private:
     //! Pointer to the available ports.
     Port::List ports_ = nullptr;
 
+    //! Positions of the available ports by name.
+    NameIndex nameIndex_;
+
     //! The validator used for ports.
     QSharedPointer<PortValidator> portValidator_;
 };
@@ -16,6 +16,7 @@
 
 #include <ParameterizableInterface.h>
 #include <NameGroupInterface.h>
+#include <NameIndex.h>
 
 #include <IPXACTmodels/common/AccessTypes.h>
 
@@ -272,6 +273,50 @@ public:
      */
     bool setSize(std::string const& registerName, std::string const& newSize);
 
+    /*!
+     *  Get the calculated offsets of all the registers.
+     *
+     *      @param [in] baseNumber  Base for displaying the values.
+     *
+     *      @return The offsets in the order of getItemNames().
+     */
+    std::vector<std::string> getOffsetValues(int const& baseNumber = 0) const;
+
+    /*!
+     *  Get the calculated dimensions of all the registers.
+     *
+     *      @param [in] baseNumber  Base for displaying the values.
+     *
+     *      @return The dimensions in the order of getItemNames().
+     */
+    std::vector<std::string> getDimensionValues(int const& baseNumber = 0) const;
+
+    /*!
+     *  Get the calculated sizes of all the registers.
+     *
+     *      @param [in] baseNumber  Base for displaying the values.
+     *
+     *      @return The sizes in the order of getItemNames().
+     */
+    std::vector<std::string> getSizeValues(int const& baseNumber = 0) const;
+
+    /*!
+     *  Set the values of a batch of registers. Each value column is either empty to keep the current values, or
+     *  has a value for each register. The changed registers are validated once after all the changes.
+     *
+     *      @param [in] registerNames   Names of the registers.
+     *      @param [in] offsets         New offsets of the registers.
+     *      @param [in] sizes           New sizes of the registers.
+     *      @param [in] dimensions      New dimensions of the registers.
+     *
+     *      @return Names of the registers that were not found or are not valid after the changes. If the size of
+     *              a column does not match the registers, nothing is changed and all the given names are
+     *              returned.
+     */
+    std::vector<std::string> setRegisterValues(std::vector<std::string> const& registerNames,
+        std::vector<std::string> const& offsets, std::vector<std::string> const& sizes,
+        std::vector<std::string> const& dimensions = std::vector<std::string>());
+
     /*!
      *  Get the volatile of the selected register.
      *
@@ -505,6 +550,9 @@ private:
     //! List of contained registers.
     QList<QSharedPointer<Register> > registers_;
 
+    //! Positions of the contained registers by name.
+    NameIndex nameIndex_;
+
     //! Validator for registers.
     QSharedPointer<RegisterValidator> validator_;
 
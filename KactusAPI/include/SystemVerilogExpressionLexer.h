@@ -0,0 +1,73 @@
+//-----------------------------------------------------------------------------
+// File: SystemVerilogExpressionLexer.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 17.10.2026
+//
+// Description:
+// Splits SystemVerilog expressions into tokens.
+//-----------------------------------------------------------------------------
+
+#ifndef SYSTEMVERILOGEXPRESSIONLEXER_H
+#define SYSTEMVERILOGEXPRESSIONLEXER_H
+
+#include <KactusAPI/KactusAPIGlobal.h>
+
+#include <QStringView>
+#include <QVector>
+
+//-----------------------------------------------------------------------------
+//! Splits SystemVerilog expressions into tokens.
+//
+// The tokens are recognized with a single scan over a character class table. Expressions containing
+// characters outside the table are tokenized with the regular expressions in SystemVerilogSyntax, which
+// define the accepted syntax. Both ways produce the same tokens.
+//-----------------------------------------------------------------------------
+namespace SystemVerilogExpressionLexer
+{
+    //! The token types.
+    enum class TokenType
+    {
+        Literal,            //!< A number, boolean or string literal.
+        Operator,           //!< A binary, unary or ternary operator.
+        OpenParenthesis,    //!< (
+        CloseParenthesis,   //!< )
+        OpenArray,          //!< {
+        CloseArray,         //!< }
+        Comma,              //!< ,
+        Symbol              //!< Any other text up to the next operator or delimiter.
+    };
+
+    //! A single token in an expression.
+    struct Token
+    {
+        TokenType type;     //!< The type of the token.
+        QStringView text;   //!< The token text in the expression without surrounding whitespace.
+
+        bool operator==(Token const& other) const noexcept
+        {
+            return type == other.type && text == other.text;
+        }
+    };
+
+    /*!
+     *  Splits the given expression into tokens.
+     *
+     *      @param [in] expression  The expression to tokenize.
+     *
+     *      @return The tokens in the order of appearance. The tokens refer to the given expression.
+     */
+    KACTUS2_API QVector<Token> tokenize(QStringView expression);
+
+    /*!
+     *  Splits the given expression into tokens using only regular expression matching.
+     *
+     *      @param [in] expression  The expression to tokenize.
+     *
+     *      @return The tokens in the order of appearance. The tokens refer to the given expression.
+     */
+    KACTUS2_API QVector<Token> tokenizeWithRegularExpressions(QStringView expression);
+}
+
+#endif // SYSTEMVERILOGEXPRESSIONLEXER_H
@@ -17,10 +17,16 @@
 #include "KactusAPI/KactusAPIGlobal.h"
 
 #include <QString>
+#include <QHash>
 #include <QMap>
+#include <QVector>
 
 //-----------------------------------------------------------------------------
 //! Parser for SystemVerilog expressions.
+//
+// Expressions are compiled into classified RPN tokens on first use and the compiled form is cached per
+// expression string. Symbol values are still looked up on every evaluation. Because of the cache, the parser
+// must not be shared between threads.
 //-----------------------------------------------------------------------------
 class KACTUS2_API SystemVerilogExpressionParser : public ExpressionParser
 {
@@ -141,6 +147,62 @@ protected:
 
 private:
 
+    //! A value on the evaluation stack.
+    struct StackValue
+    {
+        bool isInteger = false;     //!< True, if the value is an exact integer.
+        qint64 integer = 0;         //!< The value of an integer, or the bits of an unsigned integer.
+        QString text;               //!< The value of other types e.g. real numbers, strings and arrays.
+        bool isUnsigned = false;    //!< True, if the integer is an unsigned value of 2^63 or above.
+    };
+
+    //! A token of a compiled expression.
+    struct CompiledToken
+    {
+        //! The role of the token in the evaluation.
+        enum class Kind
+        {
+            UnaryOperator,
+            BinaryOperator,
+            TernaryQuestion,
+            TernaryColon,
+            OpenArray,
+            CloseArray,
+            Constant,       //!< A value known at compile time.
+            Operand         //!< A symbol or a constant, checked when evaluated.
+        };
+
+        Kind kind = Kind::Constant;     //!< The role of the token.
+        QString text;                   //!< The token text in the expression.
+        StackValue value;               //!< The value of a constant or an operand that is not a symbol.
+        int slot = -1;                  //!< The index of an operand among the distinct operands.
+    };
+
+    //! An expression converted to RPN with the tokens classified for evaluation.
+    struct CompiledExpression
+    {
+        QVector<CompiledToken> tokens;  //!< The tokens in RPN order.
+        int slotCount = 0;              //!< The number of distinct operands.
+    };
+
+    /*!
+     *  Gets the compiled form of the given expression, compiling it if it is not cached.
+     *
+     *      @param [in] expression   The expression to get.
+     *
+     *      @return The compiled expression.
+     */
+    CompiledExpression compiledExpression(QStringView expression) const;
+
+    /*!
+     *  Compiles the given expression.
+     *
+     *      @param [in] expression   The expression to compile.
+     *
+     *      @return The compiled expression.
+     */
+    CompiledExpression compile(QStringView expression) const;
+
     /*!
      *  Converts the given expression to Reverse Polish Notation (RPN) format.
      *  RPN is used to ensure the operations are calculated in the correct precedence order.
@@ -152,14 +214,79 @@ private:
     static QVector<QStringView> convertToRPN(QStringView expression);
 
     /*!
-     *  Solves the given RPN expression.
+     *  Solves the given compiled expression. Integers are kept as exact 64-bit signed or unsigned values during
+     *  the evaluation and only converted to text for the result.
      *
      *      @param [in]     rpn                The expression to solve.
      *      @param [out]    validExpression    Set to true, if the parsing was successful, otherwise false.
      *
      *      @return The solved result.
      */
-    QString solveRPN(QVector<QStringView> rpn, bool* validExpression) const;
+    QString solveRPN(CompiledExpression const& rpn, bool* validExpression) const;
+
+    /*!
+     *  Creates a stack value from text.
+     *
+     *      @param [in] text   The text to convert.
+     *
+     *      @return An integer value for decimal integers, otherwise a text value.
+     */
+    static StackValue toStackValue(QString const& text);
+
+    /*!
+     *  Creates an integer stack value from an unsigned integer.
+     *
+     *      @param [in] value   The value to convert.
+     *
+     *      @return A signed integer value, if the value fits in it, otherwise an unsigned integer value.
+     */
+    static StackValue toStackValue(quint64 value) noexcept;
+
+    /*!
+     *  Converts a stack value to text.
+     *
+     *      @param [in] value   The value to convert.
+     *
+     *      @return The value as text.
+     */
+    static QString toText(StackValue const& value);
+
+    /*!
+     *  Solves a binary operation on stack values. Integer operations are solved exactly, other values
+     *  are solved as text. Operations on non-negative integers overflowing the signed range are solved
+     *  as unsigned.
+     *
+     *      @param [in] operation   The operation to solve.
+     *      @param [in] leftTerm    The first term of the operation.
+     *      @param [in] rightTerm   The second term of the operation.
+     *
+     *      @return The result of the operation.
+     */
+    StackValue solveBinary(QStringView operation, StackValue const& leftTerm, StackValue const& rightTerm) const;
+
+    /*!
+     *  Solves a binary operation on two integers.
+     *
+     *      @param [in]  operation   The operation to solve.
+     *      @param [in]  left        The first term of the operation.
+     *      @param [in]  right       The second term of the operation.
+     *      @param [out] result      The result of the operation.
+     *
+     *      @return True, if the operation was solved, or false if it must be solved as text.
+     */
+    static bool solveIntegerBinary(QStringView operation, qint64 left, qint64 right, StackValue& result);
+
+    /*!
+     *  Solves a binary operation on two unsigned integers.
+     *
+     *      @param [in]  operation   The operation to solve.
+     *      @param [in]  left        The first term of the operation.
+     *      @param [in]  right       The second term of the operation.
+     *      @param [out] result      The result of the operation.
+     *
+     *      @return True, if the operation was solved, or false if it must be solved as text.
+     */
+    static bool solveUnsignedBinary(QStringView operation, quint64 left, quint64 right, StackValue& result);
 
     /*!
      *  Checks if the given expression is a string.
@@ -197,18 +324,6 @@ private:
      */
     bool isTernaryOperator(QStringView token) const;
 
-    /*!
-     *  Solves a Ternary operation.
-     *
-     *      @param [in] condition   The selecting condition of the ternary operation.
-     *      @param [in] trueCase    The value for true condition.
-     *      @param [in] falseCase   The value for false condition.
-     *
-     *      @return The result of the operation.
-     */
-    QString solveTernary(QStringView condition, QString const& trueCase, QString const& falseCase) const;
-
-
     /*!
      *  Solves a binary operation.
      *
@@ -255,6 +370,13 @@ private:
      *      @return The base for the selected number. Either 2, 8, 10 or 16.
      */
     static int baseOf(QStringView constantNumber);
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The compiled expressions with the expression string as key.
+    mutable QHash<QString, CompiledExpression> compiledExpressions_;
 };
 
 #endif // SYSTEMVERILOGEXPRESSIONPARSER_H
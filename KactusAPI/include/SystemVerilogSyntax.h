@@ -18,10 +18,11 @@ namespace SystemVerilogSyntax
 
     const QString BOOLEAN_VALUE = QStringLiteral("(?i)true|(?i)false");
     const QString REAL_NUMBER = QStringLiteral("[-+]?[0-9_]+[.][0-9_]+");
-    const QString DECIMAL_NUMBER = QStringLiteral("(?:") + SIZE + QStringLiteral("'") + SIGNED + QStringLiteral("[dD]?)?[0-9_]{1,18}");
-    const QString HEXADECIMAL_NUMBER = SIZE + QStringLiteral("'") + SIGNED + QStringLiteral("[hH][0-9a-fA-F_]{1,15}");
-    const QString OCTAL_NUMBER = SIZE + QStringLiteral("'") + SIGNED + QStringLiteral("[oO][0-7_]{1,20}");
-    const QString BINARY_NUMBER = SIZE + QStringLiteral("'") + SIGNED + QStringLiteral("[bB][01_]{1,62}");
+    // The digit counts are limited to 64-bit values. Underscores are not counted as digits.
+    const QString DECIMAL_NUMBER = QStringLiteral("(?:") + SIZE + QStringLiteral("'") + SIGNED + QStringLiteral("[dD]?)?_*(?:[0-9]_*){1,20}");
+    const QString HEXADECIMAL_NUMBER = SIZE + QStringLiteral("'") + SIGNED + QStringLiteral("[hH]_*(?:[0-9a-fA-F]_*){1,16}");
+    const QString OCTAL_NUMBER = SIZE + QStringLiteral("'") + SIGNED + QStringLiteral("[oO]_*(?:[0-7]_*){1,22}");
+    const QString BINARY_NUMBER = SIZE + QStringLiteral("'") + SIGNED + QStringLiteral("[bB]_*(?:[01]_*){1,64}");
 
     const QString INTEGRAL_NUMBER = QStringLiteral("[+-]?(?:") + HEXADECIMAL_NUMBER + QStringLiteral("|") +
         OCTAL_NUMBER + QStringLiteral("|") + BINARY_NUMBER + QStringLiteral("|") + DECIMAL_NUMBER + QStringLiteral(")");
@@ -29,4 +30,9 @@ namespace SystemVerilogSyntax
     const QString STRING_LITERAL = QStringLiteral("\"[^\"]*\"");
 
     inline const QString MATH_FUNCTION = QStringLiteral("[$]pow|[$]clog2|[$]exp|[$]sqrt");
+
+    inline const QString BINARY_OPERATOR = QStringLiteral("[/%^+-]|<<|>>|<=?|>=?|!==?|===?|[&|*]{1,2}|[$]pow");
+    inline const QString UNARY_OPERATOR = QStringLiteral(
+        "[$]clog2|[$]exp|[$]sqrt|[$]ipxact_mode_condition|[$]ipxact_port_value|[$]ipxact_field_value|~");
+    inline const QString TERNARY_OPERATOR = QStringLiteral("[?:]");
 }
@@ -60,6 +60,7 @@ void PortAbstractionInterface::setAbsDef(QSharedPointer<AbstractionDefinition co
     }
 
     ports_ = absDef->getLogicalPorts();
+    nameIndex_.invalidate();
 
     for (auto port : *ports_)
     {
@@ -152,16 +153,7 @@ void PortAbstractionInterface::createTransactionalSignal(QSharedPointer<PortAbst
 //-----------------------------------------------------------------------------
 QSharedPointer<PortAbstraction> PortAbstractionInterface::getPort(std::string const& portName) const
 {
-    QString portNameQ(QString::fromStdString(portName));
-    for (auto port : *ports_)
-    {
-        if (port->name() == portNameQ)
-        {
-            return port;
-        }
-    }
-
-    return QSharedPointer<PortAbstraction>();
+    return nameIndex_.find(portName, ports_);
 }
 
 //-----------------------------------------------------------------------------
@@ -393,6 +385,7 @@ bool PortAbstractionInterface::setName(std::string const& currentName, std::stri
         QString uniqueNewName(getUniqueName(newName, DEFAULT_NAME));
 
         editedPort->setLogicalName(uniqueNewName);
+        nameIndex_.invalidate();
         return true;
     }
     else
@@ -1479,6 +1472,7 @@ void PortAbstractionInterface::addWirePort(std::string const& newPortName)
     
     signals_.append(newPort);
     ports_->append(newPort->abstraction_);
+    nameIndex_.invalidate();
 }
 
 //-----------------------------------------------------------------------------
@@ -1498,6 +1492,7 @@ void PortAbstractionInterface::addTransactionalPort(std::string const& newPortNa
 
     signals_.append(newPort);
     ports_->append(newPort->abstraction_);
+    nameIndex_.invalidate();
 }
 
 //-----------------------------------------------------------------------------
@@ -1762,6 +1757,7 @@ bool PortAbstractionInterface::removeSignal(int const& signalIndex)
     if (removeAbstraction)
     {
         ports_->removeOne(removedSignal->abstraction_);
+        nameIndex_.invalidate();
     }
 
     return true;
@@ -51,3 +51,36 @@ QString ParameterizableInterface::parseExpressionToBaseNumber(QString const& exp
 {
     return valueFormatter_->format(parseExpressionToDecimal(expression), baseNumber);
 }
+
+//-----------------------------------------------------------------------------
+// Function: ParameterizableInterface::parseExpressionsToDecimal()
+//-----------------------------------------------------------------------------
+QStringList ParameterizableInterface::parseExpressionsToDecimal(QStringList const& expressions) const
+{
+    ExpressionParser::ResultTable const results = expressionParser_->parseExpressions(expressions);
+
+    QStringList values;
+    values.reserve(expressions.size());
+    for (QString const& expression : expressions)
+    {
+        values.append(results.value(expression).value);
+    }
+
+    return values;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterizableInterface::parseExpressionsToBaseNumber()
+//-----------------------------------------------------------------------------
+std::vector<std::string> ParameterizableInterface::parseExpressionsToBaseNumber(QStringList const& expressions,
+    unsigned int baseNumber) const
+{
+    std::vector<std::string> values;
+    values.reserve(expressions.size());
+    for (QString const& value : parseExpressionsToDecimal(expressions))
+    {
+        values.push_back(valueFormatter_->format(value, baseNumber).toStdString());
+    }
+
+    return values;
+}
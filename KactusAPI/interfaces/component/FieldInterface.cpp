@@ -20,6 +20,7 @@
 #include <FieldExpressionsGatherer.h>
 #include <editors/ComponentEditor/memoryMaps/memoryMapsExpressionCalculators/ReferenceCalculator.h>
 #include <ResetInterface.h>
+#include <ListHelper.h>
 
 #include <QMimeData>
 #include <QApplication>
@@ -53,6 +54,7 @@ subInterface_(subInterface)
 void FieldInterface::setFields(QSharedPointer<QList<QSharedPointer<Field> > > newFields)
 {
     fields_ = newFields;
+    nameIndex_.invalidate();
 }
 
 //-----------------------------------------------------------------------------
@@ -60,18 +62,7 @@ void FieldInterface::setFields(QSharedPointer<QList<QSharedPointer<Field> > > ne
 //-----------------------------------------------------------------------------
 int FieldInterface::getItemIndex(std::string const& itemName) const
 {
-    if (fields_)
-    {
-        for (int i = 0; i < fields_->size(); ++i)
-        {
-            if (fields_->at(i)->name().toStdString() == itemName)
-            {
-                return i;
-            }
-        }
-    }
-
-    return -1;
+    return nameIndex_.indexOf(itemName, fields_);
 }
 
 //-----------------------------------------------------------------------------
@@ -129,6 +120,7 @@ bool FieldInterface::setName(std::string const& currentName, std::string const&
         QString uniqueNewName = getUniqueName(newName, FIELD_TYPE);
 
         editedField->setName(uniqueNewName);
+        nameIndex_.invalidate();
         return true;
     }
     else
@@ -251,6 +243,92 @@ bool FieldInterface::setWidth(std::string const& fieldName, std::string const& n
     return true;
 }
 
+//-----------------------------------------------------------------------------
+// Function: FieldInterface::getOffsetValues()
+//-----------------------------------------------------------------------------
+std::vector<std::string> FieldInterface::getOffsetValues(int const& baseNumber) const
+{
+    QStringList offsets;
+    if (fields_)
+    {
+        offsets.reserve(fields_->size());
+        for (QSharedPointer<Field> const& field : *fields_)
+        {
+            offsets.append(field->getBitOffset());
+        }
+    }
+
+    return parseExpressionsToBaseNumber(offsets, baseNumber);
+}
+
+//-----------------------------------------------------------------------------
+// Function: FieldInterface::getWidthValues()
+//-----------------------------------------------------------------------------
+std::vector<std::string> FieldInterface::getWidthValues(int const& baseNumber) const
+{
+    QStringList widths;
+    if (fields_)
+    {
+        widths.reserve(fields_->size());
+        for (QSharedPointer<Field> const& field : *fields_)
+        {
+            widths.append(field->getBitWidth());
+        }
+    }
+
+    return parseExpressionsToBaseNumber(widths, baseNumber);
+}
+
+//-----------------------------------------------------------------------------
+// Function: FieldInterface::setFieldValues()
+//-----------------------------------------------------------------------------
+std::vector<std::string> FieldInterface::setFieldValues(std::vector<std::string> const& fieldNames,
+    std::vector<std::string> const& offsets, std::vector<std::string> const& widths)
+{
+    std::size_t const fieldCount = fieldNames.size();
+    if (ListHelper::columnFitsBatch(offsets, fieldCount) == false ||
+        ListHelper::columnFitsBatch(widths, fieldCount) == false)
+    {
+        return fieldNames;
+    }
+
+    std::vector<std::string> invalidFields;
+
+    QList<QSharedPointer<Field> > changedFields;
+    changedFields.reserve(fieldCount);
+
+    for (std::size_t i = 0; i < fieldCount; ++i)
+    {
+        QSharedPointer<Field> field = getField(fieldNames.at(i));
+        if (!field)
+        {
+            invalidFields.push_back(fieldNames.at(i));
+            continue;
+        }
+
+        if (offsets.empty() == false)
+        {
+            field->setBitOffset(QString::fromStdString(offsets.at(i)));
+        }
+        if (widths.empty() == false)
+        {
+            field->setBitWidth(QString::fromStdString(widths.at(i)));
+        }
+
+        changedFields.append(field);
+    }
+
+    for (QSharedPointer<Field> const& field : changedFields)
+    {
+        if (validator_->validate(field) == false)
+        {
+            invalidFields.push_back(field->name().toStdString());
+        }
+    }
+
+    return invalidFields;
+}
+
 //-----------------------------------------------------------------------------
 // Function: FieldInterface::getResets()
 //-----------------------------------------------------------------------------
@@ -1243,18 +1321,7 @@ bool FieldInterface::hasValidWriteValueConstraint(std::string const& fieldName,
 //-----------------------------------------------------------------------------
 QSharedPointer<Field> FieldInterface::getField(std::string const& fieldName) const
 {
-    if (fields_)
-    {
-        for (auto field : *fields_)
-        {
-            if (field->name().toStdString() == fieldName)
-            {
-                return field;
-            }
-        }
-    }
-
-    return QSharedPointer<Field>();
+    return nameIndex_.find(fieldName, fields_);
 }
 
 //-----------------------------------------------------------------------------
@@ -1268,6 +1335,7 @@ void FieldInterface::addField(int const& row, std::string const& newFieldName)
     newField->setName(fieldName);
 
     fields_->insert(row, newField);
+    nameIndex_.invalidate();
 }
 
 //-----------------------------------------------------------------------------
@@ -1281,6 +1349,7 @@ bool FieldInterface::removeField(std::string const& fieldName)
         return false;
     }
 
+    nameIndex_.invalidate();
     return fields_->removeOne(removedField);
 }
 
@@ -1330,6 +1399,8 @@ std::vector<std::string> FieldInterface::pasteRows()
 
                 pastedFieldNames.push_back(newField->name().toStdString());
             }
+
+            nameIndex_.invalidate();
         }
     }
 
@@ -46,6 +46,7 @@ parameterInterface_(parameterInterface)
 void MemoryBlockInterface::setMemoryBlocks(QSharedPointer<QList<QSharedPointer<MemoryBlockBase>>> newMemoryBlocks)
 {
     blockData_ = newMemoryBlocks;
+    nameIndex_.invalidate();
 }
 
 //-----------------------------------------------------------------------------
@@ -78,15 +79,7 @@ QSharedPointer<QList<QSharedPointer<MemoryBlockBase> > > MemoryBlockInterface::g
 //-----------------------------------------------------------------------------
 QSharedPointer<MemoryBlockBase> MemoryBlockInterface::getBlock(std::string const& itemName) const
 {
-    for (auto currentBlock : *blockData_)
-    {
-        if (currentBlock->name().toStdString() == itemName)
-        {
-            return currentBlock;
-        }
-    }
-
-    return QSharedPointer<MemoryBlockBase>();
+    return nameIndex_.find(itemName, blockData_);
 }
 
 //-----------------------------------------------------------------------------
@@ -102,15 +95,7 @@ QString MemoryBlockInterface::getAddressUnitBits() const
 //-----------------------------------------------------------------------------
 int MemoryBlockInterface::getItemIndex(std::string const& itemName) const
 {
-    for (int i = 0; i < blockData_->size(); ++i)
-    {
-        if (blockData_->at(i)->name().toStdString() == itemName)
-        {
-            return i;
-        }
-    }
-
-    return -1;
+    return nameIndex_.indexOf(itemName, blockData_);
 }
 
 //-----------------------------------------------------------------------------
@@ -159,6 +144,7 @@ bool MemoryBlockInterface::setName(std::string const& currentName, std::string c
     {
         QString uniqueNewName = getUniqueName(newName, getDefaultName());
         editedItem->setName(uniqueNewName);
+        nameIndex_.invalidate();
 
         return true;
     }
@@ -441,6 +427,7 @@ bool MemoryBlockInterface::removeBlock(std::string const& blockName)
         return false;
     }
 
+    nameIndex_.invalidate();
     return blockData_->removeOne(removedItem);
 }
 
@@ -487,6 +474,8 @@ std::vector<std::string> MemoryBlockInterface::pasteRows()
                     pastedItemNames.push_back(newBlock->name().toStdString());
                 }
             }
+
+            nameIndex_.invalidate();
         }
     }
 
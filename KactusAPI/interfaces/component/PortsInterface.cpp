@@ -17,10 +17,25 @@
 #include <IPXACTmodels/Component/Port.h>
 #include <IPXACTmodels/Component/validators/PortValidator.h>
 
-#include <IPXACTmodels/utilities/Search.h>
-
 #include <KactusAPI/include/ListHelper.h>
 
+#include <QPair>
+
+#include <map>
+
+namespace
+{
+    //! Calculates the width of a port from the decimal values of its bounds.
+    std::string widthFromBounds(QString const& leftBoundValue, QString const& rightBoundValue)
+    {
+        qint64 calculatedLeftBound = leftBoundValue.toULongLong();
+        qint64 calculatedRightBound = rightBoundValue.toULongLong();
+
+        qint64 portWidth = abs(calculatedLeftBound - calculatedRightBound) + 1;
+        return QString::number(portWidth).toStdString();
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: PortsInterface::PortsInterface()
 //-----------------------------------------------------------------------------
@@ -39,6 +54,7 @@ portValidator_(validator)
 void PortsInterface::setPorts(Port::List ports)
 {
     ports_ = ports;
+    nameIndex_.invalidate();
 }
 
 //-----------------------------------------------------------------------------
@@ -54,7 +70,7 @@ bool PortsInterface::hasPorts() const
 //-----------------------------------------------------------------------------
 int PortsInterface::getItemIndex(std::string const& itemName) const
 {
-    return ListHelper::itemIndex(itemName, ports_);
+    return nameIndex_.indexOf(itemName, ports_);
 }
 
 //-----------------------------------------------------------------------------
@@ -91,7 +107,7 @@ std::vector<std::string> PortsInterface::getItemNames() const
 //-----------------------------------------------------------------------------
 QSharedPointer<Port> PortsInterface::getPort(std::string const& portName) const
 {
-    return Search::findByName(QString::fromStdString(portName), ports_);
+    return nameIndex_.find(portName, ports_);
 }
 
 //-----------------------------------------------------------------------------
@@ -113,6 +129,7 @@ bool PortsInterface::setName(std::string const& currentPortName, std::string con
         QString uniqueNewName(getUniqueName(newPortName, "port"));
 
         editedPort->setName(uniqueNewName);
+        nameIndex_.invalidate();
         return true;
     }
     else
@@ -802,11 +819,8 @@ std::string PortsInterface::getWidth(std::string const& portName) const
 {
     QSharedPointer<Port> port = getPort(portName);
 
-    qint64 calculatedLeftBound = parseExpressionToDecimal(port->getLeftBound()).toULongLong();
-    qint64 calculatedRightBound = parseExpressionToDecimal(port->getRightBound()).toULongLong();
-
-    qint64 portWidth = abs(calculatedLeftBound - calculatedRightBound) + 1;
-    return QString::number(portWidth).toStdString();
+    return widthFromBounds(parseExpressionToDecimal(port->getLeftBound()),
+        parseExpressionToDecimal(port->getRightBound()));
 }
 
 //-----------------------------------------------------------------------------
@@ -875,6 +889,39 @@ void PortsInterface::setTypeNameAndDefinition(QSharedPointer<Port> port) const
     }
 }
 
+//-----------------------------------------------------------------------------
+// Function: PortsInterface::getWireValues()
+//-----------------------------------------------------------------------------
+std::vector<std::string> PortsInterface::getWireValues(QString (Wire::*getExpression)() const,
+    bool isVectorValue, unsigned int baseNumber) const
+{
+    QStringList expressions;
+    expressions.reserve(itemCount());
+
+    std::vector<bool> hasValue;
+    hasValue.reserve(itemCount());
+
+    for (QSharedPointer<Port> const& port : *ports_)
+    {
+        QSharedPointer<Wire> wire = port->getWire();
+        bool const portHasValue = wire && (isVectorValue == false || wire->getVectors()->isEmpty() == false);
+
+        expressions.append(portHasValue ? (wire.data()->*getExpression)() : QString());
+        hasValue.push_back(portHasValue);
+    }
+
+    std::vector<std::string> values = parseExpressionsToBaseNumber(expressions, baseNumber);
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        if (hasValue.at(i) == false)
+        {
+            values[i].clear();
+        }
+    }
+
+    return values;
+}
+
 //-----------------------------------------------------------------------------
 // Function: PortsInterface::getDefaultValue()
 //-----------------------------------------------------------------------------
@@ -1220,6 +1267,184 @@ bool PortsInterface::setMinConnections(std::string const& portName, std::string
     return false;
 }
 
+//-----------------------------------------------------------------------------
+// Function: PortsInterface::getDirections()
+//-----------------------------------------------------------------------------
+std::vector<std::string> PortsInterface::getDirections() const
+{
+    std::vector<std::string> directions;
+    directions.reserve(itemCount());
+
+    for (QSharedPointer<Port> const& port : *ports_)
+    {
+        if (portIsWire(port))
+        {
+            directions.push_back(DirectionTypes::direction2Str(port->getDirection()).toStdString());
+        }
+        else
+        {
+            directions.push_back(std::string());
+        }
+    }
+
+    return directions;
+}
+
+//-----------------------------------------------------------------------------
+// Function: PortsInterface::getLeftBoundValues()
+//-----------------------------------------------------------------------------
+std::vector<std::string> PortsInterface::getLeftBoundValues(unsigned int baseNumber) const
+{
+    return getWireValues(&Wire::getVectorLeftBound, true, baseNumber);
+}
+
+//-----------------------------------------------------------------------------
+// Function: PortsInterface::getRightBoundValues()
+//-----------------------------------------------------------------------------
+std::vector<std::string> PortsInterface::getRightBoundValues(unsigned int baseNumber) const
+{
+    return getWireValues(&Wire::getVectorRightBound, true, baseNumber);
+}
+
+//-----------------------------------------------------------------------------
+// Function: PortsInterface::getWidths()
+//-----------------------------------------------------------------------------
+std::vector<std::string> PortsInterface::getWidths() const
+{
+    QStringList bounds;
+    bounds.reserve(itemCount() * 2);
+    for (QSharedPointer<Port> const& port : *ports_)
+    {
+        bounds.append(port->getLeftBound());
+        bounds.append(port->getRightBound());
+    }
+
+    QStringList const boundValues = parseExpressionsToDecimal(bounds);
+
+    std::vector<std::string> widths;
+    widths.reserve(itemCount());
+    for (int i = 0; i + 1 < boundValues.size(); i += 2)
+    {
+        widths.push_back(widthFromBounds(boundValues.at(i), boundValues.at(i + 1)));
+    }
+
+    return widths;
+}
+
+//-----------------------------------------------------------------------------
+// Function: PortsInterface::getDefaultValues()
+//-----------------------------------------------------------------------------
+std::vector<std::string> PortsInterface::getDefaultValues(unsigned int baseNumber) const
+{
+    return getWireValues(&Wire::getDefaultDriverValue, false, baseNumber);
+}
+
+//-----------------------------------------------------------------------------
+// Function: PortsInterface::setWirePorts()
+//-----------------------------------------------------------------------------
+std::vector<std::string> PortsInterface::setWirePorts(std::vector<std::string> const& portNames,
+    std::vector<std::string> const& directions, std::vector<std::string> const& leftBounds,
+    std::vector<std::string> const& rightBounds, std::vector<std::string> const& defaultValues)
+{
+    std::size_t const portCount = portNames.size();
+    if (ports_.isNull() ||
+        ListHelper::columnFitsBatch(directions, portCount) == false ||
+        ListHelper::columnFitsBatch(leftBounds, portCount) == false ||
+        ListHelper::columnFitsBatch(rightBounds, portCount) == false ||
+        ListHelper::columnFitsBatch(defaultValues, portCount) == false)
+    {
+        return portNames;
+    }
+
+    std::vector<std::string> invalidPorts;
+
+    // The changes are made to copies of the ports, so that the batch can be validated before changing anything.
+    // Each port has one copy, even if it is repeated in the batch. The original is null for new ports.
+    QList<QPair<QSharedPointer<Port>, QSharedPointer<Port> > > changedPorts;
+    changedPorts.reserve(portCount);
+
+    std::map<std::string, QSharedPointer<Port> > portCopies;
+
+    nameIndex_.rebuild(*ports_);
+
+    for (std::size_t i = 0; i < portCount; ++i)
+    {
+        QSharedPointer<Port> port = portCopies[portNames.at(i)];
+        if (port.isNull())
+        {
+            QSharedPointer<Port> original;
+            if (int const portIndex = nameIndex_.indexOf(portNames.at(i), *ports_, false); portIndex >= 0)
+            {
+                original = ports_->at(portIndex);
+                if (portIsWire(original) == false)
+                {
+                    invalidPorts.push_back(portNames.at(i));
+                    continue;
+                }
+
+                port = QSharedPointer<Port>(new Port(*original));
+            }
+            else
+            {
+                port = QSharedPointer<Port>(new Port(QString::fromStdString(portNames.at(i))));
+                port->setWire(QSharedPointer<Wire>(new Wire()));
+            }
+
+            portCopies[portNames.at(i)] = port;
+            changedPorts.append(qMakePair(original, port));
+        }
+
+        if (directions.empty() == false)
+        {
+            port->setDirection(DirectionTypes::str2Direction(
+                QString::fromStdString(directions.at(i)), DirectionTypes::DIRECTION_INVALID));
+        }
+        if (leftBounds.empty() == false)
+        {
+            port->setLeftBound(QString::fromStdString(leftBounds.at(i)));
+        }
+        if (rightBounds.empty() == false)
+        {
+            port->setRightBound(QString::fromStdString(rightBounds.at(i)));
+        }
+        if (defaultValues.empty() == false)
+        {
+            port->getWire()->setDefaultDriverValue(QString::fromStdString(defaultValues.at(i)));
+        }
+    }
+
+    for (auto const& [original, port] : changedPorts)
+    {
+        setTypeNameAndDefinition(port);
+
+        if (portValidator_->validate(port) == false)
+        {
+            invalidPorts.push_back(port->name().toStdString());
+        }
+    }
+
+    if (invalidPorts.empty() == false)
+    {
+        return invalidPorts;
+    }
+
+    // The existing ports are kept, since the editors and the other interfaces refer to them.
+    for (auto const& [original, port] : changedPorts)
+    {
+        if (original)
+        {
+            *original = *port;
+        }
+        else
+        {
+            ports_->append(port);
+            nameIndex_.append(port->name().toStdString(), ports_->size() - 1);
+        }
+    }
+
+    return invalidPorts;
+}
+
 //-----------------------------------------------------------------------------
 // Function: PortsInterface::getAllReferencesToIdInPort()
 //-----------------------------------------------------------------------------
@@ -1269,6 +1494,7 @@ void PortsInterface::addWirePort(std::string const& newPortName)
     newPort->setWire(QSharedPointer<Wire>(new Wire()));
 
     ports_->append(newPort);
+    nameIndex_.invalidate();
 }
 
 //-----------------------------------------------------------------------------
@@ -1282,6 +1508,7 @@ void PortsInterface::addTransactionalPort(std::string const& newPortName)
     newPort->setTransactional(QSharedPointer<Transactional>(new Transactional()));
 
     ports_->append(newPort);
+    nameIndex_.invalidate();
 }
 
 //-----------------------------------------------------------------------------
@@ -1295,6 +1522,7 @@ bool PortsInterface::removePort(std::string const& portName) const
         return false;
     }
 
+    nameIndex_.invalidate();
     return ports_->removeOne(removedPort);
 }
 
@@ -1303,7 +1531,7 @@ bool PortsInterface::removePort(std::string const& portName) const
 //-----------------------------------------------------------------------------
 bool PortsInterface::portExists(std::string const& portName) const
 {
-    return Search::findByName(QString::fromStdString(portName), ports_) != nullptr;
+    return nameIndex_.indexOf(portName, ports_) >= 0;
 }
 
 //-----------------------------------------------------------------------------
@@ -20,6 +20,7 @@
 #include <FieldInterface.h>
 #include <AccessPolicyInterface.h>
 #include <RegisterExpressionsGatherer.h>
+#include <ListHelper.h>
 
 #include <QMimeData>
 #include <QApplication>
@@ -67,6 +68,8 @@ void RegisterInterface::setRegisters(QSharedPointer<QList<QSharedPointer<Registe
             registers_.append(registerItem);
         }
     }
+
+    nameIndex_.invalidate();
 }
 
 //-----------------------------------------------------------------------------
@@ -74,15 +77,7 @@ void RegisterInterface::setRegisters(QSharedPointer<QList<QSharedPointer<Registe
 //-----------------------------------------------------------------------------
 int RegisterInterface::getItemIndex(string const& itemName) const
 {
-    for (int i = 0; i < registers_.size(); ++i)
-    {
-        if (registers_.at(i)->name().toStdString() == itemName)
-        {
-            return i;
-        }
-    }
-
-    return -1;
+    return nameIndex_.indexOf(itemName, registers_);
 }
 
 //-----------------------------------------------------------------------------
@@ -154,6 +149,7 @@ bool RegisterInterface::setName(string const& currentName, string const& newName
         QString uniqueNewName = getUniqueName(newName, REGISTER_TYPE);
 
         editedRegister->setName(uniqueNewName);
+        nameIndex_.invalidate();
         return true;
     }
     else
@@ -390,6 +386,107 @@ bool RegisterInterface::setSize(std::string const& registerName, std::string con
     return true;
 }
 
+//-----------------------------------------------------------------------------
+// Function: RegisterInterface::getOffsetValues()
+//-----------------------------------------------------------------------------
+std::vector<std::string> RegisterInterface::getOffsetValues(int const& baseNumber) const
+{
+    QStringList offsets;
+    offsets.reserve(registers_.size());
+    for (QSharedPointer<Register> const& currentRegister : registers_)
+    {
+        offsets.append(currentRegister->getAddressOffset());
+    }
+
+    return parseExpressionsToBaseNumber(offsets, baseNumber);
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterInterface::getDimensionValues()
+//-----------------------------------------------------------------------------
+std::vector<std::string> RegisterInterface::getDimensionValues(int const& baseNumber) const
+{
+    QStringList dimensions;
+    dimensions.reserve(registers_.size());
+    for (QSharedPointer<Register> const& currentRegister : registers_)
+    {
+        dimensions.append(currentRegister->getDimension());
+    }
+
+    return parseExpressionsToBaseNumber(dimensions, baseNumber);
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterInterface::getSizeValues()
+//-----------------------------------------------------------------------------
+std::vector<std::string> RegisterInterface::getSizeValues(int const& baseNumber) const
+{
+    QStringList sizes;
+    sizes.reserve(registers_.size());
+    for (QSharedPointer<Register> const& currentRegister : registers_)
+    {
+        sizes.append(currentRegister->getSize());
+    }
+
+    return parseExpressionsToBaseNumber(sizes, baseNumber);
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterInterface::setRegisterValues()
+//-----------------------------------------------------------------------------
+std::vector<std::string> RegisterInterface::setRegisterValues(std::vector<std::string> const& registerNames,
+    std::vector<std::string> const& offsets, std::vector<std::string> const& sizes,
+    std::vector<std::string> const& dimensions)
+{
+    std::size_t const registerCount = registerNames.size();
+    if (ListHelper::columnFitsBatch(offsets, registerCount) == false ||
+        ListHelper::columnFitsBatch(sizes, registerCount) == false ||
+        ListHelper::columnFitsBatch(dimensions, registerCount) == false)
+    {
+        return registerNames;
+    }
+
+    std::vector<std::string> invalidRegisters;
+
+    QList<QSharedPointer<Register> > changedRegisters;
+    changedRegisters.reserve(registerCount);
+
+    for (std::size_t i = 0; i < registerCount; ++i)
+    {
+        QSharedPointer<Register> selectedRegister = getRegister(registerNames.at(i));
+        if (!selectedRegister)
+        {
+            invalidRegisters.push_back(registerNames.at(i));
+            continue;
+        }
+
+        if (offsets.empty() == false)
+        {
+            selectedRegister->setAddressOffset(QString::fromStdString(offsets.at(i)));
+        }
+        if (sizes.empty() == false)
+        {
+            selectedRegister->setSize(QString::fromStdString(sizes.at(i)));
+        }
+        if (dimensions.empty() == false)
+        {
+            selectedRegister->setDimension(QString::fromStdString(dimensions.at(i)));
+        }
+
+        changedRegisters.append(selectedRegister);
+    }
+
+    for (QSharedPointer<Register> const& changedRegister : changedRegisters)
+    {
+        if (validator_->validate(changedRegister) == false)
+        {
+            invalidRegisters.push_back(changedRegister->name().toStdString());
+        }
+    }
+
+    return invalidRegisters;
+}
+
 //-----------------------------------------------------------------------------
 // Function: RegisterInterface::getVolatile()
 //-----------------------------------------------------------------------------
@@ -646,15 +743,7 @@ bool RegisterInterface::hasValidSize(std::string const& registerName) const
 //-----------------------------------------------------------------------------
 QSharedPointer<Register> RegisterInterface::getRegister(std::string const& registerName) const
 {
-    for (auto currentRegister : registers_)
-    {
-        if (currentRegister->name().toStdString() == registerName)
-        {
-            return currentRegister;
-        }
-    }
-
-    return QSharedPointer<Register>();
+    return nameIndex_.find(registerName, registers_);
 }
 
 //-----------------------------------------------------------------------------
@@ -710,6 +799,7 @@ void RegisterInterface::addRegister(int const& row, int const& dataIndex, std::s
     regItem->setName(registerName);
     registers_.insert(row, regItem);
     registerData_->insert(dataIndex, regItem);
+    nameIndex_.invalidate();
 }
 
 //-----------------------------------------------------------------------------
@@ -724,6 +814,7 @@ bool RegisterInterface::removeRegister(std::string const& registerName, int cons
     }
 
     registerData_->removeAt(dataIndex);
+    nameIndex_.invalidate();
     return registers_.removeOne(removedRegister);
 }
 
@@ -774,6 +865,8 @@ std::vector<std::string> RegisterInterface::pasteRows()
 
                 pastedRegisterNames.push_back(newRegister->name().toStdString());
             }
+
+            nameIndex_.invalidate();
         }
     }
 
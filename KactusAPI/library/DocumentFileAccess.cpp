@@ -47,17 +47,70 @@
 
 #include <QObject>
 #include <QDomElement>
+#include <QXmlStreamReader>
 #include <QXmlStreamWriter>
 
+namespace
+{
+    //! Finds the type of the document in the given file and rewinds the file to the start.
+    VLNV::IPXactType readDocumentType(QFile& file)
+    {
+        QXmlStreamReader xmlReader(&file);
+        xmlReader.setNamespaceProcessing(false);
+
+        VLNV::IPXactType documentType = VLNV::INVALID;
+        if (xmlReader.readNextStartElement())
+        {
+            documentType = VLNV::string2Type(xmlReader.qualifiedName().toString());
+        }
+
+        file.seek(0);
+        return documentType;
+    }
+
+    //! Reads the document in the given file using the streaming readers.
+    QSharedPointer<Document> readDocumentStream(QFile& file, VLNV::IPXactType documentType)
+    {
+        QXmlStreamReader xmlReader(&file);
+
+        if (documentType == VLNV::ABSTRACTIONDEFINITION)
+        {
+            return AbstractionDefinitionReader::createAbstractionDefinitionFrom(xmlReader);
+        }
+        else if (documentType == VLNV::COMPONENT)
+        {
+            ComponentReader reader;
+            return reader.createComponentFrom(xmlReader);
+        }
+        else if (documentType == VLNV::DESIGN)
+        {
+            return DesignReader::createDesignFrom(xmlReader);
+        }
+
+        return QSharedPointer<Document>();
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: DocumentFileAccess::readDocument()
 //-----------------------------------------------------------------------------
-QSharedPointer<Document> DocumentFileAccess::readDocument(QString const& path)
+QSharedPointer<Document> DocumentFileAccess::readDocument(QString const& path, ReadMode mode)
 {
     // Create file handle and use it to read the IP-XACT document into memory.
     QFile file(path);
     file.open(QIODevice::ReadOnly);
 
+    // Only the document types with large element lists have streaming readers, the rest are read as DOM.
+    if (mode == ReadMode::Streaming)
+    {
+        VLNV::IPXactType documentType = readDocumentType(file);
+        if (documentType == VLNV::ABSTRACTIONDEFINITION || documentType == VLNV::COMPONENT ||
+            documentType == VLNV::DESIGN)
+        {
+            return readDocumentStream(file, documentType);
+        }
+    }
+
     QDomDocument doc;
     if (!doc.setContent(&file))
     {
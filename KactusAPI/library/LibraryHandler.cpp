@@ -35,13 +35,33 @@
 #include <IPXACTmodels/common/VLNV.h>
 
 #include <QDir>
+#include <QElapsedTimer>
 #include <QFile>
 #include <QFileInfo>
+#include <QMutexLocker>
 #include <QSharedPointer>
 #include <QList>
 #include <QMap>
 #include <QString>
 #include <QStringList>
+#include <QTimer>
+
+#include <QtConcurrent>
+
+#include <algorithm>
+
+namespace
+{
+    //! Time in milliseconds to spend in one batch of background validation before returning to the event loop.
+    const int VALIDATION_BATCH_TIME_MS = 50;
+
+    /*! Estimated memory use of a parsed model per byte in its IP-XACT file. The model stores the element
+     *  content as UTF-16 strings, which doubles the size of the mostly ASCII text, and the objects, shared
+     *  pointers and lists holding the strings take about as much again. The estimate only needs to be in
+     *  proportion to the real use, since it is compared against a limit given in the same estimated bytes.
+     */
+    const qint64 MODEL_BYTES_PER_FILE_BYTE = 4;
+}
 
 //-----------------------------------------------------------------------------
 // Function: LibraryHandler::getInstance()
@@ -62,6 +82,12 @@ LibraryInterface()
 {
     // create the connections between models and library handler
     syncronizeModels();
+
+    connect(&validationWatcher_, &QFutureWatcher<ValidationResult>::progressValueChanged,
+        this, [this](int checkedCount) { emit validationProgress(checkedCount, 
+            validationWatcher_.progressMaximum()); });
+    connect(&validationWatcher_, &QFutureWatcher<ValidationResult>::finished,
+        this, &LibraryHandler::onParallelValidationFinished);
 }
 
 //-----------------------------------------------------------------------------
@@ -72,31 +98,72 @@ void LibraryHandler::setOutputChannel(MessageMediator* messageChannel)
     messageChannel_ = messageChannel;
 }
 
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::setCacheLimit()
+//-----------------------------------------------------------------------------
+void LibraryHandler::setCacheLimit(qint64 limitInBytes)
+{
+    QMutexLocker cacheLock(&cacheMutex_);
+    cacheLimit_ = qMax(qint64(0), limitInBytes);
+    evictDocuments();
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::getCacheStatistics()
+//-----------------------------------------------------------------------------
+LibraryHandler::CacheStatistics LibraryHandler::getCacheStatistics() const
+{
+    QMutexLocker cacheLock(&cacheMutex_);
+    return cacheStatistics_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::showCacheStatistics()
+//-----------------------------------------------------------------------------
+void LibraryHandler::showCacheStatistics() const
+{
+    CacheStatistics const statistics = getCacheStatistics();
+
+    messageChannel_->showMessage(tr("Library cache: %1 hits, %2 misses, %3 evictions.").arg(
+        QString::number(statistics.hitCount), QString::number(statistics.missCount),
+        QString::number(statistics.evictionCount)));
+    messageChannel_->showMessage(tr("Estimated memory use of parsed documents: %1 MB").arg(
+        QString::number(statistics.residentSize / (1024.0 * 1024.0), 'f', 1)));
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::setValidationMode()
+//-----------------------------------------------------------------------------
+void LibraryHandler::setValidationMode(ValidationMode mode)
+{
+    validationMode_ = mode;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::isValidationInProgress()
+//-----------------------------------------------------------------------------
+bool LibraryHandler::isValidationInProgress() const
+{
+    return validationQueue_.isEmpty() == false || validationWatcher_.isRunning();
+}
+
 //-----------------------------------------------------------------------------
 // Function: LibraryHandler::getModel()
 //-----------------------------------------------------------------------------
 QSharedPointer<Document> LibraryHandler::getModel(VLNV const& vlnv)
 {
-    auto info = documentCache_.find(vlnv);
-    if (info == documentCache_.end())
-    {
-        showNotFoundError(vlnv);
-        return QSharedPointer<Document>();
-    }
-
-    // If object has not already been parsed, read it from the disk.
-    if (info->document.isNull())
+    QSharedPointer<Document> original = getCachedDocument(vlnv);
+    if (original.isNull())
     {
-        info->document = DocumentFileAccess::readDocument(info->path);
-    }
+        if (contains(vlnv) == false)
+        {
+            showNotFoundError(vlnv);
+        }
 
-    QSharedPointer<Document> copy;
-    if (info->document.isNull() == false)
-    {
-        copy = info->document->clone();
+        return QSharedPointer<Document>();
     }
 
-    return copy;
+    return original->clone();
 }
 
 //-----------------------------------------------------------------------------
@@ -104,18 +171,7 @@ QSharedPointer<Document> LibraryHandler::getModel(VLNV const& vlnv)
 //-----------------------------------------------------------------------------
 QSharedPointer<Document const> LibraryHandler::getModelReadOnly(VLNV const& vlnv)
 {
-    auto info = documentCache_.find(vlnv);
-    if (info == documentCache_.end())
-    {
-        return QSharedPointer<Document const>();
-    }
-
-    if (info->document.isNull())
-    {
-        info->document = DocumentFileAccess::readDocument(info->path);
-    }
-
-    return info->document;
+    return getCachedDocument(vlnv);
 }
 
 //-----------------------------------------------------------------------------
@@ -123,7 +179,13 @@ QSharedPointer<Document const> LibraryHandler::getModelReadOnly(VLNV const& vlnv
 //-----------------------------------------------------------------------------
 QList<VLNV> LibraryHandler::getAllVLNVs() const
 {
-    return documentCache_.keys();
+    QMutexLocker cacheLock(&cacheMutex_);
+    QList<VLNV> vlnvs = documentCache_.keys();
+    cacheLock.unlock();
+
+    // The hash has no order, so the VLNVs are sorted to keep the library order stable for the views.
+    std::sort(vlnvs.begin(), vlnvs.end());
+    return vlnvs;
 }
 
 //-----------------------------------------------------------------------------
@@ -131,6 +193,7 @@ QList<VLNV> LibraryHandler::getAllVLNVs() const
 //-----------------------------------------------------------------------------
 bool LibraryHandler::contains(const VLNV& vlnv) const
 {
+    QMutexLocker cacheLock(&cacheMutex_);
     return documentCache_.contains(vlnv);
 }
 
@@ -139,6 +202,7 @@ bool LibraryHandler::contains(const VLNV& vlnv) const
 //-----------------------------------------------------------------------------
 const QString LibraryHandler::getPath(VLNV const& vlnv) const
 {
+    QMutexLocker cacheLock(&cacheMutex_);
     return documentCache_.value(vlnv).path;
 }
 
@@ -192,12 +256,27 @@ bool LibraryHandler::writeModelToFile(QSharedPointer<Document> model)
 //-----------------------------------------------------------------------------
 void LibraryHandler::searchForIPXactFiles()
 {
+    // The workers of an ongoing check use the cache being cleared, so the check is restarted afterwards.
+    stopParallelValidation();
+
     clearCache();
 
     loadAvailableVLNVs();
 
-    onCheckLibraryIntegrity();
-    
+    if (validationMode_ == ValidationMode::Background)
+    {
+        // Views are populated first and updated as invalid documents are found.
+        startBackgroundValidation();
+    }
+    else if (validationMode_ == ValidationMode::Parallel)
+    {
+        checkIntegrityInParallel();
+    }
+    else
+    {
+        onCheckLibraryIntegrity();
+    }
+
     resetModels();
 }
 
@@ -219,7 +298,7 @@ void LibraryHandler::getNeededVLNVs(VLNV const& vlnv, QList<VLNV>& list)
     // This document is searched so add it to the list.
     list.append(vlnv);
 
-    for (VLNV const& dependentVLNV : getModelReadOnly(vlnv)->getDependentVLNVs())
+    for (VLNV const& dependentVLNV : getDependentVLNVs(vlnv))
     {
         if (list.contains(dependentVLNV) == false)
         {
@@ -265,6 +344,8 @@ LibraryItem const* LibraryHandler::getTreeRoot() const
 //-----------------------------------------------------------------------------
 VLNV::IPXactType LibraryHandler::getDocumentType(VLNV const& vlnv)
 {
+    QMutexLocker cacheLock(&cacheMutex_);
+
     auto it = documentCache_.constFind(vlnv);
     if (it == documentCache_.constEnd())
     {
@@ -361,13 +442,31 @@ QSharedPointer<Design> LibraryHandler::getDesign(VLNV const& hierarchyRef)
 //-----------------------------------------------------------------------------
 bool LibraryHandler::isValid(VLNV const& vlnv)
 {    
-    auto it = documentCache_.constFind(vlnv);
-    if (it != documentCache_.cend())
+    QMutexLocker cacheLock(&cacheMutex_);
+
+    auto it = documentCache_.find(vlnv);
+    if (it == documentCache_.end())
     {
-        return documentCache_.value(vlnv).isValid;
+        return false;
     }
 
-    return false;
+    if (it->isValidated)
+    {
+        return it->isValid;
+    }
+
+    // Documents not yet reached by an ongoing validation are validated on demand.
+    DocumentInfo info = *it;
+    cacheLock.unlock();
+
+    // The validator reads the referenced documents through the cache, so the lock cannot be held.
+    QVector<TagData> documentTags;
+    validateCachedDocument(info, documentTags);
+    TagManager::getInstance().addNewTags(documentTags);
+
+    storeValidationResult(vlnv, info);
+
+    return info.isValid;
 }
 
 //-----------------------------------------------------------------------------
@@ -391,35 +490,64 @@ LibraryTreeModel* LibraryHandler::getTreeModel()
 //-----------------------------------------------------------------------------
 void LibraryHandler::onCheckLibraryIntegrity()
 {
+    if (validationMode_ == ValidationMode::Parallel)
+    {
+        checkIntegrityInParallel();
+        return;
+    }
+
+    // The workers of a parallel check are using the cache, so the documents would be validated twice.
+    if (validationWatcher_.isRunning())
+    {
+        messageChannel_->showStatusMessage(tr("Library integrity check is already in progress."));
+        return;
+    }
+
     messageChannel_->showStatusMessage(tr("Validating items. Please wait..."));
 
+    // A full check supersedes any ongoing background validation.
+    validationQueue_.clear();
+    validatedTags_.clear();
+
     checkResults_.documentCount = 0;
     checkResults_.fileCount = 0;
 
+    // The validator reads the referenced documents through the cache, so copies of the entries are validated.
     QVector<TagData> documentTags;
-    for (auto it = documentCache_.begin(); it != documentCache_.end(); ++it)
+    for (VLNV const& vlnv : getAllVLNVs())
     {
+        QMutexLocker cacheLock(&cacheMutex_);
+        auto it = documentCache_.constFind(vlnv);
+        if (it == documentCache_.cend())
+        {
+            continue;
+        }
+
+        DocumentInfo info = *it;
+        cacheLock.unlock();
+
         // TODO: Add model to cache only, if it is already previously cached.
         // Current hierarchy model forces all models to be loaded, but this should be changed.
-        QSharedPointer<Document> model = it->document;
-        if (model.isNull())
-        {
-            model = DocumentFileAccess::readDocument(it->path);
-            it->document = model;
-        }           
+        QSharedPointer<Document> model = getCachedDocument(vlnv);
 
         if (model.isNull() == false)
         {
             documentTags += (model->getTags());
+            storeDependentVLNVs(info, model->getDependentVLNVs());
         }
 
-        it->isValid = validateDocument(model, it->path);
-        if (it->isValid == false)
+        info.isValid = validateDocument(model, info.path);
+        info.isValidated = true;
+        if (info.isValid == false)
         {
             checkResults_.documentCount++;
         }
+
+        storeValidationResult(vlnv, info);
     }
 
+    loader_.saveIndex();
+
     TagManager& manager = TagManager::getInstance();
     manager.setTags(documentTags);
 
@@ -428,6 +556,14 @@ void LibraryHandler::onCheckLibraryIntegrity()
     messageChannel_->showStatusMessage(tr("Ready."));
 }
 
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::cancelValidation()
+//-----------------------------------------------------------------------------
+void LibraryHandler::cancelValidation()
+{
+    validationWatcher_.cancel();
+}
+
 //-----------------------------------------------------------------------------
 // Function: LibraryHandler::onEditItem()
 //-----------------------------------------------------------------------------
@@ -565,9 +701,14 @@ void LibraryHandler::removeObject(VLNV const& vlnv)
         return;
     }
 
-    QString path = documentCache_.find(vlnv)->path;
+    QMutexLocker cacheLock(&cacheMutex_);
+    auto info = documentCache_.find(vlnv);
+    QString path = info->path;
 
+    cacheStatistics_.residentSize -= info->estimatedSize;
+    accessOrder_.remove(info->lastAccess);
     documentCache_.remove(vlnv);
+    cacheLock.unlock();
 
     treeModel_.onRemoveVLNV(vlnv);
     hierarchyModel_.onRemoveVLNV(vlnv);
@@ -626,7 +767,16 @@ void LibraryHandler::onItemSaved(VLNV const& vlnv)
 
     // Replace overwritten item with new and check validity.
     QSharedPointer<Document> model = getModel(vlnv);
-    documentCache_.insert(vlnv, DocumentInfo(getPath(vlnv), model, validateDocument(model, getPath(vlnv))));
+    QString const path = getPath(vlnv);
+    bool const valid = validateDocument(model, path);
+
+    QMutexLocker cacheLock(&cacheMutex_);
+    DocumentInfo& info = documentCache_[vlnv];
+    info.path = path;
+    info.isValid = valid;
+    info.isValidated = true;
+    info.dependenciesKnown = false;
+    cacheDocument(vlnv, info, model);
     
     treeModel_.onDocumentUpdated(vlnv);
     hierarchyModel_.onDocumentUpdated(vlnv);
@@ -701,7 +851,15 @@ bool LibraryHandler::addObject(QSharedPointer<Document> model, QString const& fi
 
     TagManager::getInstance().addNewTags(model->getTags());
 
-    documentCache_.insert(model->getVlnv(), DocumentInfo(targetPath, model->clone(), validateDocument(model, targetPath)));
+    bool const valid = validateDocument(model, targetPath);
+
+    QMutexLocker cacheLock(&cacheMutex_);
+    DocumentInfo& info = documentCache_[model->getVlnv()];
+    info.path = targetPath;
+    info.isValid = valid;
+    info.isValidated = true;
+    info.dependenciesKnown = false;
+    cacheDocument(model->getVlnv(), info, model->clone());
 
     return true;
 }
@@ -711,7 +869,164 @@ bool LibraryHandler::addObject(QSharedPointer<Document> model, QString const& fi
 //-----------------------------------------------------------------------------
 void LibraryHandler::clearCache()
 {
+    validationQueue_.clear();
+    validatedTags_.clear();
+
+    QMutexLocker cacheLock(&cacheMutex_);
     documentCache_.clear();
+    accessOrder_.clear();
+    cacheStatistics_.residentSize = 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::getCachedDocument()
+//-----------------------------------------------------------------------------
+QSharedPointer<Document> LibraryHandler::getCachedDocument(VLNV const& vlnv)
+{
+    QMutexLocker cacheLock(&cacheMutex_);
+
+    auto info = documentCache_.find(vlnv);
+    if (info == documentCache_.end())
+    {
+        return QSharedPointer<Document>();
+    }
+
+    if (info->document.isNull() == false)
+    {
+        cacheStatistics_.hitCount++;
+        touchDocument(vlnv, *info);
+        return info->document;
+    }
+
+    cacheStatistics_.missCount++;
+    QString const path = info->path;
+    cacheLock.unlock();
+
+    // The file is read without the lock, so that other threads can use the cache in the meantime.
+    QSharedPointer<Document> document =
+        DocumentFileAccess::readDocument(path, DocumentFileAccess::ReadMode::Streaming);
+
+    cacheLock.relock();
+
+    // The document may have been removed, replaced or read by another thread while reading the file.
+    info = documentCache_.find(vlnv);
+    if (info == documentCache_.end() || info->path != path)
+    {
+        return document;
+    }
+
+    if (info->document.isNull() == false)
+    {
+        touchDocument(vlnv, *info);
+        return info->document;
+    }
+
+    cacheDocument(vlnv, *info, document);
+    return document;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::cacheDocument()
+//-----------------------------------------------------------------------------
+void LibraryHandler::cacheDocument(VLNV const& vlnv, DocumentInfo& info, QSharedPointer<Document> document)
+{
+    cacheStatistics_.residentSize -= info.estimatedSize;
+
+    info.document = document;
+    info.estimatedSize = 0;
+
+    if (document.isNull())
+    {
+        accessOrder_.remove(info.lastAccess);
+        return;
+    }
+
+    info.estimatedSize = QFileInfo(info.path).size() * MODEL_BYTES_PER_FILE_BYTE;
+    cacheStatistics_.residentSize += info.estimatedSize;
+
+    touchDocument(vlnv, info);
+    evictDocuments();
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::touchDocument()
+//-----------------------------------------------------------------------------
+void LibraryHandler::touchDocument(VLNV const& vlnv, DocumentInfo& info)
+{
+    accessOrder_.remove(info.lastAccess);
+
+    info.lastAccess = ++accessCounter_;
+    accessOrder_.insert(info.lastAccess, vlnv);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::storeDependentVLNVs()
+//-----------------------------------------------------------------------------
+void LibraryHandler::storeDependentVLNVs(DocumentInfo& info, QList<VLNV> const& dependentVLNVs)
+{
+    info.dependentVLNVs = dependentVLNVs;
+    info.dependenciesKnown = true;
+
+    loader_.setDependentVLNVs(info.path, dependentVLNVs);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::getDependentVLNVs()
+//-----------------------------------------------------------------------------
+QList<VLNV> LibraryHandler::getDependentVLNVs(VLNV const& vlnv)
+{
+    QMutexLocker cacheLock(&cacheMutex_);
+    auto it = documentCache_.constFind(vlnv);
+    if (it != documentCache_.cend() && it->dependenciesKnown)
+    {
+        return it->dependentVLNVs;
+    }
+    cacheLock.unlock();
+
+    QSharedPointer<Document const> document = getModelReadOnly(vlnv);
+    if (document.isNull())
+    {
+        return QList<VLNV>();
+    }
+
+    QList<VLNV> dependentVLNVs = document->getDependentVLNVs();
+
+    cacheLock.relock();
+    auto info = documentCache_.find(vlnv);
+    if (info != documentCache_.end())
+    {
+        storeDependentVLNVs(*info, dependentVLNVs);
+    }
+
+    return dependentVLNVs;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::evictDocuments()
+//-----------------------------------------------------------------------------
+void LibraryHandler::evictDocuments()
+{
+    if (cacheLimit_ <= 0 || cacheStatistics_.residentSize <= cacheLimit_)
+    {
+        return;
+    }
+
+    // Release down to three quarters of the limit, so that the next reads do not evict again right away.
+    // The most recently used model is being returned to a caller, so it is the last one kept.
+    qint64 const targetSize = cacheLimit_ - cacheLimit_ / 4;
+    while (cacheStatistics_.residentSize > targetSize && accessOrder_.size() > 1)
+    {
+        auto info = documentCache_.find(accessOrder_.first());
+        accessOrder_.erase(accessOrder_.begin());
+
+        if (info != documentCache_.end())
+        {
+            cacheStatistics_.residentSize -= info->estimatedSize;
+            info->estimatedSize = 0;
+            info->document.clear();
+            cacheStatistics_.evictionCount++;
+        }
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -723,7 +1038,13 @@ void LibraryHandler::loadAvailableVLNVs()
 
     // Read all items before validation.
     // Validation will check for VLNVs in the library, so they must be available before validation.    
-    for (auto const& target: loader_.parseLibrary(messageChannel_))
+    QVector<LibraryLoader::LoadTarget> const targets = loader_.parseLibrary(messageChannel_);
+
+    QMutexLocker reserveLock(&cacheMutex_);
+    documentCache_.reserve(documentCache_.size() + targets.size());
+    reserveLock.unlock();
+
+    for (auto const& target: targets)
     {
         if (contains(target.vlnv))
         {
@@ -732,7 +1053,12 @@ void LibraryHandler::loadAvailableVLNVs()
         }
         else
         {
-            documentCache_.insert(target.vlnv, DocumentInfo(target.path));
+            DocumentInfo info(target.path, QSharedPointer<Document>(), false, false);
+            info.dependentVLNVs = target.dependentVLNVs;
+            info.dependenciesKnown = target.dependenciesKnown;
+
+            QMutexLocker cacheLock(&cacheMutex_);
+            documentCache_.insert(target.vlnv, info);
         }
     }
     messageChannel_->showStatusMessage(tr("Ready."));
@@ -755,8 +1081,12 @@ void LibraryHandler::resetModels()
 //-----------------------------------------------------------------------------
 void LibraryHandler::showIntegrityResults() const
 {
+    QMutexLocker cacheLock(&cacheMutex_);
+    int const documentCount = documentCache_.size();
+    cacheLock.unlock();
+
     messageChannel_->showMessage(tr("========== Library integrity check complete =========="));
-    messageChannel_->showMessage(tr("Total library object count: %1").arg(documentCache_.size()));
+    messageChannel_->showMessage(tr("Total library object count: %1").arg(documentCount));
     messageChannel_->showMessage(tr("Total file count in the library: %1").arg(checkResults_.fileCount));
 
     // if errors were found then print the summary of error types
@@ -766,6 +1096,282 @@ void LibraryHandler::showIntegrityResults() const
     }
 }
 
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::startBackgroundValidation()
+//-----------------------------------------------------------------------------
+void LibraryHandler::startBackgroundValidation()
+{
+    checkResults_.documentCount = 0;
+    checkResults_.fileCount = 0;
+
+    validatedTags_.clear();
+    // The queue is processed from the back, so the documents are validated in the library order.
+    QList<VLNV> const libraryVLNVs = getAllVLNVs();
+    validationQueue_ = QVector<VLNV>(libraryVLNVs.crbegin(), libraryVLNVs.crend());
+
+    if (validationQueue_.isEmpty() == false)
+    {
+        messageChannel_->showStatusMessage(tr("Validating items in the background..."));
+        QTimer::singleShot(0, this, &LibraryHandler::onValidateNextDocuments);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::onValidateNextDocuments()
+//-----------------------------------------------------------------------------
+void LibraryHandler::onValidateNextDocuments()
+{
+    if (validationQueue_.isEmpty())
+    {
+        return;
+    }
+
+    QElapsedTimer batchTimer;
+    batchTimer.start();
+
+    while (validationQueue_.isEmpty() == false && batchTimer.elapsed() < VALIDATION_BATCH_TIME_MS)
+    {
+        VLNV const vlnv = validationQueue_.takeLast();
+
+        // Removed and re-saved documents need no validation.
+        QMutexLocker cacheLock(&cacheMutex_);
+        auto it = documentCache_.constFind(vlnv);
+        if (it == documentCache_.cend() || it->isValidated)
+        {
+            continue;
+        }
+
+        DocumentInfo info = *it;
+        cacheLock.unlock();
+
+        validateCachedDocument(info, validatedTags_);
+        storeValidationResult(vlnv, info);
+
+        if (info.isValid == false)
+        {
+            checkResults_.documentCount++;
+
+            treeModel_.onDocumentUpdated(vlnv);
+            hierarchyModel_.onDocumentUpdated(vlnv);
+        }
+    }
+
+    if (validationQueue_.isEmpty() == false)
+    {
+        QTimer::singleShot(0, this, &LibraryHandler::onValidateNextDocuments);
+        return;
+    }
+
+    loader_.saveIndex();
+
+    TagManager::getInstance().setTags(validatedTags_);
+    validatedTags_.clear();
+
+    showIntegrityResults();
+
+    messageChannel_->showStatusMessage(tr("Ready."));
+
+    emit validationFinished();
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::checkIntegrityInParallel()
+//-----------------------------------------------------------------------------
+void LibraryHandler::checkIntegrityInParallel()
+{
+    if (validationWatcher_.isRunning())
+    {
+        return;
+    }
+
+    messageChannel_->showStatusMessage(tr("Validating items. Please wait..."));
+
+    validationQueue_.clear();
+    validatedTags_.clear();
+
+    checkResults_.documentCount = 0;
+    checkResults_.fileCount = 0;
+
+    QVector<ValidationTask> tasks;
+    QMutexLocker cacheLock(&cacheMutex_);
+    tasks.reserve(documentCache_.size());
+    for (auto it = documentCache_.cbegin(); it != documentCache_.cend(); ++it)
+    {
+        tasks.append(ValidationTask{ it.key(), it->path, it->document });
+    }
+    cacheLock.unlock();
+
+    // The hash has no order, so the tasks are sorted to report the results in the same order on every run.
+    std::sort(tasks.begin(), tasks.end(),
+        [](ValidationTask const& first, ValidationTask const& second) { return first.vlnv < second.vlnv; });
+
+    parallelResultsPending_ = true;
+    validationWatcher_.setFuture(QtConcurrent::mapped(tasks, 
+        [this](ValidationTask const& task) { return validateInWorker(task); }));
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::stopParallelValidation()
+//-----------------------------------------------------------------------------
+void LibraryHandler::stopParallelValidation()
+{
+    if (validationWatcher_.isRunning() == false)
+    {
+        return;
+    }
+
+    parallelResultsPending_ = false;
+    validationWatcher_.cancel();
+    validationWatcher_.waitForFinished();
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::onParallelValidationFinished()
+//-----------------------------------------------------------------------------
+void LibraryHandler::onParallelValidationFinished()
+{
+    // The finished signal of a stopped run may arrive after a new run is started.
+    if (parallelResultsPending_ == false || validationWatcher_.isFinished() == false)
+    {
+        return;
+    }
+
+    parallelResultsPending_ = false;
+
+    // Results are in the task order. Cancelled documents are left for validation on demand.
+    QVector<TagData> documentTags;
+    QVector<VLNV> invalidDocuments;
+
+    QMutexLocker cacheLock(&cacheMutex_);
+    for (ValidationResult const& result : validationWatcher_.future().results())
+    {
+        // Documents replaced while validating are left for validation on demand.
+        auto it = documentCache_.find(result.vlnv);
+        if (it == documentCache_.end() || it->path != result.path)
+        {
+            continue;
+        }
+
+        it->isValid = result.isValid;
+        it->isValidated = true;
+        if (result.isValid == false)
+        {
+            checkResults_.documentCount++;
+            invalidDocuments.append(result.vlnv);
+        }
+
+        checkResults_.fileCount += result.fileCount;
+
+        if (result.isRead)
+        {
+            documentTags += result.tags;
+            storeDependentVLNVs(*it, result.dependentVLNVs);
+        }
+    }
+    cacheLock.unlock();
+
+    // The views may already show the documents, so they are updated with the found errors.
+    for (VLNV const& vlnv : invalidDocuments)
+    {
+        treeModel_.onDocumentUpdated(vlnv);
+        hierarchyModel_.onDocumentUpdated(vlnv);
+    }
+
+    if (validationWatcher_.isCanceled())
+    {
+        messageChannel_->showMessage(tr("Library integrity check was cancelled."));
+    }
+
+    loader_.saveIndex();
+
+    TagManager::getInstance().setTags(documentTags);
+
+    showIntegrityResults();
+
+    messageChannel_->showStatusMessage(tr("Ready."));
+
+    emit validationFinished();
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::validateInWorker()
+//-----------------------------------------------------------------------------
+LibraryHandler::ValidationResult LibraryHandler::validateInWorker(ValidationTask const& task)
+{
+    ValidationResult result;
+    result.vlnv = task.vlnv;
+    result.path = task.path;
+
+    // Models are not cached to keep the memory usage low.
+    QSharedPointer<Document> model = task.document;
+    if (model.isNull())
+    {
+        model = DocumentFileAccess::readDocument(task.path, DocumentFileAccess::ReadMode::Streaming);
+    }
+
+    if (model.isNull())
+    {
+        return result;
+    }
+
+    result.isRead = true;
+    result.tags = model->getTags();
+    result.dependentVLNVs = model->getDependentVLNVs();
+
+    if (QFileInfo(task.path).exists() == false)
+    {
+        return result;
+    }
+
+    // The validators hold per-document state, so each task has its own.
+    DocumentValidator validator(this);
+
+    result.isValid = validator.validate(model) && validateDependentVLNVReferencences(model) &&
+        validateDependentDirectories(model, task.path) &&
+        validateDependentFiles(model, task.path, result.fileCount);
+
+    return result;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::validateCachedDocument()
+//-----------------------------------------------------------------------------
+void LibraryHandler::validateCachedDocument(DocumentInfo& info, QVector<TagData>& tags)
+{
+    // Models read only for the validation are released afterwards to keep the memory usage low.
+    QSharedPointer<Document> model = info.document;
+    if (model.isNull())
+    {
+        model = DocumentFileAccess::readDocument(info.path, DocumentFileAccess::ReadMode::Streaming);
+    }
+
+    if (model.isNull() == false)
+    {
+        tags += model->getTags();
+        storeDependentVLNVs(info, model->getDependentVLNVs());
+    }
+
+    info.isValid = validateDocument(model, info.path);
+    info.isValidated = true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::storeValidationResult()
+//-----------------------------------------------------------------------------
+void LibraryHandler::storeValidationResult(VLNV const& vlnv, DocumentInfo const& info)
+{
+    QMutexLocker cacheLock(&cacheMutex_);
+
+    auto it = documentCache_.find(vlnv);
+    if (it != documentCache_.end() && it->path == info.path)
+    {
+        it->isValid = info.isValid;
+        it->isValidated = true;
+        it->dependentVLNVs = info.dependentVLNVs;
+        it->dependenciesKnown = info.dependenciesKnown;
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: LibraryData::removeFile()
 //-----------------------------------------------------------------------------
@@ -795,7 +1401,7 @@ bool LibraryHandler::validateDocument(QSharedPointer<Document> document, QString
 
     return documentValid && validateDependentVLNVReferencences(document) &&
         validateDependentDirectories(document, documentPath) &&
-        validateDependentFiles(document, documentPath);
+        validateDependentFiles(document, documentPath, checkResults_.fileCount);
 }
 
 //-----------------------------------------------------------------------------
@@ -808,6 +1414,7 @@ QVector<QString> LibraryHandler::findErrorsInDocument(QSharedPointer<Document> d
     {
         if (path.isEmpty() == false)
         {
+            QMutexLocker cacheLock(&cacheMutex_);
             auto it = std::find_if(documentCache_.cbegin(), documentCache_.cend(),
                 [path](DocumentInfo const& info) { return info.path == path;  });
             
@@ -901,7 +1508,8 @@ void LibraryHandler::findErrorsInDependentDirectories(QSharedPointer<const Docum
 //-----------------------------------------------------------------------------
 // Function: LibraryHandler::validateDependentFiles()
 //-----------------------------------------------------------------------------
-bool LibraryHandler::validateDependentFiles(QSharedPointer<Document> document, QString const& documentPath)
+bool LibraryHandler::validateDependentFiles(QSharedPointer<Document> document, QString const& documentPath,
+    int& fileCount)
 {
     for (QString const& filePath : document->getDependentFiles())
     {
@@ -911,7 +1519,7 @@ bool LibraryHandler::validateDependentFiles(QSharedPointer<Document> document, Q
         }
         else
         {
-            checkResults_.fileCount++;
+            fileCount++;
         }
     }
 
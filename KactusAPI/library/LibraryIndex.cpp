@@ -0,0 +1,248 @@
+//-----------------------------------------------------------------------------
+// File: LibraryIndex.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 17.10.2026
+//
+// Description:
+// Persistent index of the IP-XACT files found in the library.
+//-----------------------------------------------------------------------------
+
+#include "LibraryIndex.h"
+
+#include <QDataStream>
+#include <QDir>
+#include <QSaveFile>
+#include <QSet>
+#include <QSettings>
+
+namespace
+{
+    //! Identifier for the index file format.
+    const quint32 INDEX_MAGIC = 0x4B324C49;
+
+    //! Version of the index file format. Must be increased whenever the stored data changes.
+    const quint32 INDEX_VERSION = 2;
+
+    //! Writes a VLNV to the given stream.
+    void writeVLNV(QDataStream& stream, VLNV const& vlnv)
+    {
+        stream << static_cast<qint32>(vlnv.getType()) << vlnv.getVendor() << vlnv.getLibrary() <<
+            vlnv.getName() << vlnv.getVersion();
+    }
+
+    //! Reads a VLNV from the given stream.
+    VLNV readVLNV(QDataStream& stream)
+    {
+        qint32 type = VLNV::INVALID;
+        QString vendor;
+        QString library;
+        QString name;
+        QString version;
+        stream >> type >> vendor >> library >> name >> version;
+
+        return VLNV(static_cast<VLNV::IPXactType>(type), vendor, library, name, version);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryIndex::LibraryIndex()
+//-----------------------------------------------------------------------------
+LibraryIndex::LibraryIndex(QString const& indexPath):
+indexPath_(indexPath)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryIndex::load()
+//-----------------------------------------------------------------------------
+bool LibraryIndex::load()
+{
+    entries_.clear();
+    modified_ = false;
+
+    QFile indexFile(indexPath_.isEmpty() ? defaultIndexPath() : indexPath_);
+    if (indexFile.open(QFile::ReadOnly) == false)
+    {
+        return false;
+    }
+
+    QDataStream stream(&indexFile);
+    stream.setVersion(QDataStream::Qt_5_12);
+
+    quint32 magic = 0;
+    quint32 version = 0;
+    qint32 entryCount = 0;
+    stream >> magic >> version >> entryCount;
+
+    if (magic != INDEX_MAGIC || version != INDEX_VERSION || entryCount < 0)
+    {
+        return false;
+    }
+
+    entries_.reserve(entryCount);
+    for (qint32 i = 0; i < entryCount && stream.status() == QDataStream::Ok; ++i)
+    {
+        Entry entry;
+        stream >> entry.path >> entry.size >> entry.lastModified;
+        entry.vlnv = readVLNV(stream);
+
+        // Unknown dependencies are stored with a negative count.
+        qint32 dependencyCount = 0;
+        stream >> dependencyCount;
+        entry.dependenciesKnown = dependencyCount >= 0;
+        for (qint32 j = 0; j < dependencyCount && stream.status() == QDataStream::Ok; ++j)
+        {
+            entry.dependentVLNVs.append(readVLNV(stream));
+        }
+
+        entries_.insert(entry.path, entry);
+    }
+
+    // Discard a partially read index, it will be rebuilt on the next scan.
+    if (stream.status() != QDataStream::Ok)
+    {
+        entries_.clear();
+        return false;
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryIndex::save()
+//-----------------------------------------------------------------------------
+bool LibraryIndex::save()
+{
+    if (modified_ == false)
+    {
+        return true;
+    }
+
+    QString const filePath = indexPath_.isEmpty() ? defaultIndexPath() : indexPath_;
+    QDir().mkpath(QFileInfo(filePath).absolutePath());
+
+    QSaveFile indexFile(filePath);
+    if (indexFile.open(QFile::WriteOnly) == false)
+    {
+        return false;
+    }
+
+    QDataStream stream(&indexFile);
+    stream.setVersion(QDataStream::Qt_5_12);
+
+    stream << INDEX_MAGIC << INDEX_VERSION << static_cast<qint32>(entries_.size());
+    for (Entry const& entry : entries_)
+    {
+        stream << entry.path << entry.size << entry.lastModified;
+        writeVLNV(stream, entry.vlnv);
+
+        stream << (entry.dependenciesKnown ? static_cast<qint32>(entry.dependentVLNVs.size()) : qint32(-1));
+        for (VLNV const& dependency : entry.dependentVLNVs)
+        {
+            writeVLNV(stream, dependency);
+        }
+    }
+
+    modified_ = (indexFile.commit() == false);
+    return modified_ == false;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryIndex::findUpToDate()
+//-----------------------------------------------------------------------------
+LibraryIndex::Entry const* LibraryIndex::findUpToDate(QFileInfo const& fileInfo) const
+{
+    auto it = entries_.constFind(fileInfo.filePath());
+    if (it == entries_.cend() || it->size != fileInfo.size() || it->lastModified != modificationTime(fileInfo))
+    {
+        return nullptr;
+    }
+
+    return &it.value();
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryIndex::insert()
+//-----------------------------------------------------------------------------
+void LibraryIndex::insert(QFileInfo const& fileInfo, VLNV const& vlnv)
+{
+    Entry entry;
+    entry.path = fileInfo.filePath();
+    entry.size = fileInfo.size();
+    entry.lastModified = modificationTime(fileInfo);
+    entry.vlnv = vlnv;
+
+    entries_.insert(entry.path, entry);
+    modified_ = true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryIndex::setDependentVLNVs()
+//-----------------------------------------------------------------------------
+void LibraryIndex::setDependentVLNVs(QString const& path, QList<VLNV> const& dependentVLNVs)
+{
+    auto it = entries_.find(path);
+    if (it != entries_.end() && (it->dependenciesKnown == false || it->dependentVLNVs != dependentVLNVs))
+    {
+        it->dependentVLNVs = dependentVLNVs;
+        it->dependenciesKnown = true;
+        modified_ = true;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryIndex::retain()
+//-----------------------------------------------------------------------------
+void LibraryIndex::retain(QStringList const& paths)
+{
+    QSet<QString> const keptPaths(paths.cbegin(), paths.cend());
+
+    for (auto it = entries_.begin(); it != entries_.end(); )
+    {
+        if (keptPaths.contains(it.key()))
+        {
+            ++it;
+        }
+        else
+        {
+            it = entries_.erase(it);
+            modified_ = true;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryIndex::clear()
+//-----------------------------------------------------------------------------
+void LibraryIndex::clear()
+{
+    modified_ = modified_ || entries_.isEmpty() == false;
+    entries_.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryIndex::size()
+//-----------------------------------------------------------------------------
+int LibraryIndex::size() const
+{
+    return entries_.size();
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryIndex::defaultIndexPath()
+//-----------------------------------------------------------------------------
+QString LibraryIndex::defaultIndexPath()
+{
+    return QFileInfo(QSettings().fileName()).absolutePath() + QStringLiteral("/LibraryIndex.dat");
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryIndex::modificationTime()
+//-----------------------------------------------------------------------------
+qint64 LibraryIndex::modificationTime(QFileInfo const& fileInfo)
+{
+    return fileInfo.lastModified().toMSecsSinceEpoch();
+}
@@ -17,34 +17,122 @@
 #include <QSettings>
 #include <QXmlStreamReader>
 
+#include <QtConcurrent>
+
 //-----------------------------------------------------------------------------
 // Function: LibraryLoader::parseLibrary()
 //-----------------------------------------------------------------------------
-QVector<LibraryLoader::LoadTarget> LibraryLoader::parseLibrary(MessageMediator const* messageChannel) const
+QVector<LibraryLoader::LoadTarget> LibraryLoader::parseLibrary(MessageMediator const* messageChannel,
+    ScanMode mode)
 {
+    if (indexLoaded_ == false)
+    {
+        index_.load();
+        indexLoaded_ = true;
+    }
+
+    QFileInfoList const libraryFiles = findLibraryFiles();
+
+    // Only the files changed after the previous scan need to be read.
+    QStringList filePaths;
+    filePaths.reserve(libraryFiles.size());
+
+    QFileInfoList changedFiles;
+    for (QFileInfo const& fileInfo : libraryFiles)
+    {
+        filePaths.append(fileInfo.filePath());
+        if (index_.findUpToDate(fileInfo) == nullptr)
+        {
+            changedFiles.append(fileInfo);
+        }
+    }
+
+    QVector<ScanResult> scanResults;
+    if (mode == ScanMode::Parallel)
+    {
+        // Results are stored in the same order as the input files.
+        scanResults = QtConcurrent::blockingMapped<QVector<ScanResult> >(changedFiles,
+            [this](QFileInfo const& fileInfo) { return getDocumentVLNV(fileInfo.filePath()); });
+    }
+    else
+    {
+        scanResults.reserve(changedFiles.size());
+        for (QFileInfo const& fileInfo : changedFiles)
+        {
+            scanResults.append(getDocumentVLNV(fileInfo.filePath()));
+        }
+    }
+
+    for (int i = 0; i < changedFiles.size(); ++i)
+    {
+        // Files with problems are not indexed to have them read and reported again on the next scan.
+        ScanResult const& result = scanResults.at(i);
+        if (result.error.isEmpty() && result.notification.isEmpty())
+        {
+            index_.insert(changedFiles.at(i), result.vlnv);
+        }
+    }
+
+    index_.retain(filePaths);
+    index_.save();
+
     QVector<LoadTarget> vlnvPaths;
-    QStringList xmlFilter{ QStringLiteral("*.xml") };
+    vlnvPaths.reserve(libraryFiles.size());
 
-    for (QString const& location : QSettings().value(QStringLiteral("Library/ActiveLocations")).toStringList())
-    {        
-        QDirIterator fileIterator(location, xmlFilter, QDir::Files,
-            QDirIterator::Subdirectories | QDirIterator::FollowSymlinks);
+    int changedIndex = 0;
+    for (QFileInfo const& fileInfo : libraryFiles)
+    {
+        bool const scanned = changedIndex < changedFiles.size() &&
+            changedFiles.at(changedIndex).filePath() == fileInfo.filePath();
 
-        while (fileIterator.hasNext())
+        if (scanned)
         {
-            QString filePath(fileIterator.next());
+            ScanResult const& result = scanResults.at(changedIndex);
+            ++changedIndex;
+
+            if (result.error.isEmpty() == false)
+            {
+                messageChannel->showError(result.error);
+            }
+            if (result.notification.isEmpty() == false)
+            {
+                messageChannel->showMessage(result.notification);
+            }
 
-            VLNV vlnv = getDocumentVLNV(filePath, messageChannel);
-            if (vlnv.isValid())
+            if (result.vlnv.isValid())
             {
-                vlnvPaths.append(LoadTarget(vlnv, filePath));
+                vlnvPaths.append(LoadTarget(result.vlnv, fileInfo.filePath()));
             }
         }
+        else if (LibraryIndex::Entry const* entry = index_.findUpToDate(fileInfo);
+            entry != nullptr && entry->vlnv.isValid())
+        {
+            LoadTarget target(entry->vlnv, fileInfo.filePath());
+            target.dependentVLNVs = entry->dependentVLNVs;
+            target.dependenciesKnown = entry->dependenciesKnown;
+            vlnvPaths.append(target);
+        }
     }
 
     return vlnvPaths;
 }
 
+//-----------------------------------------------------------------------------
+// Function: LibraryLoader::setDependentVLNVs()
+//-----------------------------------------------------------------------------
+void LibraryLoader::setDependentVLNVs(QString const& path, QList<VLNV> const& dependentVLNVs)
+{
+    index_.setDependentVLNVs(path, dependentVLNVs);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryLoader::saveIndex()
+//-----------------------------------------------------------------------------
+void LibraryLoader::saveIndex()
+{
+    index_.save();
+}
+
 //-----------------------------------------------------------------------------
 // Function: LibraryLoader::clean()
 //-----------------------------------------------------------------------------
@@ -58,16 +146,41 @@ void LibraryLoader::clean(QStringList const& changedDirectories) const
     }
 }
 
+//-----------------------------------------------------------------------------
+// Function: LibraryLoader::findLibraryFiles()
+//-----------------------------------------------------------------------------
+QFileInfoList LibraryLoader::findLibraryFiles() const
+{
+    QFileInfoList libraryFiles;
+    QStringList xmlFilter{ QStringLiteral("*.xml") };
+
+    for (QString const& location : QSettings().value(QStringLiteral("Library/ActiveLocations")).toStringList())
+    {        
+        QDirIterator fileIterator(location, xmlFilter, QDir::Files,
+            QDirIterator::Subdirectories | QDirIterator::FollowSymlinks);
+
+        while (fileIterator.hasNext())
+        {
+            fileIterator.next();
+            libraryFiles.append(fileIterator.fileInfo());
+        }
+    }
+
+    return libraryFiles;
+}
+
 //-----------------------------------------------------------------------------
 // Function: LibraryLoader::getDocumentVLNV()
 //-----------------------------------------------------------------------------
-VLNV LibraryLoader::getDocumentVLNV(QString const& path, MessageMediator const* messageChannel) const
+LibraryLoader::ScanResult LibraryLoader::getDocumentVLNV(QString const& path) const
 {
+    ScanResult result;
+
     QFile documentFile(path);
     if (!documentFile.open(QFile::ReadOnly))
     {
-        messageChannel->showError(QObject::tr("File %1 could not be read.").arg(path));
-        return VLNV();
+        result.error = QObject::tr("File %1 could not be read.").arg(path);
+        return result;
     }
 
     QXmlStreamReader documentReader(&documentFile);
@@ -76,15 +189,15 @@ VLNV LibraryLoader::getDocumentVLNV(QString const& path, MessageMediator const*
     QString type = documentReader.qualifiedName().toString();
     if (type.startsWith(QStringLiteral("spirit:")))
     {
-        messageChannel->showMessage(QObject::tr("File %1 contains an IP-XACT description not compatible "
-            "with the supported standards and could not be read.").arg(path));
+        result.notification = QObject::tr("File %1 contains an IP-XACT description not compatible "
+            "with the supported standards and could not be read.").arg(path);
         documentFile.close();
-        return VLNV();
+        return result;
     }
 
     if (!type.startsWith(QStringLiteral("ipxact:")) && !type.startsWith(QStringLiteral("kactus2:")))
     {
-        return VLNV();
+        return result;
     }
 
     // Find the first element of the VLVN.
@@ -104,14 +217,13 @@ VLNV LibraryLoader::getDocumentVLNV(QString const& path, MessageMediator const*
 
     documentFile.close();
 
-    VLNV documentVLNV(VLNV::string2Type(type), vlnvString);
-    if (!documentVLNV.isValid())
+    result.vlnv = VLNV(VLNV::string2Type(type), vlnvString);
+    if (!result.vlnv.isValid())
     {
-        messageChannel->showError(QObject::tr("File %1 contains an invalid IP-XACT identifier %2.").arg(path,
-            vlnvString));
+        result.error = QObject::tr("File %1 contains an invalid IP-XACT identifier %2.").arg(path, vlnvString);
     }
 
-    return documentVLNV;
+    return result;
 }
 
 //-----------------------------------------------------------------------------
@@ -0,0 +1,457 @@
+//-----------------------------------------------------------------------------
+// File: MemoryMapIndex.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 17.10.2026
+//
+// Description:
+// Address index over the resolved registers and fields of the memory maps in a component.
+//-----------------------------------------------------------------------------
+
+#include <KactusAPI/include/MemoryMapIndex.h>
+
+#include <KactusAPI/include/ExpressionParser.h>
+
+#include <IPXACTmodels/Component/AddressBlock.h>
+#include <IPXACTmodels/Component/Component.h>
+#include <IPXACTmodels/Component/Field.h>
+#include <IPXACTmodels/Component/MemoryArray.h>
+#include <IPXACTmodels/Component/MemoryMap.h>
+#include <IPXACTmodels/Component/MemoryRemap.h>
+#include <IPXACTmodels/Component/ModeReference.h>
+#include <IPXACTmodels/Component/Register.h>
+#include <IPXACTmodels/Component/RegisterFile.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+    //-----------------------------------------------------------------------------
+    // Function: countElements()
+    //-----------------------------------------------------------------------------
+    quint64 countElements(QVector<quint64> const& dimensionSizes)
+    {
+        quint64 count = 1;
+        for (quint64 dimensionSize : dimensionSizes)
+        {
+            if (dimensionSize == 0)
+            {
+                return 0;
+            }
+
+            // The count saturates, since the expansion is limited far below it anyway.
+            if (count > std::numeric_limits<quint64>::max() / dimensionSize)
+            {
+                count = std::numeric_limits<quint64>::max();
+            }
+            else
+            {
+                count *= dimensionSize;
+            }
+        }
+
+        return count;
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: elementSuffix()
+    //-----------------------------------------------------------------------------
+    QString elementSuffix(QVector<quint64> const& dimensionSizes, quint64 elementIndex)
+    {
+        // The first dimension changes slowest in the address order.
+        QString suffix;
+        for (int i = dimensionSizes.size() - 1; i >= 0; --i)
+        {
+            suffix.prepend(QStringLiteral("[%1]").arg(elementIndex % dimensionSizes.at(i)));
+            elementIndex /= dimensionSizes.at(i);
+        }
+
+        return suffix;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryMapIndex::MemoryMapIndex()
+//-----------------------------------------------------------------------------
+MemoryMapIndex::MemoryMapIndex(QSharedPointer<ExpressionParser> expressionParser, quint64 elementLimit):
+expressionParser_(expressionParser),
+elementLimit_(elementLimit)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryMapIndex::build()
+//-----------------------------------------------------------------------------
+void MemoryMapIndex::build(QSharedPointer<Component> component, QString const& remapState)
+{
+    clear();
+
+    if (component.isNull())
+    {
+        return;
+    }
+
+    for (QSharedPointer<MemoryMap> memoryMap : *component->getMemoryMaps())
+    {
+        if (isPresent(memoryMap->getIsPresent()) == false)
+        {
+            continue;
+        }
+
+        addressUnitBits_ = valueOf(memoryMap->getAddressUnitBits());
+        if (addressUnitBits_ == 0)
+        {
+            addressUnitBits_ = 8;
+        }
+
+        QSharedPointer<MemoryMapBase> blockContainer = memoryMap;
+        if (remapState.isEmpty() == false)
+        {
+            for (QSharedPointer<MemoryRemap> remap : *memoryMap->getMemoryRemaps())
+            {
+                bool referencesState = remap->getRemapState() == remapState ||
+                    std::any_of(remap->getModeReferences()->cbegin(), remap->getModeReferences()->cend(),
+                        [&remapState](QSharedPointer<ModeReference> modeReference)
+                        { return modeReference->getReference() == remapState; });
+
+                if (referencesState && isPresent(remap->getIsPresent()))
+                {
+                    blockContainer = remap;
+                    break;
+                }
+            }
+        }
+
+        addMemoryBlocks(memoryMap, blockContainer);
+    }
+
+    // The evaluated values are only valid for the state of the component at build time.
+    values_.clear();
+
+    std::stable_sort(entries_.begin(), entries_.end(), [](Entry const& first, Entry const& second)
+        { return first.firstAddress < second.firstAddress; });
+
+    subtreeLastAddress_.resize(entries_.size());
+    buildNode(0, entries_.size());
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryMapIndex::clear()
+//-----------------------------------------------------------------------------
+void MemoryMapIndex::clear()
+{
+    values_.clear();
+    entries_.clear();
+    subtreeLastAddress_.clear();
+    expandedElements_ = 0;
+    truncatedItems_.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryMapIndex::size()
+//-----------------------------------------------------------------------------
+int MemoryMapIndex::size() const
+{
+    return entries_.size();
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryMapIndex::getTruncatedItems()
+//-----------------------------------------------------------------------------
+QStringList MemoryMapIndex::getTruncatedItems() const
+{
+    return truncatedItems_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryMapIndex::findAt()
+//-----------------------------------------------------------------------------
+QVector<MemoryMapIndex::Entry> MemoryMapIndex::findAt(quint64 address, QString const& memoryMapName) const
+{
+    return findInRange(address, address, memoryMapName);
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryMapIndex::findInRange()
+//-----------------------------------------------------------------------------
+QVector<MemoryMapIndex::Entry> MemoryMapIndex::findInRange(quint64 firstAddress, quint64 lastAddress,
+    QString const& memoryMapName) const
+{
+    QVector<Entry> found;
+    if (firstAddress <= lastAddress)
+    {
+        collect(0, entries_.size(), firstAddress, lastAddress, memoryMapName, found);
+    }
+
+    return found;
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryMapIndex::addMemoryBlocks()
+//-----------------------------------------------------------------------------
+void MemoryMapIndex::addMemoryBlocks(QSharedPointer<MemoryMap> memoryMap,
+    QSharedPointer<MemoryMapBase> blockContainer)
+{
+    for (QSharedPointer<MemoryBlockBase> block : *blockContainer->getMemoryBlocks())
+    {
+        QSharedPointer<AddressBlock> addressBlock = block.dynamicCast<AddressBlock>();
+        if (addressBlock.isNull() || isPresent(addressBlock->getIsPresent()) == false)
+        {
+            continue;
+        }
+
+        Entry entry;
+        entry.memoryMapName = memoryMap->name();
+        entry.addressBlockName = addressBlock->name();
+
+        addRegisterData(addressBlock->getRegisterData(), valueOf(addressBlock->getBaseAddress()), QString(),
+            entry);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryMapIndex::addRegisterData()
+//-----------------------------------------------------------------------------
+void MemoryMapIndex::addRegisterData(QSharedPointer<QList<QSharedPointer<RegisterBase> > > registerData,
+    quint64 baseAddress, QString const& namePrefix, Entry const& entry)
+{
+    for (QSharedPointer<RegisterBase> registerBase : *registerData)
+    {
+        if (isPresent(registerBase->getIsPresent()) == false)
+        {
+            continue;
+        }
+
+        QSharedPointer<Register> targetRegister = registerBase.dynamicCast<Register>();
+        QSharedPointer<RegisterFile> registerFile = registerBase.dynamicCast<RegisterFile>();
+
+        quint64 elementSize = 0;
+        if (targetRegister)
+        {
+            quint64 size = valueOf(targetRegister->getSize());
+            elementSize = std::max<quint64>((size + addressUnitBits_ - 1) / addressUnitBits_, 1);
+        }
+        else if (registerFile)
+        {
+            elementSize = valueOf(registerFile->getRange());
+        }
+        else
+        {
+            continue;
+        }
+
+        QSharedPointer<MemoryArray> memoryArray = registerBase->getMemoryArray();
+        quint64 stride = elementSize;
+        if (memoryArray && memoryArray->getStride().isEmpty() == false)
+        {
+            stride = valueOf(memoryArray->getStride());
+        }
+
+        QString itemName = namePrefix + registerBase->name();
+        QString itemPath = entry.memoryMapName + QLatin1Char('.') + entry.addressBlockName + QLatin1Char('.') +
+            itemName;
+
+        QVector<quint64> dimensionSizes = getDimensionSizes(memoryArray, registerBase->getDimension());
+        quint64 elementCount = countElements(dimensionSizes);
+
+        quint64 address = baseAddress + valueOf(registerBase->getAddressOffset());
+        for (quint64 elementIndex = 0; elementIndex < elementCount; ++elementIndex)
+        {
+            if (reserveElement(itemPath) == false)
+            {
+                break;
+            }
+
+            QString elementName = itemName + elementSuffix(dimensionSizes, elementIndex);
+            if (targetRegister)
+            {
+                Entry registerEntry = entry;
+                registerEntry.registerName = elementName;
+                addRegister(targetRegister, address, registerEntry);
+            }
+            else
+            {
+                addRegisterData(registerFile->getRegisterData(), address, elementName + QLatin1Char('.'), entry);
+            }
+
+            address += stride;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryMapIndex::addRegister()
+//-----------------------------------------------------------------------------
+void MemoryMapIndex::addRegister(QSharedPointer<Register> targetRegister, quint64 address, Entry entry)
+{
+    quint64 size = valueOf(targetRegister->getSize());
+    quint64 sizeInAddressUnits = std::max<quint64>((size + addressUnitBits_ - 1) / addressUnitBits_, 1);
+
+    entry.firstAddress = address;
+    entry.lastAddress = address + sizeInAddressUnits - 1;
+    entry.bitWidth = size;
+    entries_.append(entry);
+
+    for (QSharedPointer<Field> field : *targetRegister->getFields())
+    {
+        quint64 bitWidth = valueOf(field->getBitWidth());
+        if (bitWidth == 0 || isPresent(field->getIsPresent()) == false)
+        {
+            continue;
+        }
+
+        // The stride of field arrays is given in bits.
+        QSharedPointer<MemoryArray> memoryArray = field->getMemoryArray();
+        quint64 stride = bitWidth;
+        if (memoryArray && memoryArray->getStride().isEmpty() == false)
+        {
+            stride = valueOf(memoryArray->getStride());
+        }
+
+        QString fieldPath = entry.memoryMapName + QLatin1Char('.') + entry.addressBlockName + QLatin1Char('.') +
+            entry.registerName + QLatin1Char('.') + field->name();
+
+        QVector<quint64> dimensionSizes = getDimensionSizes(memoryArray, QString());
+        quint64 elementCount = countElements(dimensionSizes);
+
+        quint64 bitOffset = valueOf(field->getBitOffset());
+        for (quint64 elementIndex = 0; elementIndex < elementCount; ++elementIndex)
+        {
+            if (reserveElement(fieldPath) == false)
+            {
+                break;
+            }
+
+            Entry fieldEntry = entry;
+            fieldEntry.fieldName = field->name() + elementSuffix(dimensionSizes, elementIndex);
+            fieldEntry.bitOffset = bitOffset;
+            fieldEntry.bitWidth = bitWidth;
+            fieldEntry.firstAddress = address + bitOffset / addressUnitBits_;
+            fieldEntry.lastAddress = address + (bitOffset + bitWidth - 1) / addressUnitBits_;
+            entries_.append(fieldEntry);
+
+            bitOffset += stride;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryMapIndex::getDimensionSizes()
+//-----------------------------------------------------------------------------
+QVector<quint64> MemoryMapIndex::getDimensionSizes(QSharedPointer<MemoryArray> memoryArray,
+    QString const& dimension)
+{
+    QVector<quint64> dimensionSizes;
+    if (memoryArray)
+    {
+        for (QSharedPointer<MemoryArray::Dimension> arrayDimension : *memoryArray->getDimensions())
+        {
+            dimensionSizes.append(valueOf(arrayDimension->value_));
+        }
+    }
+    else if (dimension.isEmpty() == false)
+    {
+        dimensionSizes.append(valueOf(dimension));
+    }
+
+    return dimensionSizes;
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryMapIndex::reserveElement()
+//-----------------------------------------------------------------------------
+bool MemoryMapIndex::reserveElement(QString const& itemPath)
+{
+    if (expandedElements_ >= elementLimit_)
+    {
+        truncatedItems_.append(itemPath);
+        return false;
+    }
+
+    ++expandedElements_;
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryMapIndex::valueOf()
+//-----------------------------------------------------------------------------
+quint64 MemoryMapIndex::valueOf(QString const& expression)
+{
+    auto cachedValue = values_.constFind(expression);
+    if (cachedValue != values_.cend())
+    {
+        return cachedValue.value();
+    }
+
+    bool valid = false;
+    QString value = expressionParser_->parseExpression(expression, &valid);
+
+    quint64 result = valid ? value.toULongLong() : 0;
+    values_.insert(expression, result);
+    return result;
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryMapIndex::isPresent()
+//-----------------------------------------------------------------------------
+bool MemoryMapIndex::isPresent(QString const& isPresent)
+{
+    return isPresent.isEmpty() || valueOf(isPresent) == 1;
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryMapIndex::buildNode()
+//-----------------------------------------------------------------------------
+quint64 MemoryMapIndex::buildNode(int begin, int end)
+{
+    if (begin >= end)
+    {
+        return 0;
+    }
+
+    int middle = begin + (end - begin) / 2;
+
+    quint64 lastAddress = std::max({ entries_.at(middle).lastAddress, buildNode(begin, middle),
+        buildNode(middle + 1, end) });
+
+    subtreeLastAddress_[middle] = lastAddress;
+    return lastAddress;
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryMapIndex::collect()
+//-----------------------------------------------------------------------------
+void MemoryMapIndex::collect(int begin, int end, quint64 firstAddress, quint64 lastAddress,
+    QString const& memoryMapName, QVector<Entry>& found) const
+{
+    if (begin >= end)
+    {
+        return;
+    }
+
+    int middle = begin + (end - begin) / 2;
+
+    // No entry in the subtree reaches the searched range.
+    if (subtreeLastAddress_.at(middle) < firstAddress)
+    {
+        return;
+    }
+
+    collect(begin, middle, firstAddress, lastAddress, memoryMapName, found);
+
+    // The entries after the middle entry start at or after it, so they are only searched if it starts in range.
+    Entry const& middleEntry = entries_.at(middle);
+    if (middleEntry.firstAddress <= lastAddress)
+    {
+        if (middleEntry.lastAddress >= firstAddress &&
+            (memoryMapName.isEmpty() || middleEntry.memoryMapName == memoryMapName))
+        {
+            found.append(middleEntry);
+        }
+
+        collect(middle + 1, end, firstAddress, lastAddress, memoryMapName, found);
+    }
+}
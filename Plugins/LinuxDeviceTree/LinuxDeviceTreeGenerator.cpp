@@ -590,7 +590,7 @@ void LinuxDeviceTreeGenerator::writeSingleAddressBlock(QTextStream& outputStream
     quint64 const& itemBaseAddress, int addressSize, int rangeSize, QString& prefix) const
 {
     QString blockName = blockItem->getName();
-    quint64 address = blockItem->getAddress().toULongLong() + itemBaseAddress;
+    quint64 address = blockItem->getAddressValue() + itemBaseAddress;
     QString addressString = QString::number(address, 16);
 
     QString status = getStatus(blockItem);
@@ -606,7 +606,7 @@ void LinuxDeviceTreeGenerator::writeSingleAddressBlock(QTextStream& outputStream
     General::Usage blockUsage = blockItem->getUsage();
     if (blockUsage == General::REGISTER)
     {
-        writeRegister(outputStream, address, blockItem->getRange().toULongLong(), addressSize, rangeSize, prefix);
+        writeRegister(outputStream, address, blockItem->getRangeValue(), addressSize, rangeSize, prefix);
     }
     else if (blockUsage == General::MEMORY)
     {
@@ -57,7 +57,8 @@ void MemoryViewGenerator::generate(QSharedPointer<Component> topComponent, QStri
     QSharedPointer<ConnectivityGraph> graph = graphFactory_.createConnectivityGraph(topComponent, activeView);
     MasterSlavePathSearch searchAlgorithm;
 
-    writeFile(outputPath, searchAlgorithm.findMasterSlavePaths(graph, true));
+    writeFile(outputPath,
+        searchAlgorithm.findMasterSlavePaths(graph, true, MasterSlavePathSearch::SearchMode::Parallel));
 }
 
 //-----------------------------------------------------------------------------
@@ -78,12 +79,12 @@ void MemoryViewGenerator::writeFile(QString const& outputPath,
 
     foreach (QVector<QSharedPointer<const ConnectivityInterface> > path, masterRoutes)
     {        
-        int addressOffset = path.first()->getBaseAddress().toInt();
+        quint64 addressOffset = path.first()->getBaseAddress().toULongLong();
         foreach (QSharedPointer<const ConnectivityInterface> inter, path)
         {
             if (inter->getMode() == General::MIRRORED_SLAVE)
             {
-                addressOffset += inter->getRemapAddress().toInt();
+                addressOffset += inter->getRemapAddress().toULongLong();
             }
         }
 
@@ -101,12 +102,13 @@ void MemoryViewGenerator::writeFile(QString const& outputPath,
 //-----------------------------------------------------------------------------
 // Function: MemoryViewGenerator::writeItem()
 //-----------------------------------------------------------------------------
-void MemoryViewGenerator::writeItem(QSharedPointer<MemoryItem> item, int addressOffset, QTextStream& outputStream)
+void MemoryViewGenerator::writeItem(QSharedPointer<MemoryItem> item, quint64 addressOffset,
+    QTextStream& outputStream)
 {
     if (item)
     {
         outputStream << item->getIdentifier() << ";" << item->getType() << ";" <<
-            "0x" + QString::number(addressOffset + item->getAddress().toInt(), 16) << ";" << 
+            "0x" + QString::number(addressOffset + item->getAddressValue(), 16) << ";" << 
             item->getRange() << ";" << item->getWidth() << ";" << item->getSize() << ";" <<
             item->getOffset() << ";" << Qt::endl;
 
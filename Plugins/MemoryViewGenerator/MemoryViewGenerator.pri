@@ -14,10 +14,12 @@ HEADERS += \
     ./memoryviewgenerator_global.h \
     ./MemoryViewGeneratorPlugin.h \
     ../PluginSystem/GeneratorPlugin/GenerationControl.h \
+    ../PluginSystem/GeneratorPlugin/OutputFileSink.h \
     ../PluginSystem/GeneratorPlugin/OutputControl.h \
     ../PluginSystem/GeneratorPlugin/ViewSelection.h \
     ../common/HDLParser/MetaComponent.h \
     ../common/HDLParser/MetaDesign.h \
+    ../common/HDLParser/ReadOnlyLibraryView.h \
     ../common/HDLParser/MetaInstance.h \
     ../../IPXACTmodels/utilities/ComponentSearch.h \
     ../../IPXACTmodels/utilities/Search.h
@@ -32,10 +34,12 @@ SOURCES += \
     ./MemoryViewGenerator.cpp \
     ./MemoryViewGeneratorPlugin.cpp \
     ../PluginSystem/GeneratorPlugin/GenerationControl.cpp \
+    ../PluginSystem/GeneratorPlugin/OutputFileSink.cpp \
     ../PluginSystem/GeneratorPlugin/OutputControl.cpp \
     ../PluginSystem/GeneratorPlugin/ViewSelection.cpp \
     ../common/HDLParser/MetaComponent.cpp \
     ../common/HDLParser/MetaDesign.cpp \
+    ../common/HDLParser/ReadOnlyLibraryView.cpp \
     ../common/HDLParser/MetaInstance.cpp \
     ../../IPXACTmodels/utilities/ComponentSearch.cpp
 RESOURCES += MemoryViewGenerator.qrc
@@ -10,8 +10,10 @@ HEADERS += ../../IPXACTmodels/utilities/ComponentSearch.h \
     ../common/HDLParser/HDLParserCommon.h \
     ../common/HDLParser/MetaComponent.h \
     ../common/HDLParser/MetaDesign.h \
+    ../common/HDLParser/ReadOnlyLibraryView.h \
     ../common/HDLParser/MetaInstance.h \
     ../PluginSystem/GeneratorPlugin/GenerationControl.h \
+    ../PluginSystem/GeneratorPlugin/OutputFileSink.h \
     ../PluginSystem/GeneratorPlugin/OutputControl.h \
     ../PluginSystem/GeneratorPlugin/ViewSelection.h \
     ../PluginSystem/GeneratorPlugin/MessagePasser.h \
@@ -27,8 +29,10 @@ SOURCES += ../../IPXACTmodels/utilities/ComponentSearch.cpp \
     ./ModelSimGeneratorPlugin.cpp \
     ../common/HDLParser/MetaComponent.cpp \
     ../common/HDLParser/MetaDesign.cpp \
+    ../common/HDLParser/ReadOnlyLibraryView.cpp \
     ../common/HDLParser/MetaInstance.cpp \
     ../PluginSystem/GeneratorPlugin/GenerationControl.cpp \
+    ../PluginSystem/GeneratorPlugin/OutputFileSink.cpp \
     ../PluginSystem/GeneratorPlugin/MessagePasser.cpp \
     ../PluginSystem/GeneratorPlugin/OutputControl.cpp \
     ../PluginSystem/GeneratorPlugin/ViewSelection.cpp \
@@ -5,7 +5,7 @@
 TEMPLATE = lib
 TARGET = ModelSimGenerator
 
-QT += core xml widgets gui
+QT += core xml widgets gui concurrent
 CONFIG += c++11 plugin release
 
 DEFINES += MODELSIMGENERATOR_LIB
@@ -204,6 +204,8 @@ void ModelSimGeneratorPlugin::runGenerator(IPluginUtility* utility, QSharedPoint
 
     configuration->getOutputControl()->setOutputPath(outputDirectory);
 
+    // Nothing is previewed on the command line, so the content is only streamed to the files.
+    configuration->setPreviewsEnabled(false);
     configuration->parseDocuments();
 
     QString warning;
@@ -29,6 +29,14 @@ void ModelSimDocument::write(QString const& outputDirectory)
     fileContent_.clear();
     QTextStream outputStream(&fileContent_);
 
+    writeTo(outputStream, outputDirectory);
+}
+
+//-----------------------------------------------------------------------------
+// Function: ModelSimDocument::writeTo()
+//-----------------------------------------------------------------------------
+void ModelSimDocument::writeTo(QTextStream& outputStream, QString const& outputDirectory)
+{
     writer_->write(outputStream, outputDirectory);
 }
 
@@ -37,6 +37,14 @@ struct ModelSimDocument : public GenerationOutput
      *      @param [in] outputDirectory         The possible output directory.
      */
 	void write(QString const& outputDirectory);
+
+    /*!
+     *  Writes the content directly to a stream.
+     *
+     *      @param [in] outputStream            The stream to write to.
+     *      @param [in] outputDirectory         The possible output directory.
+     */
+    void writeTo(QTextStream& outputStream, QString const& outputDirectory);
     
     /*!
      *  Finds position for body text highlight in document, if any exists.
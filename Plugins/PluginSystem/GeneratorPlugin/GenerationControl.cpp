@@ -10,6 +10,7 @@
 //-----------------------------------------------------------------------------
 
 #include "GenerationControl.h"
+#include "OutputFileSink.h"
 
 #include <KactusAPI/include/MessageMediator.h>
 
@@ -109,21 +110,33 @@ bool GenerationControl::writeDocuments()
         // Form the path from the determined output path plus determined file name.
         QString absFilePath = outputControl_->getOutputPath() + "/" + output->fileName_;
 
-        // Try to open the file.
-        QFile outputFile(absFilePath); 
-        if (!outputFile.open(QIODevice::WriteOnly))
+        // Try to open the file. Lines only recording the generation time do not make the content different.
+        OutputFileSink outputFile(absFilePath, [output](QByteArray const& line)
+            { return output->isGenerationStamp(line); });
+        if (!outputFile.openForWriting())
         {
             input_.messages->showError(QObject::tr("Could not open output file for writing: %1").arg(absFilePath));
             fails = true;
             continue;
         }
 
-        // Put the content to the file and close it.
+        // Stream the content to the file. The file is replaced only if its content changes.
         QTextStream outputStream(&outputFile);
+        output->writeTo(outputStream, outputControl_->getOutputPath());
+        outputStream.flush();
 
-        outputStream << output->fileContent_;
-
-        outputFile.close();
+        OutputFileSink::Result result = outputFile.commit();
+        if (result == OutputFileSink::Result::Failed)
+        {
+            input_.messages->showError(QObject::tr("Could not write output file %1: %2").arg(
+                absFilePath, outputFile.errorString()));
+            fails = true;
+            continue;
+        }
+        else if (result == OutputFileSink::Result::Unchanged)
+        {
+            input_.messages->showMessage(QObject::tr("Output file is unchanged: %1").arg(absFilePath));
+        }
 
         if (viewSelection_->getSaveToFileset())
         {
@@ -200,6 +213,14 @@ void GenerationControl::parseDocuments()
     }
 }
 
+//-----------------------------------------------------------------------------
+// Function: GenerationControl::setPreviewsEnabled()
+//-----------------------------------------------------------------------------
+void GenerationControl::setPreviewsEnabled(bool enabled)
+{
+    previewsEnabled_ = enabled;
+}
+
 //-----------------------------------------------------------------------------
 // Function: GenerationControl::initializeDocuments()
 //-----------------------------------------------------------------------------
@@ -216,7 +237,8 @@ void GenerationControl::initializeDocuments()
 
         // Parse the design hierarchy.
         QList<QSharedPointer<MetaDesign> > designs =
-            MetaDesign::parseHierarchy(library_, input_, viewSelection_->getView());
+            MetaDesign::parseHierarchy(library_, input_, viewSelection_->getView(),
+                MetaDesign::ParseMode::Parallel);
 
         // No results -> return.
         if (designs.size() < 1)
@@ -240,8 +262,8 @@ void GenerationControl::initializeDocuments()
                 continue;
             }
 
-            // Write the contents to a file.
-            output->write(outputControl_->getOutputPath());
+            // Write the contents for preview.
+            writePreview(output);
 
             // Append to the list of proposed outputs.
             outputControl_->getOutputs()->append(output);
@@ -269,7 +291,7 @@ void GenerationControl::initializeDocuments()
         // Write outputs.
         input_.messages->showMessage(QObject::tr("Writing content for preview %1 %2.").arg(locale.toString(QDate::currentDate(),
             locale.dateFormat(QLocale::ShortFormat)), locale.toString(QTime::currentTime(), locale.timeFormat(QLocale::ShortFormat))));
-        output->write(outputControl_->getOutputPath());
+        writePreview(output);
 
         // Append to the list of proposed outputs.
         outputControl_->getOutputs()->append(output);
@@ -290,7 +312,8 @@ void GenerationControl::reInitializeDocuments(
         //! Component side works already, design configuration does not.
 
         QList<QSharedPointer<MetaDesign> > designs =
-            MetaDesign::parseHierarchy(library_, input_, viewSelection_->getView());
+            MetaDesign::parseHierarchy(library_, input_, viewSelection_->getView(),
+                MetaDesign::ParseMode::Parallel);
 
         QList<QSharedPointer<GenerationOutput> > documents = factory_->prepareDesign(designs);
         for (auto output : documents)
@@ -308,7 +331,7 @@ void GenerationControl::reInitializeDocuments(
                     matchingMeta->getTopInstance()->getModuleName());
                 output->fileName_ = matchingMetaOutput->fileName_;
 
-                output->write(outputControl_->getOutputPath());
+                writePreview(output);
                 newGenerations.append(output);
             }
         }
@@ -331,7 +354,7 @@ void GenerationControl::reInitializeDocuments(
                 if (output)
                 {
                     output->fileName_ = selection->fileName_;
-                    output->write(outputControl_->getOutputPath());
+                    writePreview(output);
                     newGenerations.append(output);
                 }
             }
@@ -478,6 +501,17 @@ QSharedPointer<QList<QSharedPointer<View> > > GenerationControl::findPossibleVie
     return views;
 }
 
+//-----------------------------------------------------------------------------
+// Function: GenerationControl::writePreview()
+//-----------------------------------------------------------------------------
+void GenerationControl::writePreview(QSharedPointer<GenerationOutput> output) const
+{
+    if (previewsEnabled_)
+    {
+        output->write(outputControl_->getOutputPath());
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: GenerationControl::defaultOutputPath()
 //-----------------------------------------------------------------------------
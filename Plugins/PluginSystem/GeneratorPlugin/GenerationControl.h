@@ -50,6 +50,7 @@ public:
 
     /*!
      *  Tries to write documents to file system. Returns true if succeeds, else false.
+     *  The documents are streamed to the files, and files that already have the same content are not rewritten.
      */
     bool writeDocuments();
     
@@ -69,6 +70,14 @@ public:
      *  Parses the documents so that we know what will be generated.
      */
     void parseDocuments();
+
+    /*!
+     *  Sets if the content of the parsed documents is written for preview. Without previews the content is
+     *  only written when the documents are written to files.
+     *
+     *      @param [in] enabled     If true, parsing writes the content of the documents for preview.
+     */
+    void setPreviewsEnabled(bool enabled);
 	
     /*!
      *  Gets the view selection data.
@@ -147,6 +156,13 @@ private:
      */
     QSharedPointer<GenerationOutput> getMatchingMetaDesignOutput(QSharedPointer<GenerationOutput> output) const;
 
+    /*!
+     *  Writes the content of a document for preview, if previews are enabled.
+     *
+     *      @param [in] output      The document to write.
+     */
+    void writePreview(QSharedPointer<GenerationOutput> output) const;
+
     /*!
      *  Returns the default output path.     
      */
@@ -187,6 +203,8 @@ private:
     QSharedPointer<OutputControl> outputControl_;
     //! The view selection configuration.
     QSharedPointer<ViewSelection> viewSelection_;
+    //! If true, the content of the parsed documents is written for preview.
+    bool previewsEnabled_ = true;
 };
 
 #endif // GENERATIONCONTROL_H
@@ -12,9 +12,11 @@
 #ifndef OUTPUTCONTROL_H
 #define OUTPUTCONTROL_H
 
+#include <QByteArray>
 #include <QString>
 #include <QMap>
 #include <QSharedPointer>
+#include <QTextStream>
 
 #include "ViewSelection.h"
 
@@ -44,6 +46,31 @@ struct GenerationOutput
      *  Writes the content.
      */
 	virtual void write(QString const& outputDirectory) = 0;
+
+    /*!
+     *  Writes the content directly to a stream without storing it in fileContent_.
+     *  By default, writes the content stored by write().
+     *
+     *      @param [in] outputStream            The stream to write to.
+     *      @param [in] outputDirectory         The possible output directory.
+     */
+    virtual void writeTo(QTextStream& outputStream, QString const& /*outputDirectory*/)
+    {
+        outputStream << fileContent_;
+    }
+
+    /*!
+     *  Checks if a line of the content only records when the content was generated. These lines are
+     *  ignored when checking if an existing file has the same content.
+     *
+     *      @param [in] line                    The line to check, including its line break.
+     *
+     *      @return True, if the line is a generation stamp, otherwise false.
+     */
+    virtual bool isGenerationStamp(QByteArray const& /*line*/) const
+    {
+        return false;
+    }
     
     /*!
      *  Finds position for body text highlight in document, if any exists.
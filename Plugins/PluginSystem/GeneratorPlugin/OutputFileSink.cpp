@@ -0,0 +1,162 @@
+//-----------------------------------------------------------------------------
+// File: OutputFileSink.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 17.10.2026
+//
+// Description:
+// Buffered file output that leaves files with unchanged content untouched.
+//-----------------------------------------------------------------------------
+
+#include "OutputFileSink.h"
+
+#include <QFile>
+
+//-----------------------------------------------------------------------------
+// Function: OutputFileSink::OutputFileSink()
+//-----------------------------------------------------------------------------
+OutputFileSink::OutputFileSink(QString const& filePath, LineFilter ignoredLines):
+QIODevice(),
+file_(filePath),
+ignoredLines_(ignoredLines),
+contentHash_(QCryptographicHash::Sha1),
+partialLine_()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: OutputFileSink::openForWriting()
+//-----------------------------------------------------------------------------
+bool OutputFileSink::openForWriting()
+{
+    if (file_.open(QIODevice::WriteOnly) == false)
+    {
+        setErrorString(file_.errorString());
+        return false;
+    }
+
+    contentHash_.reset();
+    partialLine_.clear();
+
+    return open(QIODevice::WriteOnly);
+}
+
+//-----------------------------------------------------------------------------
+// Function: OutputFileSink::commit()
+//-----------------------------------------------------------------------------
+OutputFileSink::Result OutputFileSink::commit()
+{
+    if (isOpen() == false)
+    {
+        return Result::Failed;
+    }
+
+    close();
+
+    if (partialLine_.isEmpty() == false)
+    {
+        addLine(contentHash_, partialLine_);
+        partialLine_.clear();
+    }
+
+    if (file_.error() != QFileDevice::NoError)
+    {
+        setErrorString(file_.errorString());
+        file_.cancelWriting();
+        return Result::Failed;
+    }
+
+    // The temporary file is removed without touching the target file, if the content is the same.
+    if (existingContentHash() == contentHash_.result())
+    {
+        file_.cancelWriting();
+        return Result::Unchanged;
+    }
+
+    if (file_.commit() == false)
+    {
+        setErrorString(file_.errorString());
+        return Result::Failed;
+    }
+
+    return Result::Written;
+}
+
+//-----------------------------------------------------------------------------
+// Function: OutputFileSink::isSequential()
+//-----------------------------------------------------------------------------
+bool OutputFileSink::isSequential() const
+{
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: OutputFileSink::readData()
+//-----------------------------------------------------------------------------
+qint64 OutputFileSink::readData(char* /*data*/, qint64 /*maxSize*/)
+{
+    return -1;
+}
+
+//-----------------------------------------------------------------------------
+// Function: OutputFileSink::writeData()
+//-----------------------------------------------------------------------------
+qint64 OutputFileSink::writeData(char const* data, qint64 maxSize)
+{
+    if (file_.write(data, maxSize) != maxSize)
+    {
+        setErrorString(file_.errorString());
+        return -1;
+    }
+
+    partialLine_.append(data, maxSize);
+
+    qsizetype lineStart = 0;
+    qsizetype lineEnd = partialLine_.indexOf('\n');
+    while (lineEnd != -1)
+    {
+        addLine(contentHash_, partialLine_.sliced(lineStart, lineEnd + 1 - lineStart));
+
+        lineStart = lineEnd + 1;
+        lineEnd = partialLine_.indexOf('\n', lineStart);
+    }
+
+    partialLine_.remove(0, lineStart);
+
+    return maxSize;
+}
+
+//-----------------------------------------------------------------------------
+// Function: OutputFileSink::addLine()
+//-----------------------------------------------------------------------------
+void OutputFileSink::addLine(QCryptographicHash& hash, QByteArray const& line) const
+{
+    if (ignoredLines_ && ignoredLines_(line))
+    {
+        return;
+    }
+
+    hash.addData(line);
+}
+
+//-----------------------------------------------------------------------------
+// Function: OutputFileSink::existingContentHash()
+//-----------------------------------------------------------------------------
+QByteArray OutputFileSink::existingContentHash() const
+{
+    QFile existingFile(file_.fileName());
+    if (existingFile.open(QIODevice::ReadOnly) == false)
+    {
+        return QByteArray();
+    }
+
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    while (existingFile.atEnd() == false)
+    {
+        addLine(hash, existingFile.readLine());
+    }
+
+    return hash.result();
+}
@@ -0,0 +1,120 @@
+//-----------------------------------------------------------------------------
+// File: OutputFileSink.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 17.10.2026
+//
+// Description:
+// Buffered file output that leaves files with unchanged content untouched.
+//-----------------------------------------------------------------------------
+
+#ifndef OUTPUTFILESINK_H
+#define OUTPUTFILESINK_H
+
+#include <QByteArray>
+#include <QCryptographicHash>
+#include <QIODevice>
+#include <QSaveFile>
+#include <QString>
+
+#include <functional>
+
+//-----------------------------------------------------------------------------
+//! Buffered file output that leaves files with unchanged content untouched.
+//
+// The written content is streamed to a temporary file next to the target file and hashed line by line. When
+// committed, the hash is compared with the hash of the existing file. If they match, the temporary file is
+// discarded and the existing file, including its modification time, is kept. Otherwise the temporary file
+// replaces the target file. Lines accepted by the ignored line filter are left out of both hashes.
+//-----------------------------------------------------------------------------
+class OutputFileSink : public QIODevice
+{
+public:
+
+    //! The results of committing the output.
+    enum class Result
+    {
+        Written,    //!< The file was created or its content was replaced.
+        Unchanged,  //!< The file already had the same content and was not rewritten.
+        Failed      //!< The file could not be written.
+    };
+
+    //! Filter for the lines ignored in the content comparison. The lines include their line break.
+    using LineFilter = std::function<bool(QByteArray const& line)>;
+
+    /*!
+     *  The constructor.
+     *
+     *      @param [in] filePath        The path of the target file.
+     *      @param [in] ignoredLines    Filter for the lines ignored in the content comparison. May be empty.
+     */
+    OutputFileSink(QString const& filePath, LineFilter ignoredLines = LineFilter());
+
+    //! The destructor. Discards the output, if it was not committed.
+    ~OutputFileSink() override = default;
+
+    // Disable copying.
+    OutputFileSink(OutputFileSink const& rhs) = delete;
+    OutputFileSink& operator=(OutputFileSink const& rhs) = delete;
+
+    /*!
+     *  Opens the output for writing.
+     *
+     *      @return True, if the output could be opened, otherwise false.
+     */
+    bool openForWriting();
+
+    /*!
+     *  Finishes the output and replaces the target file, if its content has changed.
+     *
+     *      @return The result of the output.
+     */
+    Result commit();
+
+    //! The output can only be written sequentially.
+    bool isSequential() const override;
+
+protected:
+
+    //! Reading is not supported.
+    qint64 readData(char* data, qint64 maxSize) override;
+
+    //! Writes the data to the temporary file and adds its complete lines to the content hash.
+    qint64 writeData(char const* data, qint64 maxSize) override;
+
+private:
+
+    /*!
+     *  Adds a line to a content hash, unless the line is ignored.
+     *
+     *      @param [in] hash    The hash to add to.
+     *      @param [in] line    The line to add.
+     */
+    void addLine(QCryptographicHash& hash, QByteArray const& line) const;
+
+    /*!
+     *  Calculates the content hash of the existing target file.
+     *
+     *      @return The content hash, or an empty array if the file could not be read.
+     */
+    QByteArray existingContentHash() const;
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The temporary file replacing the target file on commit.
+    QSaveFile file_;
+
+    //! Filter for the lines ignored in the content comparison.
+    LineFilter ignoredLines_;
+
+    //! The hash of the written content.
+    QCryptographicHash contentHash_;
+
+    //! The written data after the last complete line.
+    QByteArray partialLine_;
+};
+
+#endif // OUTPUTFILESINK_H
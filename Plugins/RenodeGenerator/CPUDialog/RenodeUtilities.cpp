@@ -63,7 +63,7 @@ namespace
         QMultiMap<quint64, QSharedPointer<MemoryItem>> blockItems;
         for (auto const& subItem : mapItem->getChildItems())
         {
-            blockItems.insert(subItem->getAddress().toULongLong(), subItem);
+            blockItems.insert(subItem->getAddressValue(), subItem);
         }
 
         return blockItems;
@@ -105,8 +105,8 @@ namespace
         QSharedPointer<MemoryItem> firstBlock = currentMemoryBlock.first();
         QSharedPointer<MemoryItem> lastBlock = currentMemoryBlock.last();
 
-        quint64 offset = mapBaseAddress + firstBlock->getAddress().toULongLong();
-        qint64 endAddress = mapBaseAddress + lastBlock->getAddress().toLongLong() + lastBlock->getRange().toLongLong() - 1;
+        quint64 offset = mapBaseAddress + firstBlock->getAddressValue();
+        qint64 endAddress = mapBaseAddress + lastBlock->getAddressValue() + lastBlock->getRangeValue() - 1;
 
         quint64 size = endAddress - offset + 1;
 
@@ -133,8 +133,8 @@ namespace
         QSharedPointer<MemoryItem> firstBlock = currentMemoryBlock.first();
         QSharedPointer<MemoryItem> lastBlock = currentMemoryBlock.last();
 
-        quint64 offset = mapBaseAddress + firstBlock->getAddress().toULongLong();
-        qint64 endAddress = mapBaseAddress + lastBlock->getAddress().toLongLong() + lastBlock->getRange().toLongLong() - 1;
+        quint64 offset = mapBaseAddress + firstBlock->getAddressValue();
+        qint64 endAddress = mapBaseAddress + lastBlock->getAddressValue() + lastBlock->getRangeValue() - 1;
 
         quint64 size = endAddress - offset + 1;
 
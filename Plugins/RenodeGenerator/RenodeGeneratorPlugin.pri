@@ -13,11 +13,13 @@ HEADERS += ./RenodeSettingsModel.h \
     ./RenodeSettingsWidget.h \
     ./RenodeGeneratorPlugin.h \
     ../PluginSystem/GeneratorPlugin/GenerationControl.h \
+    ../PluginSystem/GeneratorPlugin/OutputFileSink.h \
     ../PluginSystem/GeneratorPlugin/OutputControl.h \
     ../PluginSystem/GeneratorPlugin/ViewSelection.h \
     ../PluginSystem/GeneratorPlugin/MessagePasser.h \
     ../common/HDLParser/MetaComponent.h \
     ../common/HDLParser/MetaDesign.h \
+    ../common/HDLParser/ReadOnlyLibraryView.h \
     ../common/HDLParser/MetaInstance.h \
     ../../editors/MemoryDesigner/ConnectivityComponent.h \
     ../../editors/MemoryDesigner/ConnectivityConnection.h \
@@ -61,11 +63,13 @@ SOURCES += ./RenodeConfigurationManager.cpp \
     ./RenodeSettingsModel.cpp \
     ./RenodeSettingsWidget.cpp \
     ../PluginSystem/GeneratorPlugin/GenerationControl.cpp \
+    ../PluginSystem/GeneratorPlugin/OutputFileSink.cpp \
     ../PluginSystem/GeneratorPlugin/MessagePasser.cpp \
     ../PluginSystem/GeneratorPlugin/OutputControl.cpp \
     ../PluginSystem/GeneratorPlugin/ViewSelection.cpp \
     ../common/HDLParser/MetaComponent.cpp \
     ../common/HDLParser/MetaDesign.cpp \
+    ../common/HDLParser/ReadOnlyLibraryView.cpp \
     ../common/HDLParser/MetaInstance.cpp \
     ../../editors/MemoryDesigner/ConnectivityComponent.cpp \
     ../../editors/MemoryDesigner/ConnectivityConnection.cpp \
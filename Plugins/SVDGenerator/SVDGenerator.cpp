@@ -364,7 +364,7 @@ void SVDGenerator::writeAddressBlocks(QXmlStreamWriter& writer,
 {
     for (auto const& blockItem : getAddressBlockItems(mapItem))
     {
-        quint64 blockBaseAddress = blockItem->getAddress().toULongLong();
+        quint64 blockBaseAddress = blockItem->getAddressValue();
         if (blockBaseAddress >= mapBaseAddress)
         {
             blockBaseAddress = blockBaseAddress - mapBaseAddress;
@@ -420,7 +420,7 @@ void SVDGenerator::writeSingleAddressBlock(QXmlStreamWriter& writer, quint64 con
     writer.writeStartElement(SVDConstants::ADDRESSBLOCKELEMENT);
 
     QString addressOffsetInHexa = valueToHexa(offset);
-    QString rangeInHexa = valueToHexa(blockItem->getRange().toULongLong());
+    QString rangeInHexa = valueToHexa(blockItem->getRangeValue());
 
     writer.writeTextElement(SVDConstants::ADDRESSBLOCKOFFSET, addressOffsetInHexa);
     writer.writeTextElement(SVDConstants::SIZE, rangeInHexa);
@@ -457,7 +457,7 @@ void SVDGenerator::writeRegisters(QXmlStreamWriter& writer, QSharedPointer<const
             continue;
         }
 
-        quint64 blockBaseAddress = blockItem->getAddress().toULongLong();
+        quint64 blockBaseAddress = blockItem->getAddressValue();
         if (blockBaseAddress >= mapBaseAddress)
         {
             blockBaseAddress = blockBaseAddress - mapBaseAddress;
@@ -516,7 +516,7 @@ void SVDGenerator::writeRegister(QXmlStreamWriter& writer, QSharedPointer<Memory
     }
 
     QString name = registerItem->getName();
-    quint64 registerOffset = registerItem->getOffset().toULongLong();
+    quint64 registerOffset = registerItem->getOffsetValue();
     QString addressOffsetInHexa = valueToHexa(registerOffset);
     QString sizeString = registerItem->getSize();
 
@@ -660,10 +660,10 @@ void SVDGenerator::writeFields(QXmlStreamWriter& writer, QSharedPointer<Register
 //-----------------------------------------------------------------------------
 quint64 SVDGenerator::getFieldStart(QSharedPointer<MemoryItem> fieldItem, quint64 registerOffset)
 {
-    quint64 fieldAddress = fieldItem->getAddress().toInt();
-    quint64 fieldOffset = fieldItem->getOffset().toInt();
+    quint64 fieldAddress = fieldItem->getAddressValue();
+    quint64 fieldOffset = fieldItem->getOffsetValue();
 
-    int aub = fieldItem->getAUB().toInt();
+    quint64 aub = fieldItem->getAUBValue();
 
     fieldOffset = (fieldAddress - registerOffset) * aub + fieldOffset;
     return fieldOffset;
@@ -674,7 +674,7 @@ quint64 SVDGenerator::getFieldStart(QSharedPointer<MemoryItem> fieldItem, quint6
 //-----------------------------------------------------------------------------
 quint64 SVDGenerator::getFieldEnd(QSharedPointer<MemoryItem> fieldItem, quint64 fieldOffset)
 {
-    quint64 fieldWidth = fieldItem->getWidth().toInt();
+    quint64 fieldWidth = fieldItem->getWidthValue();
 
     if (fieldWidth > 0)
     {
@@ -249,6 +249,8 @@ void VerilogGeneratorPlugin::runGenerator(IPluginUtility* utility,
     configuration.getOutputControl()->setOutputPath(outputDirectory);
     configuration.getViewSelection()->setSaveToFileset(false);
 
+    // Nothing is previewed on the command line, so the content is only streamed to the files.
+    configuration.setPreviewsEnabled(false);
     configuration.parseDocuments();
     if (configuration.writeDocuments())
     {
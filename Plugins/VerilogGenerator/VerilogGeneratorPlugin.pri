@@ -31,6 +31,7 @@ HEADERS += ../../IPXACTmodels/utilities/ComponentSearch.h \
     ./VerilogWriterFactory/VerilogWriterFactory.h \
     ./VerilogAssignmentWriter/VerilogAssignmentWriter.h \
     ../PluginSystem/GeneratorPlugin/GenerationControl.h \
+    ../PluginSystem/GeneratorPlugin/OutputFileSink.h \
     ../PluginSystem/GeneratorPlugin/OutputControl.h \
     ../PluginSystem/GeneratorPlugin/ViewSelection.h \
     ../PluginSystem/GeneratorPlugin/MessagePasser.h \
@@ -41,6 +42,7 @@ HEADERS += ../../IPXACTmodels/utilities/ComponentSearch.h \
     ../common/HDLParser/HDLParserCommon.h \
     ../common/HDLParser/MetaComponent.h \
     ../common/HDLParser/MetaDesign.h \
+    ../common/HDLParser/ReadOnlyLibraryView.h \
     ../common/HDLParser/MetaInstance.h \
     ./VerilogPortWriter/VerilogPortWriter.h \
     ./VerilogPortWriter/VerilogTopDefaultWriter.h
@@ -66,6 +68,7 @@ SOURCES += ../../IPXACTmodels/utilities/ComponentSearch.cpp \
     ./VerilogWriterFactory/VerilogWriterFactory.cpp \
     ./VerilogAssignmentWriter/VerilogAssignmentWriter.cpp \
     ../PluginSystem/GeneratorPlugin/GenerationControl.cpp \
+    ../PluginSystem/GeneratorPlugin/OutputFileSink.cpp \
     ../PluginSystem/GeneratorPlugin/MessagePasser.cpp \
     ../PluginSystem/GeneratorPlugin/OutputControl.cpp \
     ../PluginSystem/GeneratorPlugin/ViewSelection.cpp \
@@ -75,6 +78,7 @@ SOURCES += ../../IPXACTmodels/utilities/ComponentSearch.cpp \
     ../PluginSystem/GeneratorPlugin/ViewSelectionWidget.cpp \
     ../common/HDLParser/MetaComponent.cpp \
     ../common/HDLParser/MetaDesign.cpp \
+    ../common/HDLParser/ReadOnlyLibraryView.cpp \
     ../common/HDLParser/MetaInstance.cpp \
     ./VerilogPortWriter/VerilogPortWriter.cpp \
     ./VerilogPortWriter/VerilogTopDefaultWriter.cpp
@@ -26,14 +26,30 @@ VerilogDocument::VerilogDocument()
 //-----------------------------------------------------------------------------
 // Function: VerilogDocument::write()
 //-----------------------------------------------------------------------------
-void VerilogDocument::write(QString const& /*outputDirectory*/)
+void VerilogDocument::write(QString const& outputDirectory)
 {
     fileContent_.clear();
     QTextStream outputStream(&fileContent_);
+    writeTo(outputStream, outputDirectory);
+}
+
+//-----------------------------------------------------------------------------
+// Function: VerilogDocument::writeTo()
+//-----------------------------------------------------------------------------
+void VerilogDocument::writeTo(QTextStream& outputStream, QString const& /*outputDirectory*/)
+{
     headerWriter_->write(outputStream, fileName_, QDateTime::currentDateTime());
     topWriter_->write(outputStream);
 }
 
+//-----------------------------------------------------------------------------
+// Function: VerilogDocument::isGenerationStamp()
+//-----------------------------------------------------------------------------
+bool VerilogDocument::isGenerationStamp(QByteArray const& line) const
+{
+    return line.startsWith("// Creation date : ") || line.startsWith("// Creation time : ");
+}
+
 //-----------------------------------------------------------------------------
 // Function: VerilogDocument::getImplementation()
 //-----------------------------------------------------------------------------
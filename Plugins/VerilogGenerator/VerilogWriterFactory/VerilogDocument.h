@@ -75,6 +75,23 @@ struct VerilogDocument : public GenerationOutput
      *      @param [in] outputDirectory         The possible output directory.
      */
 	virtual void write(QString const& outputDirectory) override;
+
+    /*!
+     *  Writes the content directly to a stream.
+     *
+     *      @param [in] outputStream            The stream to write to.
+     *      @param [in] outputDirectory         The possible output directory.
+     */
+    virtual void writeTo(QTextStream& outputStream, QString const& outputDirectory) override;
+
+    /*!
+     *  Checks if a line is the creation date or time in the file header.
+     *
+     *      @param [in] line                    The line to check, including its line break.
+     *
+     *      @return True, if the line is a generation stamp, otherwise false.
+     */
+    virtual bool isGenerationStamp(QByteArray const& line) const override;
     
     /*!
      *  Finds position for body text highlight in document, if any exists.
@@ -164,7 +164,7 @@ QVector<QSharedPointer<SingleCpuRoutesContainer> > ConnectivityGraphUtilities::g
     QSharedPointer<ConnectivityGraph> graph = graphFactory.createConnectivityGraph(component, viewName);
     MasterSlavePathSearch searchAlgorithm;
     QVector<QVector<QSharedPointer<const ConnectivityInterface>>> masterRoutes =
-        searchAlgorithm.findMasterSlavePaths(graph, true);
+        searchAlgorithm.findMasterSlavePaths(graph, true, MasterSlavePathSearch::SearchMode::Parallel);
 
     for (auto masterRoute : masterRoutes)
     {
@@ -10,6 +10,7 @@
 //-----------------------------------------------------------------------------
 
 #include "MetaDesign.h"
+#include "ReadOnlyLibraryView.h"
 
 #include <KactusAPI/include/MessageMediator.h>
 
@@ -30,7 +31,127 @@
 #include <KactusAPI/include/MultipleParameterFinder.h>
 #include <KactusAPI/include/ComponentParameterFinder.h>
 
+#include <QHash>
+#include <QMutexLocker>
+#include <QStringList>
 #include <QVector>
+#include <QtConcurrent>
+
+namespace
+{
+    //! A message shown while parsing a design concurrently.
+    struct DesignMessage
+    {
+        //! The kinds of messages in MessageMediator.
+        enum class Type
+        {
+            Message,
+            Error,
+            Failure,
+            Status
+        };
+
+        Type type;      //<! The kind of the message.
+        QString text;   //<! The message text.
+    };
+
+    //! The messages of the design parsed in the current thread, or null if no design is being parsed.
+    thread_local QVector<DesignMessage>* designMessages = nullptr;
+
+    //-----------------------------------------------------------------------------
+    //! Collects the messages of the concurrently parsed designs, so that they can be shown in the order of the
+    //! designs instead of the order the threads happen to run in. Other messages are shown immediately.
+    //-----------------------------------------------------------------------------
+    class DesignMessageChannel : public MessageMediator
+    {
+    public:
+
+        //! The constructor.
+        explicit DesignMessageChannel(MessageMediator* messages): messages_(messages) {}
+
+        //! The destructor.
+        virtual ~DesignMessageChannel() = default;
+
+        //! Show the given message to the user.
+        void showMessage(QString const& message) const final
+        {
+            show(DesignMessage{ DesignMessage::Type::Message, message });
+        }
+
+        //! Show the given error to the user.
+        void showError(QString const& error) const final
+        {
+            show(DesignMessage{ DesignMessage::Type::Error, error });
+        }
+
+        //! Show the given failure message to the user.
+        void showFailure(QString const& error) const final
+        {
+            show(DesignMessage{ DesignMessage::Type::Failure, error });
+        }
+
+        //! Show the given status to the user.
+        void showStatusMessage(QString const& status) const final
+        {
+            show(DesignMessage{ DesignMessage::Type::Status, status });
+        }
+
+        //! Show the collected messages of a design to the user.
+        void showCollected(QVector<DesignMessage> const& messages) const
+        {
+            for (DesignMessage const& message : messages)
+            {
+                forward(message);
+            }
+        }
+
+    private:
+
+        //! Collects the message for the design parsed in the current thread, or shows it immediately.
+        void show(DesignMessage const& message) const
+        {
+            if (designMessages)
+            {
+                designMessages->append(message);
+            }
+            else
+            {
+                forward(message);
+            }
+        }
+
+        //! Shows the message through the original channel.
+        void forward(DesignMessage const& message) const
+        {
+            if (message.type == DesignMessage::Type::Message)
+            {
+                messages_->showMessage(message.text);
+            }
+            else if (message.type == DesignMessage::Type::Error)
+            {
+                messages_->showError(message.text);
+            }
+            else if (message.type == DesignMessage::Type::Failure)
+            {
+                messages_->showFailure(message.text);
+            }
+            else
+            {
+                messages_->showStatusMessage(message.text);
+            }
+        }
+
+        //! The original message channel.
+        MessageMediator* messages_;
+    };
+
+    //! A design to parse concurrently with the messages shown while parsing it.
+    struct DesignParseTask
+    {
+        QSharedPointer<MetaDesign> design;      //<! The design to parse.
+        QVector<DesignMessage> messages;        //<! The messages shown while parsing the design.
+    };
+}
 
 //-----------------------------------------------------------------------------
 // Function: MetaDesign::MetaDesign()
@@ -50,7 +171,9 @@ topInstance_(topInstance),
 parameters_(new QList<QSharedPointer<Parameter> >()),
 instances_(new QMap<QString,QSharedPointer<MetaInstance> >),
 interconnections_(new QList<QSharedPointer<MetaInterconnection> >),
-adHocWires_(new QList<QSharedPointer<MetaWire> >)
+adHocWires_(new QList<QSharedPointer<MetaWire> >),
+components_(new ComponentCache()),
+libraryView_()
 {
 
 }
@@ -59,8 +182,22 @@ adHocWires_(new QList<QSharedPointer<MetaWire> >)
 // Function: MetaDesign::parseHierarchy()
 //-----------------------------------------------------------------------------
 QList<QSharedPointer<MetaDesign> > MetaDesign::parseHierarchy(LibraryInterface* library, GenerationTuple input,
-    QSharedPointer<View> topComponentView)
+    QSharedPointer<View> topComponentView, ParseMode mode)
 {
+    // Concurrently parsed designs read the library through a serializing view. Their messages are collected
+    // and shown in the order of the designs.
+    QSharedPointer<ReadOnlyLibraryView> libraryView;
+    QSharedPointer<DesignMessageChannel> messageChannel;
+    MessageMediator* messages = input.messages;
+    if (mode == ParseMode::Parallel)
+    {
+        libraryView = QSharedPointer<ReadOnlyLibraryView>(new ReadOnlyLibraryView(library));
+        library = libraryView.data();
+
+        messageChannel = QSharedPointer<DesignMessageChannel>(new DesignMessageChannel(input.messages));
+        messages = messageChannel.data();
+    }
+
     QSharedPointer<ComponentInstance> componentInstance(nullptr);
     QSharedPointer<QList<QSharedPointer<Parameter> > > topList(new QList<QSharedPointer<Parameter> >);
     QSharedPointer<QList<QSharedPointer<ConfigurableElementValue> > > cevs(nullptr);
@@ -68,7 +205,7 @@ QList<QSharedPointer<MetaDesign> > MetaDesign::parseHierarchy(LibraryInterface*
     // Instantiate the top component with the selected design.
     // Obviously, it cannot have CEVs or parameters of any other component.
     QSharedPointer<MetaInstance> topMostInstance(new MetaInstance(componentInstance,
-        library, input.messages, input.component, topComponentView));
+        library, messages, input.component, topComponentView));
 
     parseParameters(topMostInstance->getParameters(), topList, cevs);
     topList->append(*topMostInstance->getParameters());
@@ -88,49 +225,134 @@ QList<QSharedPointer<MetaDesign> > MetaDesign::parseHierarchy(LibraryInterface*
     }
 
     // Create the design associated with the top component.
-    QSharedPointer<MetaDesign> topMostDesign(new MetaDesign(library, input.messages, input.design,
+    QSharedPointer<MetaDesign> topMostDesign(new MetaDesign(library, messages, input.design,
         designInstantiation, input.designConfiguration, topMostInstance));
+    topMostDesign->libraryView_ = libraryView;
+    topMostDesign->messageChannel_ = messageChannel;
 
     // Each module name, except the topmost instance, is associated with the count of the same name.
     QMap<QString, int> names;
 
+    // The sub designs already elaborated, keyed with their elaboration key.
+    QHash<QString, QSharedPointer<MetaDesign> > elaborations;
+
     QList<QSharedPointer<MetaDesign> > parsedDesigns;
     int subDesignCount = 0;
     const int MAXIMUM_SUBDESIGNS = 1000;
     
+    // The designs are parsed one hierarchy level at a time. The designs on the same level depend only on
+    // the level above, so they can be parsed concurrently.
     QVector<QSharedPointer<MetaDesign> > designsToParse({ topMostDesign });
     while (!designsToParse.isEmpty())
     {
-         QSharedPointer<MetaDesign> currentDesign = designsToParse.takeFirst();
-         currentDesign->findInstances();
+         // The design must be parsed before its sub designs are compared, since parsing the design resolves
+         // the parameters of the instances.
+         auto parse = [](QSharedPointer<MetaDesign>& currentDesign)
+         {
+             currentDesign->findInstances();
+             currentDesign->parseDesign();
+         };
 
-         subDesignCount += currentDesign->subDesigns_.count();
-         if (subDesignCount > MAXIMUM_SUBDESIGNS)
+         if (mode == ParseMode::Parallel && designsToParse.size() > 1)
          {
-             input.messages->showError(
-                 QObject::tr("Exceeded maximum number of designs in one hierarchy: %1.").arg(MAXIMUM_SUBDESIGNS));
-             return parsedDesigns;
+             QVector<DesignParseTask> tasks;
+             tasks.reserve(designsToParse.size());
+             for (QSharedPointer<MetaDesign> const& currentDesign : designsToParse)
+             {
+                 tasks.append(DesignParseTask{ currentDesign, QVector<DesignMessage>() });
+             }
+
+             QtConcurrent::blockingMap(tasks, [&parse](DesignParseTask& task)
+             {
+                 designMessages = &task.messages;
+                 parse(task.design);
+                 designMessages = nullptr;
+             });
+
+             for (DesignParseTask const& task : tasks)
+             {
+                 messageChannel->showCollected(task.messages);
+             }
          }
-
-         for (QSharedPointer<MetaDesign> subDesign : currentDesign->subDesigns_)
+         else
          {
-             designsToParse.append(subDesign);
+             for (QSharedPointer<MetaDesign>& currentDesign : designsToParse)
+             {
+                 parse(currentDesign);
+             }
+         }
 
-             QString name = subDesign->getTopInstance()->getModuleName();
-             
-             int count = names.value(name, 0);
-             names.insert(name, count + 1);
+         parsedDesigns.append(designsToParse);
 
-             subDesign->getTopInstance()->setModuleName(name + QLatin1Char('_') + QString::number(count));
+         // The sub designs are named in the calling thread in the order of the parsed designs, so the module
+         // names do not depend on the parsing mode.
+         QVector<QSharedPointer<MetaDesign> > nextLevel;
+         for (QSharedPointer<MetaDesign> currentDesign : designsToParse)
+         {
+             for (QSharedPointer<MetaDesign> subDesign : currentDesign->subDesigns_)
+             {
+                 QSharedPointer<MetaInstance> subInstance = subDesign->getTopInstance();
+                 QString key = elaborationKey(subInstance);
+
+                 // Instances resolving to an identical elaboration share one parsed design and module.
+                 QSharedPointer<MetaDesign> existingDesign = elaborations.value(key);
+                 if (existingDesign)
+                 {
+                     subInstance->setModuleName(existingDesign->getTopInstance()->getModuleName());
+                     continue;
+                 }
+
+                 ++subDesignCount;
+                 if (subDesignCount > MAXIMUM_SUBDESIGNS)
+                 {
+                     input.messages->showError(QObject::tr(
+                         "Exceeded maximum number of designs in one hierarchy: %1.").arg(MAXIMUM_SUBDESIGNS));
+                     return parsedDesigns;
+                 }
+
+                 elaborations.insert(key, subDesign);
+                 nextLevel.append(subDesign);
+
+                 QString name = subInstance->getModuleName();
+
+                 int count = names.value(name, 0);
+                 names.insert(name, count + 1);
+
+                 subInstance->setModuleName(name + QLatin1Char('_') + QString::number(count));
+             }
          }
 
-         currentDesign->parseDesign();
-         parsedDesigns.append(currentDesign);
+         designsToParse = nextLevel;
     }
 
     return parsedDesigns;
 }
 
+//-----------------------------------------------------------------------------
+// Function: MetaDesign::elaborationKey()
+//-----------------------------------------------------------------------------
+QString MetaDesign::elaborationKey(QSharedPointer<MetaInstance> mInstance)
+{
+    QStringList keyParts;
+    keyParts.append(mInstance->getComponent()->getVlnv().toString());
+
+    QSharedPointer<View> activeView = mInstance->getActiveView();
+    keyParts.append(activeView ? activeView->name() : QString());
+
+    // The parameters of the instance have been resolved, including the overrides of the parent design.
+    for (QSharedPointer<Parameter> parameter : *mInstance->getParameters())
+    {
+        keyParts.append(parameter->name() + QLatin1Char('=') + parameter->getValue());
+    }
+
+    for (QSharedPointer<Parameter> moduleParameter : *mInstance->getModuleParameters())
+    {
+        keyParts.append(moduleParameter->name() + QLatin1Char('=') + moduleParameter->getValue());
+    }
+
+    return keyParts.join(QLatin1Char('\n'));
+}
+
 //-----------------------------------------------------------------------------
 // Function: MetaDesign::parseDesign()
 //-----------------------------------------------------------------------------
@@ -204,7 +426,7 @@ void MetaDesign::findInstances()
     for (QSharedPointer<ComponentInstance> instance : *design_->getComponentInstances())
     {
         VLNV instanceVLNV = design_->getHWComponentVLNV(instance->getInstanceName());
-        QSharedPointer<Component> component = library_->getModel<Component>(instanceVLNV);
+        QSharedPointer<Component> component = findComponent(instanceVLNV);
 
         if (!component)
         {
@@ -923,15 +1145,18 @@ void MetaDesign::findHierarchy(QSharedPointer<MetaInstance> mInstance)
         activeView->getDesignInstantiationRef());
 
     // Try to find the referred documents.
-    QSharedPointer<DesignConfiguration> subDesignConfiguration =
+    QSharedPointer<DesignConfiguration const> subDesignConfiguration =
         findDesignConfigurationFromInsantiation(configurationInstantiation);
-    QSharedPointer<Design> subDesign = findDesignFromInstantiation(designInstantiation, subDesignConfiguration);
+    QSharedPointer<Design const> subDesign =
+        findDesignFromInstantiation(designInstantiation, subDesignConfiguration);
 
     if (subDesign)
     {
         // If a sub design exists, it must be also parsed.
         QSharedPointer<MetaDesign> subMetaDesign(new MetaDesign(library_, messages_, subDesign, 
             designInstantiation, subDesignConfiguration, mInstance));
+        subMetaDesign->components_ = components_;
+        subMetaDesign->libraryView_ = libraryView_;
         subDesigns_.append(subMetaDesign);
     }
 }
@@ -939,15 +1164,15 @@ void MetaDesign::findHierarchy(QSharedPointer<MetaInstance> mInstance)
 //-----------------------------------------------------------------------------
 // Function: MetaDesign::findDesignConfigurationFromInsantiation()
 //-----------------------------------------------------------------------------
-QSharedPointer<DesignConfiguration> MetaDesign::findDesignConfigurationFromInsantiation(
+QSharedPointer<DesignConfiguration const> MetaDesign::findDesignConfigurationFromInsantiation(
     QSharedPointer<DesignConfigurationInstantiation> configurationInstantiation)
 {
-    QSharedPointer<DesignConfiguration> referredDesignConfiguration(nullptr);
+    QSharedPointer<DesignConfiguration const> referredDesignConfiguration(nullptr);
 
     if (configurationInstantiation && configurationInstantiation->getDesignConfigurationReference())
     {
         // Try to find the referred design configuration.
-        referredDesignConfiguration = library_->getModel<DesignConfiguration>(
+        referredDesignConfiguration = library_->getModelReadOnly<DesignConfiguration>(
             *(configurationInstantiation->getDesignConfigurationReference()));
 
         // If instantiation exists, the referred document must exist!
@@ -966,14 +1191,15 @@ QSharedPointer<DesignConfiguration> MetaDesign::findDesignConfigurationFromInsan
 //-----------------------------------------------------------------------------
 // Function: MetaDesign::findDesignFromInstantiation()
 //-----------------------------------------------------------------------------
-QSharedPointer<Design> MetaDesign::findDesignFromInstantiation(QSharedPointer<DesignInstantiation> designInstantiation,
-    QSharedPointer<DesignConfiguration> configuration)
+QSharedPointer<Design const> MetaDesign::findDesignFromInstantiation(
+    QSharedPointer<DesignInstantiation> designInstantiation,
+    QSharedPointer<DesignConfiguration const> configuration)
 {
-    QSharedPointer<Design> referredDesign(nullptr);
+    QSharedPointer<Design const> referredDesign(nullptr);
 
     if (designInstantiation && designInstantiation->getDesignReference())
     {
-        referredDesign = library_->getModel<Design>(*(designInstantiation->getDesignReference()));        
+        referredDesign = library_->getModelReadOnly<Design>(*(designInstantiation->getDesignReference()));        
         if (!referredDesign)
         {
             messages_->showError(QObject::tr("Design %1: Subdesign referred by instantiation did not exist: %2")
@@ -996,7 +1222,7 @@ QSharedPointer<Design> MetaDesign::findDesignFromInstantiation(QSharedPointer<De
         }
         else
         {
-            referredDesign = library_->getModel<Design>(configuration->getDesignRef());
+            referredDesign = library_->getModelReadOnly<Design>(configuration->getDesignRef());
         }
     }
 
@@ -1042,3 +1268,25 @@ void MetaDesign::assignLargerBounds(QSharedPointer<MetaWire> wire, QPair<QString
         wire->bounds_.second = boundCand.second;
     }
 }
+
+//-----------------------------------------------------------------------------
+// Function: MetaDesign::findComponent()
+//-----------------------------------------------------------------------------
+QSharedPointer<Component> MetaDesign::findComponent(VLNV const& componentVLNV)
+{
+    QMutexLocker locker(&components_->mutex);
+
+    auto cached = components_->components.constFind(componentVLNV);
+    if (cached != components_->components.cend())
+    {
+        return cached.value();
+    }
+
+    QSharedPointer<Component> component = library_->getModel<Component>(componentVLNV);
+    if (component)
+    {
+        components_->components.insert(componentVLNV, component);
+    }
+
+    return component;
+}
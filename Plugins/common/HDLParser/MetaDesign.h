@@ -14,9 +14,12 @@
 
 #include "MetaInstance.h"
 
+#include <QMutex>
+
 class Design;
 class DesignConfiguration;
 class AdHocConnection;
+class ReadOnlyLibraryView;
 class MessageMediator;
 class PartSelect;
 class PortAbstraction;
@@ -27,6 +30,14 @@ class PortAbstraction;
 class MetaDesign
 {
 public:
+
+    //! The available modes for parsing the designs of a hierarchy.
+    enum class ParseMode
+    {
+        Sequential, //!< Designs are parsed one at a time in the calling thread.
+        Parallel    //!< Sibling designs on the same hierarchy level are parsed concurrently.
+    };
+
     /*!
      *  The constructor.
      *
@@ -51,15 +62,18 @@ public:
     MetaDesign& operator=(MetaDesign const& rhs) = delete;
 
     /*!
-     *  Parses a hierarchy of designs and return the list of them.
+     *  Parses a hierarchy of designs and return the list of them. Sub design instances of the same component
+     *  and view with identical resolved parameters share one parsed design and module name.
      *
      *      @param [in] library                 The library which is expected to contain the parsed documents.
      *      @param [in] input		            The starting point for hierarchy parsing.
      *      @param [in] topComponentView        The active view of the component in input.
+     *      @param [in] mode                    The parsing mode. Both modes give the same designs and names.
      */
     static QList<QSharedPointer<MetaDesign> > parseHierarchy(LibraryInterface* library,
         GenerationTuple input,
-        QSharedPointer<View> topComponentView);
+        QSharedPointer<View> topComponentView,
+        ParseMode mode = ParseMode::Sequential);
     
     /*!
      *  Returns the meta instance of the top component. Must exists even if is the topmost in hierarchy.
@@ -83,6 +97,16 @@ public:
 
 private:
 
+    //! The components read from the library, shared by all designs in a hierarchy.
+    struct ComponentCache
+    {
+        //! Guards the components when designs are parsed concurrently.
+        QMutex mutex;
+
+        //! The components keyed with their VLNVs.
+        QMap<VLNV, QSharedPointer<Component> > components;
+    };
+
     /*!
      *  Finds the component instances within the design, also determines if they are hierarchical.
      */
@@ -93,6 +117,15 @@ private:
      */
     void parseDesign();
 
+    /*!
+     *  Creates a key identifying the elaboration of a hierarchical instance.
+     *
+     *      @param [in] mInstance   The instance, with its parameters resolved by the containing design.
+     *
+     *      @return Key of the component VLNV, the active view and the resolved parameter values.
+     */
+    static QString elaborationKey(QSharedPointer<MetaInstance> mInstance);
+
     /*!
      *  Parses the design parameters. Also applies them to the meta parameters.
      */
@@ -234,8 +267,9 @@ private:
      *
      *      @return The found design, or null.
      */
-    QSharedPointer<Design> findDesignFromInstantiation(QSharedPointer<DesignInstantiation> designInstantiation,
-        QSharedPointer<DesignConfiguration> configurationInstantiation);
+    QSharedPointer<Design const> findDesignFromInstantiation(
+        QSharedPointer<DesignInstantiation> designInstantiation,
+        QSharedPointer<DesignConfiguration const> configurationInstantiation);
 
     /*!
      *  Finds a design and design configuration from a design instantiation.
@@ -244,7 +278,7 @@ private:
      *
      *      @return The found design configuration, or null.
      */
-    QSharedPointer<DesignConfiguration> findDesignConfigurationFromInsantiation(
+    QSharedPointer<DesignConfiguration const> findDesignConfigurationFromInsantiation(
         QSharedPointer<DesignConfigurationInstantiation> configurationInstantiation);
 
 
@@ -257,6 +291,15 @@ private:
      */
     void assignLargerBounds(QSharedPointer<MetaWire> wire, QPair<QString,QString> const& boundCand);
 
+    /*!
+     *  Finds the component for an instance. Instances of the same component share one copy of the model.
+     *
+     *      @param [in] componentVLNV           The VLNV of the instantiated component.
+     *
+     *      @return The component or null, if it was not found in the library.
+     */
+    QSharedPointer<Component> findComponent(VLNV const& componentVLNV);
+
     //-----------------------------------------------------------------------------
     // Data.
     //-----------------------------------------------------------------------------
@@ -291,6 +334,16 @@ private:
 
     //! The list of all parsed designs that are below the current top are in this list.
     QList<QSharedPointer<MetaDesign> > subDesigns_;
+
+    //! The components read from the library, shared by all designs in the hierarchy. The components are
+    //! only read during parsing, so each component is copied from the library only once.
+    QSharedPointer<ComponentCache> components_;
+
+    //! The library view used in parallel parsing, shared by all designs in the hierarchy. Null otherwise.
+    QSharedPointer<ReadOnlyLibraryView> libraryView_;
+
+    //! The message channel used in parallel parsing, shared by all designs in the hierarchy. Null otherwise.
+    QSharedPointer<MessageMediator> messageChannel_;
 };
 
 #endif // METADESIGN_H
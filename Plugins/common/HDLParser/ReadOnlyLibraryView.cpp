@@ -0,0 +1,308 @@
+//-----------------------------------------------------------------------------
+// File: ReadOnlyLibraryView.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 17.10.2026
+//
+// Description:
+// Thread-safe, read-only view to a library for parsing a design hierarchy concurrently.
+//-----------------------------------------------------------------------------
+
+#include "ReadOnlyLibraryView.h"
+
+#include <IPXACTmodels/common/Document.h>
+#include <IPXACTmodels/Design/Design.h>
+
+#include <QMutexLocker>
+#include <QReadLocker>
+#include <QWriteLocker>
+
+//-----------------------------------------------------------------------------
+// Function: ReadOnlyLibraryView::ReadOnlyLibraryView()
+//-----------------------------------------------------------------------------
+ReadOnlyLibraryView::ReadOnlyLibraryView(LibraryInterface* library):
+library_(library),
+libraryMutex_(),
+readItemsLock_(),
+documents_(),
+designVLNVs_()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: ReadOnlyLibraryView::getModel()
+//-----------------------------------------------------------------------------
+QSharedPointer<Document> ReadOnlyLibraryView::getModel(VLNV const& vlnv)
+{
+    QSharedPointer<Document const> document = getModelReadOnly(vlnv);
+    if (document.isNull())
+    {
+        return QSharedPointer<Document>();
+    }
+
+    return document->clone();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ReadOnlyLibraryView::getModelReadOnly()
+//-----------------------------------------------------------------------------
+QSharedPointer<Document const> ReadOnlyLibraryView::getModelReadOnly(VLNV const& vlnv)
+{
+    QReadLocker readLocker(&readItemsLock_);
+    if (auto cached = documents_.constFind(vlnv); cached != documents_.cend())
+    {
+        return cached.value();
+    }
+    readLocker.unlock();
+
+    // The documents are only added while holding the library, so another thread may have added the document
+    // while waiting for the library, but not after.
+    QMutexLocker libraryLocker(&libraryMutex_);
+
+    readLocker.relock();
+    if (auto cached = documents_.constFind(vlnv); cached != documents_.cend())
+    {
+        return cached.value();
+    }
+    readLocker.unlock();
+
+    QSharedPointer<Document const> document = library_->getModelReadOnly(vlnv);
+
+    QWriteLocker writeLocker(&readItemsLock_);
+    documents_.insert(vlnv, document);
+
+    return document;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ReadOnlyLibraryView::getDesignVLNV()
+//-----------------------------------------------------------------------------
+VLNV ReadOnlyLibraryView::getDesignVLNV(VLNV const& hierarchyRef)
+{
+    QReadLocker readLocker(&readItemsLock_);
+    if (auto cached = designVLNVs_.constFind(hierarchyRef); cached != designVLNVs_.cend())
+    {
+        return cached.value();
+    }
+    readLocker.unlock();
+
+    QMutexLocker libraryLocker(&libraryMutex_);
+
+    readLocker.relock();
+    if (auto cached = designVLNVs_.constFind(hierarchyRef); cached != designVLNVs_.cend())
+    {
+        return cached.value();
+    }
+    readLocker.unlock();
+
+    VLNV designVLNV = library_->getDesignVLNV(hierarchyRef);
+
+    QWriteLocker writeLocker(&readItemsLock_);
+    designVLNVs_.insert(hierarchyRef, designVLNV);
+
+    return designVLNV;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ReadOnlyLibraryView::getDesign()
+//-----------------------------------------------------------------------------
+QSharedPointer<Design> ReadOnlyLibraryView::getDesign(VLNV const& hierarchyRef)
+{
+    VLNV designVLNV = getDesignVLNV(hierarchyRef);
+    if (designVLNV.isValid() == false)
+    {
+        return QSharedPointer<Design>();
+    }
+
+    return getModel(designVLNV).staticCast<Design>();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ReadOnlyLibraryView::contains()
+//-----------------------------------------------------------------------------
+bool ReadOnlyLibraryView::contains(VLNV const& vlnv) const
+{
+    QMutexLocker libraryLocker(&libraryMutex_);
+    return library_->contains(vlnv);
+}
+
+//-----------------------------------------------------------------------------
+// Function: ReadOnlyLibraryView::getAllVLNVs()
+//-----------------------------------------------------------------------------
+QList<VLNV> ReadOnlyLibraryView::getAllVLNVs() const
+{
+    QMutexLocker libraryLocker(&libraryMutex_);
+    return library_->getAllVLNVs();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ReadOnlyLibraryView::getPath()
+//-----------------------------------------------------------------------------
+const QString ReadOnlyLibraryView::getPath(VLNV const& vlnv) const
+{
+    QMutexLocker libraryLocker(&libraryMutex_);
+    return library_->getPath(vlnv);
+}
+
+//-----------------------------------------------------------------------------
+// Function: ReadOnlyLibraryView::getDirectoryPath()
+//-----------------------------------------------------------------------------
+QString ReadOnlyLibraryView::getDirectoryPath(VLNV const& vlnv) const
+{
+    QMutexLocker libraryLocker(&libraryMutex_);
+    return library_->getDirectoryPath(vlnv);
+}
+
+//-----------------------------------------------------------------------------
+// Function: ReadOnlyLibraryView::getNeededVLNVs()
+//-----------------------------------------------------------------------------
+void ReadOnlyLibraryView::getNeededVLNVs(VLNV const& vlnv, QList<VLNV>& list)
+{
+    QMutexLocker libraryLocker(&libraryMutex_);
+    library_->getNeededVLNVs(vlnv, list);
+}
+
+//-----------------------------------------------------------------------------
+// Function: ReadOnlyLibraryView::getDependencyFiles()
+//-----------------------------------------------------------------------------
+void ReadOnlyLibraryView::getDependencyFiles(VLNV const& vlnv, QStringList& list)
+{
+    QMutexLocker libraryLocker(&libraryMutex_);
+    library_->getDependencyFiles(vlnv, list);
+}
+
+//-----------------------------------------------------------------------------
+// Function: ReadOnlyLibraryView::getTreeRoot()
+//-----------------------------------------------------------------------------
+LibraryItem const* ReadOnlyLibraryView::getTreeRoot() const
+{
+    QMutexLocker libraryLocker(&libraryMutex_);
+    return library_->getTreeRoot();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ReadOnlyLibraryView::getDocumentType()
+//-----------------------------------------------------------------------------
+VLNV::IPXactType ReadOnlyLibraryView::getDocumentType(VLNV const& vlnv)
+{
+    QMutexLocker libraryLocker(&libraryMutex_);
+    return library_->getDocumentType(vlnv);
+}
+
+//-----------------------------------------------------------------------------
+// Function: ReadOnlyLibraryView::referenceCount()
+//-----------------------------------------------------------------------------
+int ReadOnlyLibraryView::referenceCount(VLNV const& vlnv) const
+{
+    QMutexLocker libraryLocker(&libraryMutex_);
+    return library_->referenceCount(vlnv);
+}
+
+//-----------------------------------------------------------------------------
+// Function: ReadOnlyLibraryView::getOwners()
+//-----------------------------------------------------------------------------
+int ReadOnlyLibraryView::getOwners(QList<VLNV>& list, VLNV const& vlnvToSearch) const
+{
+    QMutexLocker libraryLocker(&libraryMutex_);
+    return library_->getOwners(list, vlnvToSearch);
+}
+
+//-----------------------------------------------------------------------------
+// Function: ReadOnlyLibraryView::getChildren()
+//-----------------------------------------------------------------------------
+int ReadOnlyLibraryView::getChildren(QList<VLNV>& list, VLNV const& vlnvToSearch) const
+{
+    QMutexLocker libraryLocker(&libraryMutex_);
+    return library_->getChildren(list, vlnvToSearch);
+}
+
+//-----------------------------------------------------------------------------
+// Function: ReadOnlyLibraryView::isValid()
+//-----------------------------------------------------------------------------
+bool ReadOnlyLibraryView::isValid(VLNV const& vlnv)
+{
+    QMutexLocker libraryLocker(&libraryMutex_);
+    return library_->isValid(vlnv);
+}
+
+//-----------------------------------------------------------------------------
+// Function: ReadOnlyLibraryView::writeModelToFile()
+//-----------------------------------------------------------------------------
+bool ReadOnlyLibraryView::writeModelToFile(QString const& /*path*/, QSharedPointer<Document> /*model*/)
+{
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ReadOnlyLibraryView::writeModelToFile()
+//-----------------------------------------------------------------------------
+bool ReadOnlyLibraryView::writeModelToFile(QSharedPointer<Document> /*model*/)
+{
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ReadOnlyLibraryView::searchForIPXactFiles()
+//-----------------------------------------------------------------------------
+void ReadOnlyLibraryView::searchForIPXactFiles()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: ReadOnlyLibraryView::onCheckLibraryIntegrity()
+//-----------------------------------------------------------------------------
+void ReadOnlyLibraryView::onCheckLibraryIntegrity()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: ReadOnlyLibraryView::onEditItem()
+//-----------------------------------------------------------------------------
+void ReadOnlyLibraryView::onEditItem(VLNV const& /*vlnv*/)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: ReadOnlyLibraryView::onOpenDesign()
+//-----------------------------------------------------------------------------
+void ReadOnlyLibraryView::onOpenDesign(VLNV const& /*vlnv*/, QString const& /*viewName*/)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: ReadOnlyLibraryView::removeObject()
+//-----------------------------------------------------------------------------
+void ReadOnlyLibraryView::removeObject(VLNV const& /*vlnv*/)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: ReadOnlyLibraryView::removeObjects()
+//-----------------------------------------------------------------------------
+void ReadOnlyLibraryView::removeObjects(const QList<VLNV>& /*vlnvList*/)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: ReadOnlyLibraryView::beginSave()
+//-----------------------------------------------------------------------------
+void ReadOnlyLibraryView::beginSave()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: ReadOnlyLibraryView::endSave()
+//-----------------------------------------------------------------------------
+void ReadOnlyLibraryView::endSave()
+{
+
+}
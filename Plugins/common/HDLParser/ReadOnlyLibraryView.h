@@ -0,0 +1,151 @@
+//-----------------------------------------------------------------------------
+// File: ReadOnlyLibraryView.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 17.10.2026
+//
+// Description:
+// Thread-safe, read-only view to a library for parsing a design hierarchy concurrently.
+//-----------------------------------------------------------------------------
+
+#ifndef READONLYLIBRARYVIEW_H
+#define READONLYLIBRARYVIEW_H
+
+#include <KactusAPI/include/LibraryInterface.h>
+
+#include <QHash>
+#include <QMutex>
+#include <QReadWriteLock>
+
+//-----------------------------------------------------------------------------
+//! Thread-safe, read-only view to a library for parsing a design hierarchy concurrently.
+//
+// All the calls to the underlying library are serialized. The documents and the design references are read
+// from the library once and kept for the lifetime of the view, so the documents seen by concurrent parsers do
+// not change. Reading the kept documents does not wait for the library, and the copies returned by getModel()
+// and getDesign() are made outside the locks. The operations modifying the library are ignored.
+//-----------------------------------------------------------------------------
+class ReadOnlyLibraryView : public LibraryInterface
+{
+public:
+
+    /*!
+     *  The constructor.
+     *
+     *      @param [in] library     The library to view.
+     */
+    explicit ReadOnlyLibraryView(LibraryInterface* library);
+
+    //! The destructor.
+    virtual ~ReadOnlyLibraryView() = default;
+
+    // Disable copying.
+    ReadOnlyLibraryView(ReadOnlyLibraryView const& rhs) = delete;
+    ReadOnlyLibraryView& operator=(ReadOnlyLibraryView const& rhs) = delete;
+
+    /*!
+     *  Gets a copy of the document with the given VLNV.
+     *
+     *      @param [in] vlnv    The VLNV of the document.
+     *
+     *      @return A copy of the document, or null if not found.
+     */
+    QSharedPointer<Document> getModel(VLNV const& vlnv) final;
+
+    /*!
+     *  Gets the document with the given VLNV for read-only access.
+     *
+     *      @param [in] vlnv    The VLNV of the document.
+     *
+     *      @return The document, or null if not found.
+     */
+    QSharedPointer<Document const> getModelReadOnly(VLNV const& vlnv) final;
+
+    /*!
+     *  Gets the VLNV of the design referenced by a design or a design configuration.
+     *
+     *      @param [in] hierarchyRef    The VLNV of the design or the design configuration.
+     *
+     *      @return The VLNV of the design, or an invalid VLNV if not found.
+     */
+    VLNV getDesignVLNV(VLNV const& hierarchyRef) final;
+
+    /*!
+     *  Gets a copy of the design referenced by a design or a design configuration.
+     *
+     *      @param [in] hierarchyRef    The VLNV of the design or the design configuration.
+     *
+     *      @return A copy of the design, or null if not found.
+     */
+    QSharedPointer<Design> getDesign(VLNV const& hierarchyRef) final;
+
+    // The queries below are forwarded to the library.
+    bool contains(VLNV const& vlnv) const final;
+
+    QList<VLNV> getAllVLNVs() const final;
+
+    const QString getPath(VLNV const& vlnv) const final;
+
+    QString getDirectoryPath(VLNV const& vlnv) const final;
+
+    void getNeededVLNVs(VLNV const& vlnv, QList<VLNV>& list) final;
+
+    void getDependencyFiles(VLNV const& vlnv, QStringList& list) final;
+
+    LibraryItem const* getTreeRoot() const final;
+
+    VLNV::IPXactType getDocumentType(VLNV const& vlnv) final;
+
+    int referenceCount(VLNV const& vlnv) const final;
+
+    int getOwners(QList<VLNV>& list, VLNV const& vlnvToSearch) const final;
+
+    int getChildren(QList<VLNV>& list, VLNV const& vlnvToSearch) const final;
+
+    bool isValid(VLNV const& vlnv) final;
+
+    // The operations below would modify the library or the user interface and are ignored.
+    bool writeModelToFile(QString const& path, QSharedPointer<Document> model) final;
+
+    bool writeModelToFile(QSharedPointer<Document> model) final;
+
+    void searchForIPXactFiles() final;
+
+    void onCheckLibraryIntegrity() final;
+
+    void onEditItem(VLNV const& vlnv) final;
+
+    void onOpenDesign(VLNV const& vlnv, QString const& viewName) final;
+
+    void removeObject(VLNV const& vlnv) final;
+
+    void removeObjects(const QList<VLNV>& vlnvList) final;
+
+    void beginSave() final;
+
+    void endSave() final;
+
+private:
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The viewed library.
+    LibraryInterface* library_;
+
+    //! Serializes the access to the library.
+    mutable QMutex libraryMutex_;
+
+    //! Guards the documents and the design references read from the library.
+    mutable QReadWriteLock readItemsLock_;
+
+    //! The documents read from the library, including the ones not found.
+    QHash<VLNV, QSharedPointer<Document const> > documents_;
+
+    //! The design VLNVs read from the library for the hierarchy references, including the ones not found.
+    QHash<VLNV, VLNV> designVLNVs_;
+};
+
+#endif // READONLYLIBRARYVIEW_H
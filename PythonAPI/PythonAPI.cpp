@@ -176,6 +176,22 @@ void PythonAPI::setDefaultLibraryPath(std::string const& path) const
     KactusAPI::setDefaultLibraryPath(QString::fromStdString(path));
 }
 
+//-----------------------------------------------------------------------------
+// Function: PythonAPI::setLibraryCacheLimit()
+//-----------------------------------------------------------------------------
+void PythonAPI::setLibraryCacheLimit(int megabytes) const
+{
+    LibraryHandler::getInstance().setCacheLimit(qint64(megabytes) * 1024 * 1024);
+}
+
+//-----------------------------------------------------------------------------
+// Function: PythonAPI::showLibraryCacheStatistics()
+//-----------------------------------------------------------------------------
+void PythonAPI::showLibraryCacheStatistics() const
+{
+    LibraryHandler::getInstance().showCacheStatistics();
+}
+
 //-----------------------------------------------------------------------------
 // Function: PythonAPI::setDefaultLibraryPath()
 //-----------------------------------------------------------------------------
@@ -399,6 +415,8 @@ bool PythonAPI::openComponent(std::string const& vlnvString)
 
             busInterface_->setBusInterfaces(component);
 
+            addressIndex_->clear();
+
             activeComponent_ = component;
             messager_->showMessage(QString("Component %1 is open").arg(componentVLNV));
             return true;
@@ -443,6 +461,7 @@ void PythonAPI::closeOpenComponent()
     }
 
     activeComponent_ = QSharedPointer<Component>();
+    addressIndex_->clear();
 }
 
 //-----------------------------------------------------------------------------
@@ -835,6 +854,49 @@ void PythonAPI::setFileBuildersForInterface(std::string const& setName)
     builderInterface->setFileBuilders(containingFileSet->getDefaultFileBuilders());
 }
 
+//-----------------------------------------------------------------------------
+// Function: PythonAPI::buildAddressIndex()
+//-----------------------------------------------------------------------------
+int PythonAPI::buildAddressIndex(std::string const& remapState)
+{
+    if (!activeComponent_)
+    {
+        messager_->showError("No component is open.");
+        return 0;
+    }
+
+    addressIndex_->build(activeComponent_, QString::fromStdString(remapState));
+
+    QStringList truncatedItems = addressIndex_->getTruncatedItems();
+    if (truncatedItems.isEmpty() == false)
+    {
+        messager_->showMessage(QString("The address index is incomplete. The element limit was reached at %1.").arg(
+            truncatedItems.first()));
+    }
+
+    return addressIndex_->size();
+}
+
+//-----------------------------------------------------------------------------
+// Function: PythonAPI::findRegistersAt()
+//-----------------------------------------------------------------------------
+std::vector<std::string> PythonAPI::findRegistersAt(std::string const& mapName, unsigned long long address) const
+{
+    std::vector<std::string> paths;
+    for (MemoryMapIndex::Entry const& entry : addressIndex_->findAt(address, QString::fromStdString(mapName)))
+    {
+        QString path = entry.addressBlockName + QLatin1Char('.') + entry.registerName;
+        if (entry.isField())
+        {
+            path.append(QLatin1Char('.') + entry.fieldName);
+        }
+
+        paths.push_back(path.toStdString());
+    }
+
+    return paths;
+}
+
 //-----------------------------------------------------------------------------
 // Function: PythonAPI::createDesign()
 //-----------------------------------------------------------------------------
@@ -1033,24 +1095,25 @@ bool PythonAPI::addComponentInstance(std::string const& vlnvString, std::string
     }
 
     QString combinedVLNV = QString::fromStdString(vlnvString);
-    QSharedPointer<Document> instanceDocument = getDocument(combinedVLNV);
-    if (!instanceDocument)
+    QStringList vlnvList = combinedVLNV.split(":");
+    if (vlnvList.size() != 4)
     {
-        messager_->showMessage(QString("Could not find document %1").arg(combinedVLNV));
+        messager_->showMessage(QString("The VLNV %1 is not correct").arg(combinedVLNV));
         return false;
     }
 
-    QSharedPointer<Component> instanceComponent = instanceDocument.dynamicCast<Component>();
-    if (!instanceComponent)
+    // The component is only checked, so the shared library instance is used instead of a copy.
+    QSharedPointer<Document const> instanceDocument = library_->getModelReadOnly(VLNV(VLNV::COMPONENT,
+        vlnvList.at(0), vlnvList.at(1), vlnvList.at(2), vlnvList.at(3)));
+    if (!instanceDocument)
     {
-        messager_->showMessage(QString("%1 is not a component").arg(combinedVLNV));
+        messager_->showMessage(QString("Could not find document %1").arg(combinedVLNV));
         return false;
     }
 
-    QStringList vlnvList = combinedVLNV.split(":");
-    if (vlnvList.size() < 4)
+    if (!instanceDocument.dynamicCast<Component const>())
     {
-        messager_->showMessage(QString("The VLNV %1 is not correct").arg(combinedVLNV));
+        messager_->showMessage(QString("%1 is not a component").arg(combinedVLNV));
         return false;
     }
 
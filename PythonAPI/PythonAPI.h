@@ -29,6 +29,7 @@
 #include <KactusAPI/include/ComponentAndInstantiationsParameterFinder.h>
 #include <KactusAPI/include/IPXactSystemVerilogParser.h>
 #include <KactusAPI/include/ExpressionFormatter.h>
+#include <KactusAPI/include/MemoryMapIndex.h>
 
 #include <KactusAPI/include/PortsInterface.h>
 #include <KactusAPI/include/ParametersInterface.h>
@@ -147,6 +148,18 @@ public:
      *     @param [in] path  The default path to set for IP-XACT files.
      */
     void setDefaultLibraryPath(std::string const& path) const;
+
+    /*!
+     * Set the memory limit for the parsed IP-XACT documents kept in the library cache.
+     *
+     *     @param [in] megabytes    The limit for the estimated memory use. Zero disables the limit.
+     */
+    void setLibraryCacheLimit(int megabytes) const;
+
+    /*!
+     * Show the hit, miss and eviction counts and the estimated memory use of the library cache.
+     */
+    void showLibraryCacheStatistics() const;
     
     /*!
      * Import a source file (RTL) into the library as a component.
@@ -321,6 +334,27 @@ public:
      *      @param [in] setName     Name of the file set containing the available file builders.
      */
     void setFileBuildersForInterface(std::string const& setName);
+
+    /*!
+     *  Build the address index for the memory maps of the active component.
+     *
+     *      @param [in] remapState  Name of the remap state or mode to index. The default memory map contents are
+     *                              indexed for memory maps without a remap for the state.
+     *
+     *      @return The number of indexed registers and fields. Items beyond the element limit of the index are
+     *              left out and reported.
+     */
+    int buildAddressIndex(std::string const& remapState = std::string());
+
+    /*!
+     *  Find the registers and fields at an address using the address index.
+     *
+     *      @param [in] mapName     Name of the memory map to search in.
+     *      @param [in] address     The address to search for.
+     *
+     *      @return Paths of the registers and fields at the address in the form block.register[.field].
+     */
+    std::vector<std::string> findRegistersAt(std::string const& mapName, unsigned long long address) const;
         
     /*!
      *  Create a new design with the selected VLNV.
@@ -764,6 +798,9 @@ private:
     //! Interface for accessing memory maps.
     MemoryMapInterface* mapInterface_{ nullptr };
 
+    //! Address index over the memory maps of the active component.
+    QSharedPointer<MemoryMapIndex> addressIndex_{ new MemoryMapIndex(expressionParser_) };
+
     //! Interface for accessing file sets.
     FileSetInterface* fileSetInterface_{ nullptr };
 
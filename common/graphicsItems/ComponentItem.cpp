@@ -21,6 +21,8 @@
 
 #include <IPXACTmodels/Design/ComponentInstance.h>
 
+#include <editors/common/DesignDiagram.h>
+
 #include <QFont>
 #include <QPen>
 #include <QTextDocument>
@@ -107,6 +109,7 @@ void ComponentItem::updateSize()
 	qreal width = getWidth();
 
 	setRect(-width/2, oldRect.y(), width, oldRect.height());
+	markGeometryChanged();
 
 	auto stack = dynamic_cast<IGraphicsItemStack*>(parentItem());
 	if (stack != nullptr)
@@ -222,11 +225,29 @@ QVariant ComponentItem::itemChange(GraphicsItemChange change, const QVariant &va
     {
         componentInstance_->setPosition(scenePos());
         positionUpdated();
+        markGeometryChanged();
+    }
+    else if (change == ItemSceneChange || change == ItemSceneHasChanged || change == ItemVisibleHasChanged)
+    {
+        markGeometryChanged();
     }
 
     return QGraphicsItem::itemChange(change, value);
 }
 
+//-----------------------------------------------------------------------------
+// Function: ComponentItem::markGeometryChanged()
+//-----------------------------------------------------------------------------
+void ComponentItem::markGeometryChanged()
+{
+    // The connections cache their undercrossings with the components in the diagram.
+    auto diagram = dynamic_cast<DesignDiagram*>(scene());
+    if (diagram != nullptr)
+    {
+        diagram->markComponentGeometryChanged();
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: ComponentItem::updateNameLabel()
 //-----------------------------------------------------------------------------
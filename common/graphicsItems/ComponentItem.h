@@ -255,6 +255,11 @@ protected:
      */
     void checkPortLabelSize(ConnectionEndpoint* port, QList<ConnectionEndpoint*> const& otherSide);
 
+    /*!
+     *  Notifies the containing diagram that the position or size of the component has changed.
+     */
+    void markGeometryChanged();
+
     static constexpr int SPACING = GridSize;
     static constexpr int MIN_Y_PLACEMENT = 3 * GridSize;
     static constexpr int BOTTOM_MARGIN = 2 * GridSize;
@@ -18,6 +18,7 @@
 #include <common/KactusColors.h>
 
 #include <editors/HWDesign/OffPageConnectorItem.h>
+#include <editors/common/ConnectionSegmentIndex.h>
 #include <editors/common/DesignDiagram.h>
 #include <editors/common/DiagramUtil.h>
 #include <editors/common/DefaultRouting.h>
@@ -26,8 +27,15 @@
 #include <QStyleOptionGraphicsItem>
 #include <QGraphicsScene>
 #include <QPainter>
+#include <QPolygonF>
 #include <QGraphicsSceneMouseEvent>
 
+namespace
+{
+    //! The maximum distance a horizontal segment is moved to fix an overlap.
+    qreal const MAX_SEGMENT_MOVE_Y = 500.0;
+}
+
 //-----------------------------------------------------------------------------
 // Function: GraphicsConnection::GraphicsConnection()
 //-----------------------------------------------------------------------------
@@ -36,6 +44,8 @@ GraphicsConnection::GraphicsConnection(ConnectionEndpoint* endpoint1, Connection
     QGraphicsPathItem(),
     Associable(),
     parent_(parent),
+    segmentIndex_(parent ? parent->getConnectionIndex() :
+        QSharedPointer<ConnectionSegmentIndex<GraphicsConnection> >()),
     endpoint1_(endpoint1),
     endpoint2_(endpoint2),
     route_(route)
@@ -76,7 +86,9 @@ GraphicsConnection::GraphicsConnection(ConnectionEndpoint* endpoint1, Connection
 GraphicsConnection::GraphicsConnection(QPointF const& p1, QVector2D const& dir1,
                                        QPointF const& p2, QVector2D const& dir2,
                                        DesignDiagram* parent):
-    QGraphicsPathItem(), parent_(parent)
+    QGraphicsPathItem(), parent_(parent),
+    segmentIndex_(parent ? parent->getConnectionIndex() :
+        QSharedPointer<ConnectionSegmentIndex<GraphicsConnection> >())
 {
     setItemSettings();
     pathPoints_ = DefaultRouting::createRoute(p1, p2, dir1, dir2);
@@ -88,6 +100,12 @@ GraphicsConnection::GraphicsConnection(QPointF const& p1, QVector2D const& dir1,
 //-----------------------------------------------------------------------------
 GraphicsConnection::~GraphicsConnection()
 {
+    if (QSharedPointer<ConnectionSegmentIndex<GraphicsConnection> > segmentIndex = segmentIndex_.toStrongRef())
+    {
+        invalidateOverlapGeometry();
+        segmentIndex->removeConnection(this);
+    }
+
     disconnectEnds();
     emit destroyed(this);
 }
@@ -210,6 +228,8 @@ ConnectionEndpoint* GraphicsConnection::endpoint2() const
 //-----------------------------------------------------------------------------
 void GraphicsConnection::updatePosition()
 {
+    invalidateOverlapGeometry();
+
     if (routingMode_ == ROUTING_MODE_NORMAL)
     {
         QVector2D startDelta = QVector2D(endpoint1_->scenePos()) - QVector2D(pathPoints_.first());
@@ -600,6 +620,33 @@ void GraphicsConnection::paintConnectionPath()
 
     QPainterPathStroker stroker;
     setPath(stroker.createStroke(path));
+
+    updateSegmentIndex();
+}
+
+//-----------------------------------------------------------------------------
+// Function: GraphicsConnection::updateSegmentIndex()
+//-----------------------------------------------------------------------------
+void GraphicsConnection::updateSegmentIndex()
+{
+    QSharedPointer<ConnectionSegmentIndex<GraphicsConnection> > segmentIndex = segmentIndex_.toStrongRef();
+    if (segmentIndex.isNull())
+    {
+        return;
+    }
+
+    // The connections crossing either the old or the new route have to compute their overlaps again.
+    invalidateOverlapGeometry();
+
+    if (parent_ != nullptr && scene() == parent_)
+    {
+        segmentIndex->updateConnection(this, pathPoints_);
+        invalidateOverlapGeometry();
+    }
+    else
+    {
+        segmentIndex->removeConnection(this);
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -678,6 +725,14 @@ QVariant GraphicsConnection::itemChange(GraphicsItemChange change, const QVarian
             endpoint2_->setSelectionHighlight(selected);
         }
     }
+    else if (change == ItemSceneHasChanged)
+    {
+        updateSegmentIndex();
+    }
+    else if (change == ItemVisibleHasChanged)
+    {
+        invalidateOverlapGeometry();
+    }
 
     return QGraphicsPathItem::itemChange(change, value);
 }
@@ -774,27 +829,133 @@ void GraphicsConnection::setDefaultColor()
 //-----------------------------------------------------------------------------
 void GraphicsConnection::drawOverlapGraphics(QPainter* painter)
 {
-    for (QGraphicsItem* item : scene()->items())
+    // The cached geometry is kept up to date only for the connections in the segment index of the diagram.
+    QSharedPointer<ConnectionSegmentIndex<GraphicsConnection> > segmentIndex = segmentIndex_.toStrongRef();
+    bool const isIndexed = segmentIndex && segmentIndex->contains(this);
+
+    if (isIndexed == false || connectionOverlapsValid_ == false)
+    {
+        overlapGeometry_.junctionPoints.clear();
+        overlapGeometry_.connectionGaps.clear();
+
+        for (GraphicsConnection* connection : findOverlappingConnections())
+        {
+            addOverlapWithConnection(connection);
+        }
+
+        connectionOverlapsValid_ = isIndexed;
+    }
+
+    quint64 const componentRevision = parent_ != nullptr ? parent_->getComponentGeometryRevision() : 0;
+    if (isIndexed == false || componentOverlapsValid_ == false || componentOverlapRevision_ != componentRevision)
+    {
+        overlapGeometry_.componentGaps.clear();
+
+        for (QGraphicsItem* component : findOverlappingComponents())
+        {
+            addOverlapWithComponent(component);
+        }
+
+        componentOverlapsValid_ = isIndexed;
+        componentOverlapRevision_ = componentRevision;
+    }
+
+    painter->setPen(QPen(KactusColors::CONNECTION_UNDERCROSSING, pen().width() + 1));
+    painter->drawLines(overlapGeometry_.connectionGaps);
+    painter->drawLines(overlapGeometry_.componentGaps);
+
+    for (QPointF const& junctionPoint : overlapGeometry_.junctionPoints)
+    {
+        drawJunctionPoint(painter, junctionPoint);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: GraphicsConnection::invalidateOverlapGeometry()
+//-----------------------------------------------------------------------------
+void GraphicsConnection::invalidateOverlapGeometry()
+{
+    connectionOverlapsValid_ = false;
+    componentOverlapsValid_ = false;
+
+    if (QSharedPointer<ConnectionSegmentIndex<GraphicsConnection> > segmentIndex = segmentIndex_.toStrongRef())
+    {
+        for (GraphicsConnection* connection : segmentIndex->findCrossingConnections(this))
+        {
+            connection->connectionOverlapsValid_ = false;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: GraphicsConnection::findOverlappingConnections()
+//-----------------------------------------------------------------------------
+QVector<GraphicsConnection*> GraphicsConnection::findOverlappingConnections()
+{
+    QVector<GraphicsConnection*> overlappingConnections;
+
+    // Only the connections near the segments of this connection can overlap it.
+    QSharedPointer<ConnectionSegmentIndex<GraphicsConnection> > segmentIndex = segmentIndex_.toStrongRef();
+    if (segmentIndex && segmentIndex->contains(this))
+    {
+        for (GraphicsConnection* connection : segmentIndex->findCrossingConnections(this))
+        {
+            if (connection->isVisible())
+            {
+                overlappingConnections.append(connection);
+            }
+        }
+
+        return overlappingConnections;
+    }
+
+    for (QLineF const& pathLine : pathLines_)
     {
-        if (item->isVisible() && item != this)
+        QRectF segmentArea = QRectF(pathLine.p1(), pathLine.p2()).normalized().adjusted(-1, -1, 1, 1);
+
+        for (QGraphicsItem* item : scene()->items(segmentArea, Qt::IntersectsItemBoundingRect))
         {
             auto connection = dynamic_cast<GraphicsConnection*>(item);
-            if (connection && collidesWithItem(item))
+            if (connection && connection != this && connection->isVisible() &&
+                overlappingConnections.contains(connection) == false)
             {
-                drawOverlapWithConnection(painter, connection);
+                overlappingConnections.append(connection);
             }
-            else if(dynamic_cast<ComponentItem*>(item) && collidesWithItem(item))
+        }
+    }
+
+    return overlappingConnections;
+}
+
+//-----------------------------------------------------------------------------
+// Function: GraphicsConnection::findOverlappingComponents()
+//-----------------------------------------------------------------------------
+QVector<QGraphicsItem*> GraphicsConnection::findOverlappingComponents() const
+{
+    QVector<QGraphicsItem*> overlappingComponents;
+
+    // Only the components near the segments of this connection can overlap it.
+    for (QLineF const& pathLine : pathLines_)
+    {
+        QRectF segmentArea = QRectF(pathLine.p1(), pathLine.p2()).normalized().adjusted(-1, -1, 1, 1);
+
+        for (QGraphicsItem* item : scene()->items(segmentArea, Qt::IntersectsItemBoundingRect))
+        {
+            if (item->isVisible() && dynamic_cast<ComponentItem*>(item) &&
+                overlappingComponents.contains(item) == false)
             {
-                drawOverlapWithComponent(painter, item);
+                overlappingComponents.append(item);
             }
         }
     }
+
+    return overlappingComponents;
 }
 
 //-----------------------------------------------------------------------------
-// Function: GraphicsConnection::drawOverlapWithConnection()
+// Function: GraphicsConnection::addOverlapWithConnection()
 //-----------------------------------------------------------------------------
-void GraphicsConnection::drawOverlapWithConnection(QPainter* painter, GraphicsConnection* connection)
+void GraphicsConnection::addOverlapWithConnection(GraphicsConnection* connection)
 {
     QList<QLineF> connectionLines = pointsToLines(connection->route());
 
@@ -815,12 +976,12 @@ void GraphicsConnection::drawOverlapWithConnection(QPainter* painter, GraphicsCo
                         if (endpoint1() == connection->endpoint1() || endpoint2() == connection->endpoint2() ||
                             endpoint1() == connection->endpoint2() || endpoint2() == connection->endpoint1())
                         {
-                            drawJunctionPoint(painter, intersectionPoint);
+                            overlapGeometry_.junctionPoints.append(intersectionPoint);
                         }
                         else
                         {
                             // Otherwise draw a gray undercrossing line close to the intersection point.
-                            drawUndercrossing(painter, pathLine, intersectionPoint, connection->pen().width());
+                            addUndercrossing(pathLine, intersectionPoint, connection->pen().width());
                         }
                     }
                 }
@@ -843,9 +1004,9 @@ void GraphicsConnection::drawJunctionPoint(QPainter* painter, QPointF const& int
 }
 
 //-----------------------------------------------------------------------------
-// Function: GraphicsConnection::drawUndercrossing()
+// Function: GraphicsConnection::addUndercrossing()
 //-----------------------------------------------------------------------------
-void GraphicsConnection::drawUndercrossing(QPainter* painter, QLineF const& path, QPointF const& crossingPoint, 
+void GraphicsConnection::addUndercrossing(QLineF const& path, QPointF const& crossingPoint,
     int crossConnectionWidth)
 {   
     // Drawing is performed using two lines, excluding the area close to
@@ -865,27 +1026,25 @@ void GraphicsConnection::drawUndercrossing(QPainter* painter, QLineF const& path
         crossingWidth++;
     }
 
-    painter->setPen(QPen(KactusColors::CONNECTION_UNDERCROSSING, pen().width() + 1));
-
     if (length1 > 0.5f)
     {
         QPointF seg2Pt1 = (QVector2D(crossingPoint) - direction * qMin(length1, crossingWidth)).toPointF();
         QPointF seg2Pt2 = (QVector2D(crossingPoint) - direction * qMin(length1, (qreal)GridSize/2)).toPointF();
-        painter->drawLine(seg2Pt1, seg2Pt2);
+        overlapGeometry_.connectionGaps.append(QLineF(seg2Pt1, seg2Pt2));
     }
 
     if (length2 > 0.5f)
     {
         QPointF seg1Pt1 = (QVector2D(crossingPoint) + direction * qMin(length2, crossingWidth)).toPointF();
         QPointF seg1Pt2 = (QVector2D(crossingPoint) + direction * qMin(length2, (qreal)GridSize/2)).toPointF();
-        painter->drawLine(seg1Pt1, seg1Pt2);
+        overlapGeometry_.connectionGaps.append(QLineF(seg1Pt1, seg1Pt2));
     }
 }
 
 //-----------------------------------------------------------------------------
-// Function: GraphicsConnection::drawOverlapWithComponent()
+// Function: GraphicsConnection::addOverlapWithComponent()
 //-----------------------------------------------------------------------------
-void GraphicsConnection::drawOverlapWithComponent(QPainter* painter, QGraphicsItem* item)
+void GraphicsConnection::addOverlapWithComponent(QGraphicsItem* item)
 {
     auto comp = static_cast<ComponentItem*>(item);
     QRectF componentRect = comp->rect();
@@ -910,50 +1069,48 @@ void GraphicsConnection::drawOverlapWithComponent(QPainter* painter, QGraphicsIt
         QLineF::IntersectType topIntersection = pathLine.intersects(topEdge, &topPoint);
         QLineF::IntersectType bottomIntersection = pathLine.intersects(bottomEdge, &bottomPoint);
 
-        painter->setPen(QPen(KactusColors::CONNECTION_UNDERCROSSING, pen().width() + 1));
-
         if (leftIntersection == QLineF::BoundedIntersection && leftPoint != pathPoints_.first() &&
             leftPoint != pathPoints_.last())
         {
-            drawLineGap(painter, pathLine, leftPoint);
+            addLineGap(pathLine, leftPoint);
         }
 
         if (rightIntersection == QLineF::BoundedIntersection && rightPoint != pathPoints_.first() &&
             rightPoint != pathPoints_.last())
         {
-            drawLineGap(painter, pathLine, rightPoint);
+            addLineGap(pathLine, rightPoint);
 
             // Fill in the whole line segment under the component if the segment goes across the component
             // horizontally.
             if (leftIntersection == QLineF::BoundedIntersection)
             {
-                painter->drawLine(leftPoint, rightPoint);
+                overlapGeometry_.componentGaps.append(QLineF(leftPoint, rightPoint));
             }
         }
 
         if (topIntersection == QLineF::BoundedIntersection)
         {
-            drawLineGap(painter, pathLine, topPoint);
+            addLineGap(pathLine, topPoint);
         }
 
         if (bottomIntersection == QLineF::BoundedIntersection)
         {
-            drawLineGap(painter, pathLine, bottomPoint);
+            addLineGap(pathLine, bottomPoint);
 
             // Fill in the whole line segment under the component if the segment goes across the component
             // vertically.
             if (topIntersection == QLineF::BoundedIntersection)
             {
-                painter->drawLine(topPoint, bottomPoint);
+                overlapGeometry_.componentGaps.append(QLineF(topPoint, bottomPoint));
             }
         }
     }
 }
 
 //-----------------------------------------------------------------------------
-// Function: GraphicsConnection::drawLineGap()
+// Function: GraphicsConnection::addLineGap()
 //-----------------------------------------------------------------------------
-void GraphicsConnection::drawLineGap(QPainter* painter, QLineF const& line1, QPointF const& pt)
+void GraphicsConnection::addLineGap(QLineF const& line1, QPointF const& pt)
 {
     QVector2D dir(line1.dx(), line1.dy());
     dir.normalize();
@@ -963,7 +1120,7 @@ void GraphicsConnection::drawLineGap(QPainter* painter, QLineF const& line1, QPo
 
     QPointF pt1 = (QVector2D(pt) + dir * qMin(length2, (qreal)GridSize / 2)).toPointF();
     QPointF pt2 = (QVector2D(pt) - dir * qMin(length1, (qreal)GridSize) / 2).toPointF();
-    painter->drawLine(pt1, pt2);
+    overlapGeometry_.componentGaps.append(QLineF(pt1, pt2));
 }
 
 //-----------------------------------------------------------------------------
@@ -974,6 +1131,8 @@ void GraphicsConnection::setLineWidth(int width)
     QPen newPen = pen();
     newPen.setWidth(width);
     setPen(newPen);
+
+    invalidateOverlapGeometry();
 }
 
 //-----------------------------------------------------------------------------
@@ -1199,10 +1358,37 @@ void GraphicsConnection::fixOverlap()
 void GraphicsConnection::createSegmentBounds(QList<SegmentBound>& verticalBounds,
                                              QList<SegmentBound>& horizontalBounds)
 {
-    for (QGraphicsItem* item : scene()->items())
+    QVector<GraphicsConnection const*> connections;
+
+    QSharedPointer<ConnectionSegmentIndex<GraphicsConnection> > segmentIndex = segmentIndex_.toStrongRef();
+    if (segmentIndex && segmentIndex->contains(this))
     {
-        auto const conn = dynamic_cast<GraphicsConnection const*>(item);
+        // The segments keep their extent and horizontal segments move vertically only within the limits of
+        // getSegmentLimitsY(), so only the connections in the horizontal band of this route can bound them.
+        QRectF routeArea = QPolygonF(pathPoints_).boundingRect();
+        QRectF indexedArea = segmentIndex->indexedArea();
 
+        QRectF boundingBand(QPointF(indexedArea.left(), routeArea.top() - MAX_SEGMENT_MOVE_Y - GridSize),
+            QPointF(indexedArea.right(), routeArea.bottom() + MAX_SEGMENT_MOVE_Y + GridSize));
+
+        for (GraphicsConnection* connection : segmentIndex->findConnections(boundingBand))
+        {
+            connections.append(connection);
+        }
+    }
+    else
+    {
+        for (QGraphicsItem* item : scene()->items())
+        {
+            if (auto const conn = dynamic_cast<GraphicsConnection const*>(item))
+            {
+                connections.append(conn);
+            }
+        }
+    }
+
+    for (GraphicsConnection const* conn : connections)
+    {
         // If the connections share an endpoint, discard it from the segment bounds.
         if (conn != 0 && conn != this &&
             endpoint1() != conn->endpoint1() && endpoint2() != conn->endpoint2() &&
@@ -1320,8 +1506,8 @@ QPair<qreal, qreal> GraphicsConnection::getSegmentLimitsX(int i) const
 QPair<qreal, qreal> GraphicsConnection::getSegmentLimitsY(int i) const
 {
     // Use simple distance based min and max.
-    qreal minY = qMax(30.0, pathPoints_.at(i).y() - 500.0);
-    qreal maxY = pathPoints_.at(i).y() + 500.0;
+    qreal minY = qMax(30.0, pathPoints_.at(i).y() - MAX_SEGMENT_MOVE_Y);
+    qreal maxY = pathPoints_.at(i).y() + MAX_SEGMENT_MOVE_Y;
 
     return qMakePair(minY, maxY);
 }
@@ -22,6 +22,7 @@
 #include <QGraphicsTextItem>
 #include <QUndoCommand>
 
+template <class Connection> class ConnectionSegmentIndex;
 class DesignDiagram;
 
 //-----------------------------------------------------------------------------
@@ -310,29 +311,47 @@ private:
     void setDefaultColor();
 
     /*!
-     *  Draws specific helper graphics for overlapping graphics items.
+     *  Draws specific helper graphics for overlapping graphics items. The overlap geometry is computed again
+     *  only if it has been invalidated.
      *
      *      @param [in] painter The painter.
      */
     void drawOverlapGraphics(QPainter* painter);
 
     /*!
-     *  Draws overlapping graphics with another connection.
+     *  Invalidates the overlap geometry of this connection and the connections crossing its route.
+     */
+    void invalidateOverlapGeometry();
+
+    /*!
+     *  Finds the visible connections near the segments of this connection.
+     *
+     *      @return The connections that may overlap this connection.
+     */
+    QVector<GraphicsConnection*> findOverlappingConnections();
+
+    /*!
+     *  Finds the visible component items near the segments of this connection.
+     *
+     *      @return The component items that may overlap this connection.
+     */
+    QVector<QGraphicsItem*> findOverlappingComponents() const;
+
+    /*!
+     *  Computes the overlapping graphics with another connection.
      *
-     *      @param [in] painter     The painter to use.
      *      @param [in] connection  The connection who overlaps with this.
      */
-    void drawOverlapWithConnection(QPainter* painter, GraphicsConnection* connection);
+    void addOverlapWithConnection(GraphicsConnection* connection);
 
     /*!
-     *  Draws an undercrossing with another connection.
+     *  Computes an undercrossing with another connection.
      *
-     *      @param [in] painter                 The painter to use.
      *      @param [in] path                    The segment of the connection intersecting with other connection.
      *      @param [in] crossingPoint           The point where the connections intersect.
      *      @param [in] crossConnectionWidth    The withd of the intersecting connection.
      */
-    void drawUndercrossing(QPainter* painter, QLineF const& path, QPointF const& crossingPoint, int crossConnectionWidth);
+    void addUndercrossing(QLineF const& path, QPointF const& crossingPoint, int crossConnectionWidth);
 
     /*!
      *  Draws a junction point on the connection.
@@ -343,21 +362,40 @@ private:
     void drawJunctionPoint(QPainter* painter, QPointF const& intersectionPoint);
 
     /*!
-     *  Draws overlapping with a component item.
+     *  Updates the route of the connection to the segment index of the diagram, or removes the connection from
+     *  the index if the connection is not in the diagram.
+     */
+    void updateSegmentIndex();
+
+    /*!
+     *  Computes the overlapping graphics with a component item.
      *
-     *      @param [in] painter     The painter to use.
      *      @param [in] item        The component item overlapping the connection.     
      */
-    void drawOverlapWithComponent(QPainter* painter, QGraphicsItem* item);
+    void addOverlapWithComponent(QGraphicsItem* item);
 
     /*!
-     *  Draws a "gap" to a line with the currently selected pen.
+     *  Computes a "gap" to a line under a component item.
      *
-     *      @param [in] painter The painter.
      *      @param [in] line    The line to which to draw the gap.
      *      @param [in] pt      The intersection point where to draw the gap.
      */
-    void drawLineGap(QPainter* painter, QLineF const& line, QPointF const& pt);
+    void addLineGap(QLineF const& line, QPointF const& pt);
+
+    //-----------------------------------------------------------------------------
+    //! The helper graphics drawn where the connection overlaps other items.
+    //-----------------------------------------------------------------------------
+    struct OverlapGeometry
+    {
+        //! The junction points with the connections sharing an endpoint.
+        QVector<QPointF> junctionPoints;
+
+        //! The undercrossing lines with the other connections.
+        QVector<QLineF> connectionGaps;
+
+        //! The undercrossing lines under the component items.
+        QVector<QLineF> componentGaps;
+    };
 
     //-----------------------------------------------------------------------------
     //! Segment bound structure.
@@ -516,6 +554,9 @@ private:
     //! The parent diagram.
     DesignDiagram* parent_ = nullptr;
 
+    //! The segment index of the parent diagram. Not owned, the diagram may be destroyed before the connection.
+    QWeakPointer<ConnectionSegmentIndex<GraphicsConnection> > segmentIndex_;
+
     //! The first endpoint.
     ConnectionEndpoint* endpoint1_ = nullptr;
 
@@ -551,6 +592,18 @@ private:
 
     //! If true, connection is being moved.
     bool positionUpdateInProcess_ = false;
+
+    //! The cached overlap graphics of the connection.
+    OverlapGeometry overlapGeometry_;
+
+    //! If true, the overlaps with other connections are up to date.
+    bool connectionOverlapsValid_ = false;
+
+    //! If true, the overlaps with component items are up to date for componentOverlapRevision_.
+    bool componentOverlapsValid_ = false;
+
+    //! The component geometry revision of the diagram the overlaps with component items were computed for.
+    quint64 componentOverlapRevision_ = 0;
 };
 
 //-----------------------------------------------------------------------------
@@ -29,8 +29,8 @@ AddressBlockGraphicsItem::AddressBlockGraphicsItem(QSharedPointer<MemoryItem con
     QVector<QString> identifierChain, bool isEmptyBlock, bool filterRegisters, bool filterFields,
     qreal addressBlockWidth, QSharedPointer<ConnectivityComponent const> containingInstance,
     MemoryMapGraphicsItem* memoryMapItem):
-MemoryDesignerChildGraphicsItem(blockItem, QStringLiteral("Address Block"), blockItem->getAddress().toULongLong(),
-    blockItem->getRange().toULongLong(), addressBlockWidth, identifierChain, containingInstance, memoryMapItem),
+MemoryDesignerChildGraphicsItem(blockItem, QStringLiteral("Address Block"), blockItem->getAddressValue(),
+    blockItem->getRangeValue(), addressBlockWidth, identifierChain, containingInstance, memoryMapItem),
 SubMemoryLayout(blockItem, MemoryDesignerConstants::REGISTER_TYPE, filterRegisters, this),
 addressUnitBits_(blockItem->getAUB()),
 filterFields_(filterFields)
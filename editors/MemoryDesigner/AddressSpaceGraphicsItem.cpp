@@ -43,7 +43,7 @@ cpuIcon_(new QGraphicsPixmapItem(QPixmap(":icons/common/graphics/settings-code_e
     QBrush addressSpaceBrush(KactusColors::ADDRESS_SEGMENT);
     setBrush(addressSpaceBrush);
 
-    quint64 spaceRangeInt = memoryItem->getRange().toULongLong();
+    quint64 spaceRangeInt = memoryItem->getRangeValue();
     int spaceWidth = 250;
 
     setGraphicsRectangle(spaceWidth + 1, spaceRangeInt);
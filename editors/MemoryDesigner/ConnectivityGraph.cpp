@@ -21,7 +21,8 @@
 ConnectivityGraph::ConnectivityGraph():
 vertices_(),
 edges_(),
-instances_()
+instances_(),
+connectionIndex_()
 {
 
 }
@@ -50,12 +51,40 @@ QVector<QSharedPointer<ConnectivityComponent> >& ConnectivityGraph::getInstances
     return instances_;
 }
 
+//-----------------------------------------------------------------------------
+// Function: ConnectivityGraph::buildConnectionIndex()
+//-----------------------------------------------------------------------------
+void ConnectivityGraph::buildConnectionIndex()
+{
+    connectionIndex_.clear();
+    connectionIndex_.reserve(vertices_.size());
+
+    for (QSharedPointer<ConnectivityConnection const> edge : edges_)
+    {
+        ConnectivityInterface const* firstInterface = edge->getFirstInterface().data();
+        ConnectivityInterface const* secondInterface = edge->getSecondInterface().data();
+
+        connectionIndex_[firstInterface].append(edge);
+        if (secondInterface != firstInterface)
+        {
+            connectionIndex_[secondInterface].append(edge);
+        }
+    }
+
+    indexedConnectionCount_ = edges_.size();
+}
+
 //-----------------------------------------------------------------------------
 // Function: ConnectivityGraph::getConnectionsFor()
 //-----------------------------------------------------------------------------
 QVector<QSharedPointer<ConnectivityConnection const> > ConnectivityGraph::getConnectionsFor(
     QSharedPointer<ConnectivityInterface const> startPoint) const
 {
+    if (indexedConnectionCount_ == edges_.size())
+    {
+        return connectionIndex_.value(startPoint.data());
+    }
+
     QVector<QSharedPointer<ConnectivityConnection const> > connections;
 
     for (int i = 0; i< edges_.size(); ++i)
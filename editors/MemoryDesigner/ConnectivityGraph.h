@@ -12,6 +12,7 @@
 #ifndef CONNECTIVITYGRAPH_H
 #define CONNECTIVITYGRAPH_H
 
+#include <QHash>
 #include <QSharedPointer>
 #include <QVector>
 
@@ -47,6 +48,12 @@ public:
      */
     QVector<QSharedPointer<ConnectivityComponent> >& getInstances() const;
     
+    /*!
+     *  Indexes the connections of each interface for getConnectionsFor(). The index must be rebuilt after
+     *  connections are added to or removed from the graph, otherwise the connections are searched linearly.
+     */
+    void buildConnectionIndex();
+
     /*!
      *  Finds all connections for the given interface.
      *
@@ -93,6 +100,12 @@ private:
 
     //! The component instances in the graph.
     mutable QVector<QSharedPointer<ConnectivityComponent> > instances_;
+
+    //! The connections of each interface in the order of the edges.
+    QHash<ConnectivityInterface const*, QVector<QSharedPointer<ConnectivityConnection const> > > connectionIndex_;
+
+    //! The number of edges in the graph when the connection index was built, or -1 if not built.
+    int indexedConnectionCount_ = -1;
 };
 
 #endif // CONNECTIVITYGRAPH_H
@@ -90,6 +90,8 @@ QSharedPointer<ConnectivityGraph> ConnectivityGraphFactory::createConnectivityGr
         createConnectionsForDesign(topComponent, activeView, instanceInterfaces, graph);
     }
 
+    graph->buildConnectionIndex();
+
     return graph;
 }
 
@@ -280,7 +282,7 @@ QSharedPointer<MemoryItem> ConnectivityGraphFactory::createMemoryMapData(QShared
     QSharedPointer<MemoryItem> mapItem(new MemoryItem(map->name(), MemoryDesignerConstants::MEMORYMAP_TYPE));
     mapItem->setIdentifier(mapIdentifier);
     mapItem->setDisplayName(map->displayName());
-    mapItem->setAUB(QString::number(addressableUnitBits));
+    mapItem->setAUB(addressableUnitBits);
 
     General::Usage mapUsage = General::USAGE_COUNT;
     for (QSharedPointer<MemoryBlockBase> block : *map->getMemoryBlocks())
@@ -338,13 +340,13 @@ QSharedPointer<MemoryItem> ConnectivityGraphFactory::createMemoryAddressBlockIte
     QSharedPointer<const AddressBlock> addressBlock, QString const& mapIdentifier, int addressableUnitBits) const
 {
     QString blockIdentifier = mapIdentifier + "." + addressBlock->name();
-    int baseAddress = expressionParser_->parseExpression(addressBlock->getBaseAddress()).toInt();
+    quint64 baseAddress = expressionParser_->parseExpression(addressBlock->getBaseAddress()).toULongLong();
 
     QSharedPointer<MemoryItem> blockItem(new MemoryItem(addressBlock->name(), MemoryDesignerConstants::ADDRESSBLOCK_TYPE));
     blockItem->setIdentifier(blockIdentifier);
     blockItem->setDisplayName(addressBlock->displayName());
-    blockItem->setAUB(QString::number(addressableUnitBits));
-    blockItem->setAddress(QString::number(baseAddress));
+    blockItem->setAUB(addressableUnitBits);
+    blockItem->setAddress(baseAddress);
     blockItem->setRange(expressionParser_->parseExpression(addressBlock->getRange()));
     blockItem->setWidth(expressionParser_->parseExpression(addressBlock->getWidth()));
     blockItem->setUsage(addressBlock->getUsage());
@@ -386,12 +388,12 @@ QSharedPointer<MemoryItem> ConnectivityGraphFactory::createMemorySubSpaceMapItem
     QSharedPointer<const SubSpaceMap> subspace, QString const& mapIdentifier, int addressableUnitBits) const
 {
     QString blockIdentifier = mapIdentifier + "." + subspace->name();
-    int baseAddress = expressionParser_->parseExpression(subspace->getBaseAddress()).toInt();
+    quint64 baseAddress = expressionParser_->parseExpression(subspace->getBaseAddress()).toULongLong();
 
     QSharedPointer<MemoryItem> blockItem(new MemoryItem(subspace->name(), MemoryDesignerConstants::SUBSPACEMAP_TYPE));
     blockItem->setIdentifier(blockIdentifier);
-    blockItem->setAUB(QString::number(addressableUnitBits));
-    blockItem->setAddress(QString::number(baseAddress));
+    blockItem->setAUB(addressableUnitBits);
+    blockItem->setAddress(baseAddress);
 
     QString blockPresence = subspace->getIsPresent();
     if (blockPresence.isEmpty())
@@ -413,12 +415,12 @@ QSharedPointer<MemoryItem> ConnectivityGraphFactory::createMemorySubSpaceMapItem
 //-----------------------------------------------------------------------------
 // Function: ConnectivityGraphFactory::addRegisterData()
 //-----------------------------------------------------------------------------
-void ConnectivityGraphFactory::addRegisterData(QSharedPointer<const Register> reg, int baseAddress, 
+void ConnectivityGraphFactory::addRegisterData(QSharedPointer<const Register> reg, quint64 baseAddress, 
     int addressableUnitBits, QString const& blockIdentifier, QSharedPointer<MemoryItem> blockItem) const
 {
-    quint64 registerOffset = expressionParser_->parseExpression(reg->getAddressOffset()).toInt();
+    quint64 registerOffset = expressionParser_->parseExpression(reg->getAddressOffset()).toULongLong();
     quint64 registerAddress = baseAddress + registerOffset;
-    int registerSize =  expressionParser_->parseExpression(reg->getSize()).toInt();
+    QString registerSize = expressionParser_->parseExpression(reg->getSize());
     int registerDimension = expressionParser_->parseExpression(reg->getDimension()).toInt();
 
     for (int i = 0; i < registerDimension || (i == 0 && registerDimension == 0); i++)
@@ -429,16 +431,16 @@ void ConnectivityGraphFactory::addRegisterData(QSharedPointer<const Register> re
 
         if (!reg->getDimension().isEmpty())
         {
-            regItem->setDimension(QString::number(registerDimension));
+            regItem->setDimension(registerDimension);
             registerIdentifier.append(QString("[%1]").arg(i));
         }
 
         regItem->setIdentifier(registerIdentifier);
         regItem->setDisplayName(reg->displayName());
-        regItem->setAUB(QString::number(addressableUnitBits));
-        regItem->setAddress(QString::number(registerAddress));
-        regItem->setOffset(QString::number(registerOffset));
-        regItem->setSize(expressionParser_->parseExpression(reg->getSize()));
+        regItem->setAUB(addressableUnitBits);
+        regItem->setAddress(registerAddress);
+        regItem->setOffset(registerOffset);
+        regItem->setSize(registerSize);
 
         QVector<QSharedPointer<MemoryItem> > fieldItems;
 
@@ -463,7 +465,7 @@ void ConnectivityGraphFactory::addRegisterData(QSharedPointer<const Register> re
         regItem->addChild(
             createRegisterResetItem(orderedFieldItems, regItem, registerIdentifier, addressableUnitBits));
 
-        registerAddress += registerSize / addressableUnitBits;
+        registerAddress += regItem->getSizeValue() / addressableUnitBits;
 
         blockItem->addChild(regItem);
     }
@@ -475,15 +477,15 @@ void ConnectivityGraphFactory::addRegisterData(QSharedPointer<const Register> re
 QMap<quint64, QSharedPointer<MemoryItem> > ConnectivityGraphFactory::getOrderedFieldItems(
     QSharedPointer<MemoryItem> registerItem, QVector<QSharedPointer<MemoryItem> > fieldItems) const
 {
-    quint64 registerOffset = registerItem->getAddress().toULongLong();
+    quint64 registerOffset = registerItem->getAddressValue();
     QMap<quint64, QSharedPointer<MemoryItem> > orderedFieldItems;
 
     for (auto fieldItem : fieldItems)
     {
-        quint64 fieldAddress = fieldItem->getAddress().toInt();
-        quint64 fieldStart = fieldItem->getOffset().toInt();
+        quint64 fieldAddress = fieldItem->getAddressValue();
+        quint64 fieldStart = fieldItem->getOffsetValue();
 
-        int aub = fieldItem->getAUB().toInt();
+        quint64 aub = fieldItem->getAUBValue();
 
         fieldStart = (fieldAddress - registerOffset) * aub + fieldStart;
 
@@ -497,18 +499,18 @@ QMap<quint64, QSharedPointer<MemoryItem> > ConnectivityGraphFactory::getOrderedF
 // Function: ConnectivityGraphFactory::createField()
 //-----------------------------------------------------------------------------
 QSharedPointer<MemoryItem> ConnectivityGraphFactory::createField(QSharedPointer<const Field> field, 
-    QString const& registerIdentifier, int regAddress, int addressableUnitBits) const
+    QString const& registerIdentifier, quint64 regAddress, int addressableUnitBits) const
 {
     QString fieldIdentifier = registerIdentifier + "." + field->name();
-    int bitOffset = expressionParser_->parseExpression(field->getBitOffset()).toInt();
+    quint64 bitOffset = expressionParser_->parseExpression(field->getBitOffset()).toULongLong();
 
     QSharedPointer<MemoryItem> fieldItem(new MemoryItem(field->name(), MemoryDesignerConstants::FIELD_TYPE));
     fieldItem->setIdentifier(fieldIdentifier);
     fieldItem->setDisplayName(field->displayName());
-    fieldItem->setAUB(QString::number(addressableUnitBits));
+    fieldItem->setAUB(addressableUnitBits);
     fieldItem->setWidth(expressionParser_->parseExpression(field->getBitWidth()));
-    fieldItem->setAddress(QString::number(regAddress + bitOffset/addressableUnitBits));
-    fieldItem->setOffset(QString::number(bitOffset));
+    fieldItem->setAddress(regAddress + bitOffset/addressableUnitBits);
+    fieldItem->setOffset(bitOffset);
 
     for (auto enumeratedValue : *field->getEnumeratedValues())
     {
@@ -536,7 +538,7 @@ QSharedPointer<MemoryItem> ConnectivityGraphFactory::createEnumeratedValueItem(
     QSharedPointer<MemoryItem> enumItem(new MemoryItem(enumName, MemoryDesignerConstants::ENUMERATED_VALUE_TYPE));
     enumItem->setIdentifier(enumeratedValueIdentifier);
     enumItem->setDisplayName(enumeratedValue->displayName());
-    enumItem->setAUB(QString::number(addressUnitBits));
+    enumItem->setAUB(addressUnitBits);
     enumItem->setValue(expressionParser_->parseExpression(enumeratedValue->getValue()));
 
     return enumItem;
@@ -558,7 +560,7 @@ QSharedPointer<MemoryItem> ConnectivityGraphFactory::createFieldResetItem(QShare
 
     QSharedPointer<MemoryItem> resetItem(new MemoryItem(resetType, MemoryDesignerConstants::RESET_TYPE));
     resetItem->setIdentifier(resetIdentifier);
-    resetItem->setAUB(QString::number(addressUnitBits));
+    resetItem->setAUB(addressUnitBits);
 
     QString resetValue = expressionParser_->parseExpression(fieldReset->getResetValue());
     qulonglong decimalResetValue = resetValue.toULongLong();
@@ -597,7 +599,7 @@ QSharedPointer<MemoryItem> ConnectivityGraphFactory::createRegisterResetItem(
     QSharedPointer<MemoryItem> resetItem(
         new MemoryItem(MemoryDesignerConstants::HARD_RESET_TYPE, MemoryDesignerConstants::RESET_TYPE));
     resetItem->setIdentifier(resetIdentifier);
-    resetItem->setAUB(QString::number(addressUnitBits));
+    resetItem->setAUB(addressUnitBits);
 
     QMapIterator<quint64, QSharedPointer<MemoryItem> > fieldIterator(fieldItems);
     quint64 currentEnd = 0;
@@ -608,7 +610,7 @@ QSharedPointer<MemoryItem> ConnectivityGraphFactory::createRegisterResetItem(
         quint64 fieldEnd = 0;
 
         QSharedPointer<MemoryItem> fieldItem = fieldIterator.value();
-        int fieldWidth = fieldItem->getWidth().toInt();
+        quint64 fieldWidth = fieldItem->getWidthValue();
 
         if (fieldWidth > 0)
         {
@@ -630,15 +632,15 @@ QSharedPointer<MemoryItem> ConnectivityGraphFactory::createRegisterResetItem(
             QString fieldResetValue = fieldResetItem->getResetValue();
             QString fieldResetMask = fieldResetItem->getResetMask();
 
-            fieldResetValue = fieldResetValue.rightJustified(fieldWidth, '0', true);
-            fieldResetMask = fieldResetMask.rightJustified(fieldWidth, '0', true);
+            fieldResetValue = fieldResetValue.rightJustified(static_cast<qsizetype>(fieldWidth), '0', true);
+            fieldResetMask = fieldResetMask.rightJustified(static_cast<qsizetype>(fieldWidth), '0', true);
 
             resetValue.prepend(fieldResetValue);
             resetMask.prepend(fieldResetMask);
         }
         else
         {
-            for (int i = 0; i < fieldWidth; ++i)
+            for (quint64 i = 0; i < fieldWidth; ++i)
             {
                 resetValue.prepend("0");
                 resetMask.prepend("0");
@@ -647,7 +649,7 @@ QSharedPointer<MemoryItem> ConnectivityGraphFactory::createRegisterResetItem(
         currentEnd = fieldEnd + 1;
     }
 
-    quint64 registerSize = registerItem->getSize().toULongLong();
+    quint64 registerSize = registerItem->getSizeValue();
     resetValue = resetValue.rightJustified(registerSize, '0', true);
     resetMask = resetMask.rightJustified(registerSize, '0', true);
 
@@ -692,7 +694,7 @@ void ConnectivityGraphFactory::addMemoryRemapData(QSharedPointer<const MemoryMap
         QSharedPointer<MemoryItem> remapItem(new MemoryItem(remap->name(), MemoryDesignerConstants::MEMORYREMAP_TYPE));
         remapItem->setDisplayName(remap->displayName());
         remapItem->setIdentifier(remapIdentifier);
-        remapItem->setAUB(QString::number(addressableUnitBits));
+        remapItem->setAUB(addressableUnitBits);
 
         mapItem->addChild(remapItem);
 
@@ -179,10 +179,6 @@ public:
      */
     void removeChildInterface(int const& indexOfInterface);
 
-    void setParent(QSharedPointer<ConnectivityInterface> parentInterface);
-
-    [[nodiscard]] QSharedPointer<ConnectivityInterface> getParent() const;
-
 private:
 
 	// Disable copying.
@@ -218,8 +214,6 @@ private:
 
     //! List of the next interface nodes in the tree.
     QVector<QSharedPointer<ConnectivityInterface> > childInterfaceNodes_;
-
-    QSharedPointer<ConnectivityInterface> bfsParent_{ nullptr };
 };
 
 #endif // INTERFACE_H
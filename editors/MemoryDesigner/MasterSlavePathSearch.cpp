@@ -19,18 +19,37 @@
 #include <editors/MemoryDesigner/MemoryDesignerConstants.h>
 
 #include <QQueue>
+#include <QtConcurrent>
 
 //-----------------------------------------------------------------------------
 // Function: MasterSlavePathSearch::findMasterSlavePaths()
 //-----------------------------------------------------------------------------
 QVector<QVector<QSharedPointer<ConnectivityInterface const> > > MasterSlavePathSearch::
-    findMasterSlavePaths(QSharedPointer<const ConnectivityGraph> graph, bool allowOverlappingPaths) const
+    findMasterSlavePaths(QSharedPointer<const ConnectivityGraph> graph, bool allowOverlappingPaths,
+        SearchMode mode) const
 {
     QVector<MasterSlavePathSearch::Path> masterPaths;
 
-    for (auto const& masterInterface : findInitialMasterInterfaces(graph))
+    auto const masterInterfaces = findInitialMasterInterfaces(graph);
+    if (mode == SearchMode::Parallel && masterInterfaces.size() > 1)
     {
-        masterPaths.append(findPaths(masterInterface,  graph));
+        // Each search keeps its BFS state to itself, so the searches only share the read-only graph.
+        // Results are stored in the same order as the master interfaces.
+        auto const pathsOfMasters = QtConcurrent::blockingMapped<QVector<QVector<MasterSlavePathSearch::Path> > >(
+            masterInterfaces, [this, graph](QSharedPointer<ConnectivityInterface> const& masterInterface)
+            { return findPaths(masterInterface, graph); });
+
+        for (auto const& masterPathsOfMaster : pathsOfMasters)
+        {
+            masterPaths.append(masterPathsOfMaster);
+        }
+    }
+    else
+    {
+        for (auto const& masterInterface : masterInterfaces)
+        {
+            masterPaths.append(findPaths(masterInterface, graph));
+        }
     }
 
     masterPaths = findValidPathsIn(masterPaths, allowOverlappingPaths);
@@ -126,11 +145,11 @@ QVector<MasterSlavePathSearch::Path> MasterSlavePathSearch::findPaths(
     QVector<MasterSlavePathSearch::Path> foundPaths;
 
     // Use breadth-first search (BFS) to find shortest paths and avoid loops.
-    // The search spans a BFS tree in the graph using the parent-property of the vertices.
+    // The search spans a BFS tree in the graph. The tree is kept local to the search instead of in the shared
+    // vertices, and the vertices in it are the traversed ones.
     QQueue<QSharedPointer<ConnectivityInterface> > verticesToSearch;
-    QVector<QSharedPointer<ConnectivityInterface> > traversed;
-    startVertex->setParent(nullptr);
-    traversed.append(startVertex);
+    ParentMap parents;
+    parents.insert(startVertex.data(), QSharedPointer<ConnectivityInterface const>());
     verticesToSearch.enqueue(startVertex);
 
     while (verticesToSearch.isEmpty() == false)
@@ -142,10 +161,9 @@ QVector<MasterSlavePathSearch::Path> MasterSlavePathSearch::findPaths(
         for (auto const& nextEdge : connections)
         {
             auto nextVertex = findConnectedInterface(currentVertex, nextEdge);
-            if (traversed.contains(nextVertex) == false && canConnectInterfaces(currentVertex, nextVertex))
+            if (parents.contains(nextVertex.data()) == false && canConnectInterfaces(currentVertex, nextVertex))
             {
-                traversed.append(nextVertex);
-                nextVertex->setParent(currentVertex);
+                parents.insert(nextVertex.data(), currentVertex);
                 verticesToSearch.enqueue(nextVertex);
                 isLeaf = false;
             }
@@ -153,7 +171,7 @@ QVector<MasterSlavePathSearch::Path> MasterSlavePathSearch::findPaths(
 
         if (isLeaf)
         {
-            foundPaths.append(findPathFromRoot(currentVertex));
+            foundPaths.append(findPathFromRoot(currentVertex, parents));
         }
     }
 
@@ -239,16 +257,16 @@ bool MasterSlavePathSearch::canConnectInterfaces(QSharedPointer<ConnectivityInte
 // Function: MasterSlavePathSearch::findPathFromRoot()
 //-----------------------------------------------------------------------------
 MasterSlavePathSearch::Path MasterSlavePathSearch::findPathFromRoot(
-    QSharedPointer<ConnectivityInterface const> endVertex) const
+    QSharedPointer<ConnectivityInterface const> endVertex, ParentMap const& parents) const
 {
     QVector<QSharedPointer<ConnectivityInterface const> > path;
     path.append(endVertex);
 
-    auto i = endVertex;
-    while (i->getParent() != nullptr)
+    auto i = parents.value(endVertex.data());
+    while (i != nullptr)
     {
-        path.append(i->getParent());
-        i = i->getParent();
+        path.append(i);
+        i = parents.value(i.data());
     }
 
     std::reverse(path.begin(), path.end());
@@ -263,10 +281,24 @@ QVector<MasterSlavePathSearch::Path> MasterSlavePathSearch::findValidPathsIn(QVe
 {
     QVector<QVector<QSharedPointer<ConnectivityInterface const> > > highPaths;
 
+    // Paths are only compared to the paths ending in the same interface.
+    QHash<ConnectivityInterface const*, QVector<MasterSlavePathSearch::Path> > pathsByEndInterface;
+    if (allowOverlappingPaths == false)
+    {
+        for (auto const& currentPath : paths)
+        {
+            if (currentPath.isEmpty() == false)
+            {
+                pathsByEndInterface[currentPath.last().data()].append(currentPath);
+            }
+        }
+    }
+
     for (auto const& currentPath : paths)
     {
         if ((currentPath.size() > 1 && pathEndsInMemoryMap(currentPath)) &&
-            (allowOverlappingPaths == true || (allowOverlappingPaths == false && pathIsFullPath(currentPath, paths))))
+            (allowOverlappingPaths == true ||
+            pathIsFullPath(currentPath, pathsByEndInterface.value(currentPath.last().data()))))
         {
             highPaths.append(currentPath);
         }
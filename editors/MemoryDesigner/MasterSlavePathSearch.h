@@ -12,6 +12,7 @@
 #ifndef MASTERSLAVEPATHSEARCH_H
 #define MASTERSLAVEPATHSEARCH_H
 
+#include <QHash>
 #include <QSharedPointer>
 #include <QVector>
 
@@ -28,6 +29,16 @@ public:
 
     using Path = QVector<QSharedPointer<ConnectivityInterface const> >;
 
+    //! The parent of each vertex in a BFS tree. The root vertex has a null parent.
+    using ParentMap = QHash<ConnectivityInterface const*, QSharedPointer<ConnectivityInterface const> >;
+
+    //! The available modes for searching the paths of the master interfaces.
+    enum class SearchMode
+    {
+        Sequential, //!< Paths are searched one master at a time in the calling thread.
+        Parallel    //!< Paths of each master are searched concurrently using the global thread pool.
+    };
+
 	/*!
      *  The constructor.
      */
@@ -38,11 +49,14 @@ public:
      *
      *      @param [in] graph                   The connectivity graph to find the paths from.
      *      @param [in] allowOverlappingPaths   Flag for allowing overlapping paths in the path search.
+     *      @param [in] mode                    The mode for searching the paths. The found paths are the same
+     *                                          and in the same order in both modes.
      *
      *      @return All paths from master interfaces.
      */
     QVector<QVector<QSharedPointer<ConnectivityInterface const> > > findMasterSlavePaths(
-        QSharedPointer<const ConnectivityGraph> graph, bool allowOverlappingPaths) const;
+        QSharedPointer<const ConnectivityGraph> graph, bool allowOverlappingPaths,
+        SearchMode mode = SearchMode::Sequential) const;
 
 private:
 
@@ -118,10 +132,12 @@ private:
      *  Finds the path to the given vertex from the BFS tree root.
      *
      *      @param [in] endVertex   The final (leaf) vertex of the path.
+     *      @param [in] parents     The parents of the vertices in the BFS tree.
      *
      *      @return The path from BFS tree root to the end vertex.
      */
-    MasterSlavePathSearch::Path findPathFromRoot(QSharedPointer<ConnectivityInterface const> endVertex) const;
+    MasterSlavePathSearch::Path findPathFromRoot(QSharedPointer<ConnectivityInterface const> endVertex,
+        ParentMap const& parents) const;
 
     /*!
      *  Finds the valid, longest paths in the given set of paths.
@@ -137,7 +153,7 @@ private:
      *  Check if the selected path should be kept in the master paths.
      *
      *      @param [in] currentPath     The selected path.
-     *      @param [in] availablePaths  All the available paths.
+     *      @param [in] availablePaths  The available paths ending in the same interface as the selected path.
      *
      *      @return True, if the path is a master path, otherwise false.
      */
@@ -93,7 +93,7 @@ void MemoryConnectionHandler::createMemoryConnections(QSharedPointer<Connectivit
     MasterSlavePathSearch pathSearcher;
 
     QVector<QVector<QSharedPointer<ConnectivityInterface const> > > masterSlavePaths =
-        pathSearcher.findMasterSlavePaths(connectionGraph, false);
+        pathSearcher.findMasterSlavePaths(connectionGraph, false, MasterSlavePathSearch::SearchMode::Parallel);
 
     qreal spaceYPlacement = MemoryDesignerConstants::SPACEITEMINTERVAL;
 
@@ -74,7 +74,7 @@ QString MemoryItem::getIdentifier() const
 //-----------------------------------------------------------------------------
 void MemoryItem::setAUB(QString const& aub)
 {
-    aub_ = aub;
+    setNumericProperty(AUB, aub);
 }
 
 //-----------------------------------------------------------------------------
@@ -82,7 +82,23 @@ void MemoryItem::setAUB(QString const& aub)
 //-----------------------------------------------------------------------------
 QString MemoryItem::getAUB() const
 {
-    return aub_;
+    return getNumericPropertyString(AUB);
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::setAUB()
+//-----------------------------------------------------------------------------
+void MemoryItem::setAUB(quint64 aub)
+{
+    setNumericProperty(AUB, aub);
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::getAUBValue()
+//-----------------------------------------------------------------------------
+quint64 MemoryItem::getAUBValue() const
+{
+    return numericValues_[AUB];
 }
 
 //-----------------------------------------------------------------------------
@@ -90,7 +106,7 @@ QString MemoryItem::getAUB() const
 //-----------------------------------------------------------------------------
 void MemoryItem::setAddress(QString const& address)
 {
-    address_ = address;
+    setNumericProperty(ADDRESS, address);
 }
 
 //-----------------------------------------------------------------------------
@@ -98,7 +114,23 @@ void MemoryItem::setAddress(QString const& address)
 //-----------------------------------------------------------------------------
 QString MemoryItem::getAddress() const
 {
-    return address_;
+    return getNumericPropertyString(ADDRESS);
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::setAddress()
+//-----------------------------------------------------------------------------
+void MemoryItem::setAddress(quint64 address)
+{
+    setNumericProperty(ADDRESS, address);
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::getAddressValue()
+//-----------------------------------------------------------------------------
+quint64 MemoryItem::getAddressValue() const
+{
+    return numericValues_[ADDRESS];
 }
 
 //-----------------------------------------------------------------------------
@@ -106,7 +138,7 @@ QString MemoryItem::getAddress() const
 //-----------------------------------------------------------------------------
 void MemoryItem::setRange(QString const& range)
 {
-    range_ = range;
+    setNumericProperty(RANGE, range);
 }
 
 //-----------------------------------------------------------------------------
@@ -114,7 +146,23 @@ void MemoryItem::setRange(QString const& range)
 //-----------------------------------------------------------------------------
 QString MemoryItem::getRange() const
 {
-    return range_;
+    return getNumericPropertyString(RANGE);
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::setRange()
+//-----------------------------------------------------------------------------
+void MemoryItem::setRange(quint64 range)
+{
+    setNumericProperty(RANGE, range);
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::getRangeValue()
+//-----------------------------------------------------------------------------
+quint64 MemoryItem::getRangeValue() const
+{
+    return numericValues_[RANGE];
 }
 
 //-----------------------------------------------------------------------------
@@ -122,7 +170,7 @@ QString MemoryItem::getRange() const
 //-----------------------------------------------------------------------------
 void MemoryItem::setWidth(QString const& width)
 {
-    width_ = width;
+    setNumericProperty(WIDTH, width);
 }
 
 //-----------------------------------------------------------------------------
@@ -130,7 +178,23 @@ void MemoryItem::setWidth(QString const& width)
 //-----------------------------------------------------------------------------
 QString MemoryItem::getWidth() const
 {
-    return width_;
+    return getNumericPropertyString(WIDTH);
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::setWidth()
+//-----------------------------------------------------------------------------
+void MemoryItem::setWidth(quint64 width)
+{
+    setNumericProperty(WIDTH, width);
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::getWidthValue()
+//-----------------------------------------------------------------------------
+quint64 MemoryItem::getWidthValue() const
+{
+    return numericValues_[WIDTH];
 }
 
 //-----------------------------------------------------------------------------
@@ -138,7 +202,7 @@ QString MemoryItem::getWidth() const
 //-----------------------------------------------------------------------------
 void MemoryItem::setSize(QString const& size)
 {
-    size_ = size;
+    setNumericProperty(SIZE, size);
 }
 
 //-----------------------------------------------------------------------------
@@ -146,7 +210,23 @@ void MemoryItem::setSize(QString const& size)
 //-----------------------------------------------------------------------------
 QString MemoryItem::getSize() const
 {
-    return size_;
+    return getNumericPropertyString(SIZE);
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::setSize()
+//-----------------------------------------------------------------------------
+void MemoryItem::setSize(quint64 size)
+{
+    setNumericProperty(SIZE, size);
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::getSizeValue()
+//-----------------------------------------------------------------------------
+quint64 MemoryItem::getSizeValue() const
+{
+    return numericValues_[SIZE];
 }
 
 //-----------------------------------------------------------------------------
@@ -154,7 +234,7 @@ QString MemoryItem::getSize() const
 //-----------------------------------------------------------------------------
 void MemoryItem::setOffset(QString const& offset)
 {
-    offset_ = offset;
+    setNumericProperty(OFFSET, offset);
 }
 
 //-----------------------------------------------------------------------------
@@ -162,7 +242,23 @@ void MemoryItem::setOffset(QString const& offset)
 //-----------------------------------------------------------------------------
 QString MemoryItem::getOffset() const
 {
-    return offset_;
+    return getNumericPropertyString(OFFSET);
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::setOffset()
+//-----------------------------------------------------------------------------
+void MemoryItem::setOffset(quint64 offset)
+{
+    setNumericProperty(OFFSET, offset);
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::getOffsetValue()
+//-----------------------------------------------------------------------------
+quint64 MemoryItem::getOffsetValue() const
+{
+    return numericValues_[OFFSET];
 }
 
 //-----------------------------------------------------------------------------
@@ -186,15 +282,31 @@ QVector<QSharedPointer<MemoryItem> > MemoryItem::getChildItems() const
 //-----------------------------------------------------------------------------
 void MemoryItem::setDimension(QString const& dimension)
 {
-    dimension_ = dimension;
+    setNumericProperty(DIMENSION, dimension);
 }
 
 //-----------------------------------------------------------------------------
-// Function: MemoryItem::getWidth()
+// Function: MemoryItem::getDimension()
 //-----------------------------------------------------------------------------
 QString MemoryItem::getDimension() const
 {
-    return dimension_;
+    return getNumericPropertyString(DIMENSION);
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::setDimension()
+//-----------------------------------------------------------------------------
+void MemoryItem::setDimension(quint64 dimension)
+{
+    setNumericProperty(DIMENSION, dimension);
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::getDimensionValue()
+//-----------------------------------------------------------------------------
+quint64 MemoryItem::getDimensionValue() const
+{
+    return numericValues_[DIMENSION];
 }
 
 //-----------------------------------------------------------------------------
@@ -308,3 +420,52 @@ QString MemoryItem::getSegmentReference() const
 {
     return segmentReference_;
 }
+
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::setNumericProperty()
+//-----------------------------------------------------------------------------
+void MemoryItem::setNumericProperty(NumericProperty property, QString const& value)
+{
+    unresolvedValues_.remove(property);
+
+    bool isNumber = false;
+    quint64 numericValue = value.toULongLong(&isNumber);
+    if (isNumber)
+    {
+        setNumericProperty(property, numericValue);
+        return;
+    }
+
+    numericValues_[property] = 0;
+    setProperties_ &= ~(1u << property);
+
+    // Values that are not plain numbers, e.g. unresolved expressions, are kept as they are.
+    if (value.isEmpty() == false)
+    {
+        unresolvedValues_.insert(property, value);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::setNumericProperty()
+//-----------------------------------------------------------------------------
+void MemoryItem::setNumericProperty(NumericProperty property, quint64 value)
+{
+    unresolvedValues_.remove(property);
+
+    numericValues_[property] = value;
+    setProperties_ |= (1u << property);
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryItem::getNumericPropertyString()
+//-----------------------------------------------------------------------------
+QString MemoryItem::getNumericPropertyString(NumericProperty property) const
+{
+    if (setProperties_ & (1u << property))
+    {
+        return QString::number(numericValues_[property]);
+    }
+
+    return unresolvedValues_.value(property);
+}
@@ -14,10 +14,13 @@
 
 #include <IPXACTmodels/generaldeclarations.h>
 
+#include <QHash>
 #include <QString>
 #include <QSharedPointer>
 #include <QVector>
 
+#include <array>
+
 //-----------------------------------------------------------------------------
 //! A memory in a connectivity graph.
 //-----------------------------------------------------------------------------
@@ -89,6 +92,20 @@ public:
      */
     void setAUB(QString const& aub);
 
+    /*!
+     *  Sets the number of addressable unit bits in the memory as a resolved value.
+     *
+     *      @param [in] aub   The number of bits in an addressable unit.
+     */
+    void setAUB(quint64 aub);
+
+    /*!
+     *  Gets the number of addressable unit bits in the memory as a resolved value.
+     *
+     *      @return The value, or 0 if the value has not been set or is not a number.
+     */
+    quint64 getAUBValue() const;
+
     /*!
      *  Sets the address for the memory.
      *
@@ -103,6 +120,20 @@ public:
      */
     QString getAddress() const;
 
+    /*!
+     *  Sets the address for the memory as a resolved value.
+     *
+     *      @param [in] address   The memory address to set.
+     */
+    void setAddress(quint64 address);
+
+    /*!
+     *  Gets the address for the memory as a resolved value.
+     *
+     *      @return The value, or 0 if the value has not been set or is not a number.
+     */
+    quint64 getAddressValue() const;
+
     /*!
      * Sets the range for the memory.
      *
@@ -117,6 +148,20 @@ public:
      */
     QString getRange() const;
 
+    /*!
+     *  Sets the range for the memory as a resolved value.
+     *
+     *      @param [in] range   The range to set.
+     */
+    void setRange(quint64 range);
+
+    /*!
+     *  Gets the range for the memory as a resolved value.
+     *
+     *      @return The value, or 0 if the value has not been set or is not a number.
+     */
+    quint64 getRangeValue() const;
+
     /*!
      *  Sets the width for the memory.
      *
@@ -131,6 +176,20 @@ public:
      */
     QString getWidth() const;
 
+    /*!
+     *  Sets the memory width in bits as a resolved value.
+     *
+     *      @param [in] width   The memory width to set.
+     */
+    void setWidth(quint64 width);
+
+    /*!
+     *  Gets the memory width in bits as a resolved value.
+     *
+     *      @return The value, or 0 if the value has not been set or is not a number.
+     */
+    quint64 getWidthValue() const;
+
     /*!
      *  Sets the size for the memory.
      *
@@ -145,6 +204,20 @@ public:
      */
     QString getSize() const;
 
+    /*!
+     *  Sets the size for the memory as a resolved value.
+     *
+     *      @param [in] size   The size to set.
+     */
+    void setSize(quint64 size);
+
+    /*!
+     *  Gets the size for the memory as a resolved value.
+     *
+     *      @return The value, or 0 if the value has not been set or is not a number.
+     */
+    quint64 getSizeValue() const;
+
     /*!
      *  Sets the offset for the memory.
      *
@@ -159,6 +232,20 @@ public:
      */
     QString getOffset() const;
 
+    /*!
+     *  Sets the offset for the memory as a resolved value.
+     *
+     *      @param [in] offset   The offset to set.
+     */
+    void setOffset(quint64 offset);
+
+    /*!
+     *  Gets the offset for the memory as a resolved value.
+     *
+     *      @return The value, or 0 if the value has not been set or is not a number.
+     */
+    quint64 getOffsetValue() const;
+
     /*!
      *  Adds a sub-element for the memory.
      *
@@ -187,6 +274,20 @@ public:
      */
     QString getDimension() const;
 
+    /*!
+     *  Sets the dimension of the memory as a resolved value.
+     *
+     *      @param [in] dimension   The new dimension value.
+     */
+    void setDimension(quint64 dimension);
+
+    /*!
+     *  Gets the dimension of the memory as a resolved value.
+     *
+     *      @return The value, or 0 if the value has not been set or is not a number.
+     */
+    quint64 getDimensionValue() const;
+
     /*!
      *  Set the usage for the memory item.
      *
@@ -282,6 +383,45 @@ public:
     QString getSegmentReference() const;
 
 private:
+
+    //! The properties of the memory that are stored as resolved numbers.
+    enum NumericProperty
+    {
+        AUB = 0,
+        ADDRESS,
+        RANGE,
+        WIDTH,
+        SIZE,
+        OFFSET,
+        DIMENSION,
+        NUMERIC_PROPERTY_COUNT
+    };
+
+    /*!
+     *  Sets a numeric property from its string form.
+     *
+     *      @param [in] property    The property to set.
+     *      @param [in] value       The value to set. Values that are not numbers are stored as they are.
+     */
+    void setNumericProperty(NumericProperty property, QString const& value);
+
+    /*!
+     *  Sets a numeric property.
+     *
+     *      @param [in] property    The property to set.
+     *      @param [in] value       The value to set.
+     */
+    void setNumericProperty(NumericProperty property, quint64 value);
+
+    /*!
+     *  Gets the string form of a numeric property.
+     *
+     *      @param [in] property    The property to get.
+     *
+     *      @return The property value, or an empty string if it has not been set.
+     */
+    QString getNumericPropertyString(NumericProperty property) const;
+
     //! The name of the memory element.
     QString name_;
 
@@ -294,29 +434,8 @@ private:
     //! The identifier for the memory.
     QString identifier_;
 
-    //! The number of addressable unit bits in the memory.
-    QString aub_;
-
-    //! The address for the memory.
-    QString address_;
-
-    //! The range for the memory.
-    QString range_;
-
-    //! The bit width for the memory.
-    QString width_;
-
-    //! The size of the memory.
-    QString size_;
-
-    //! The offset of the memory.
-    QString offset_;
-
     QString value_;
 
-    //! The dimension for the memory.
-    QString dimension_;
-
     //! The usage value of the memory item.
     General::Usage usage_{ General::USAGE_COUNT };
 
@@ -335,6 +454,15 @@ private:
     //! The segment reference.
     QString segmentReference_;
 
+    //! The resolved values of the AUB, address, range, width, size, offset and dimension.
+    std::array<quint64, NUMERIC_PROPERTY_COUNT> numericValues_{};
+
+    //! Flags for the numeric properties that have a resolved value.
+    quint8 setProperties_ = 0;
+
+    //! The numeric properties whose values are not numbers, e.g. unresolved expressions.
+    QHash<int, QString> unresolvedValues_;
+
     //! The sub-elements of the memory.
     QVector<QSharedPointer<MemoryItem> > childItems_;
 };
@@ -109,8 +109,8 @@ void MemoryMapGraphicsItem::setupSubItems(qreal blockXPosition, QSharedPointer<M
         {
             if (subItem->getType().compare(MemoryDesignerConstants::ADDRESSBLOCK_TYPE, Qt::CaseInsensitive) == 0)
             {
-                quint64 blockBaseAddress = subItem->getAddress().toULongLong();
-                quint64 blockRange = subItem->getRange().toULongLong();
+                quint64 blockBaseAddress = subItem->getAddressValue();
+                quint64 blockRange = subItem->getRangeValue();
 
                 FilteredBlock blockItem;
                 blockItem.blockName_ = subItem->getName();
@@ -27,13 +27,13 @@
 RegisterGraphicsItem::RegisterGraphicsItem(QSharedPointer<MemoryItem const> registerItem, bool isEmptyRegister,
     qreal registerWidth, QVector<QString> identifierChain, bool filterFields,
     QSharedPointer<ConnectivityComponent const> containingInstance, MemoryDesignerGraphicsItem* parentItem):
-MemoryDesignerChildGraphicsItem(registerItem, QStringLiteral("Register"), registerItem->getAddress().toULongLong(),
-    getRegisterEnd(registerItem->getAUB().toUInt(), registerItem->getSize().toULongLong()), registerWidth,
+MemoryDesignerChildGraphicsItem(registerItem, QStringLiteral("Register"), registerItem->getAddressValue(),
+    getRegisterEnd(registerItem->getAUBValue(), registerItem->getSizeValue()), registerWidth,
     identifierChain, containingInstance, parentItem),
 fieldItems_(),
 isEmpty_(isEmptyRegister),
-registerSize_(registerItem->getSize().toULongLong()),
-addressUnitBits_(registerItem->getAUB().toUInt()),
+registerSize_(registerItem->getSizeValue()),
+addressUnitBits_(registerItem->getAUBValue()),
 filterFields_(filterFields)
 {
     setColors(KactusColors::REGISTER_COLOR, isEmptyRegister);
@@ -161,18 +161,18 @@ QMultiMap<quint64, RegisterGraphicsItem::FieldMemoryItem> RegisterGraphicsItem::
 {
     QMultiMap<quint64, RegisterGraphicsItem::FieldMemoryItem> fieldMap;
 
-    quint64 registerOffset = registerItem->getAddress().toULongLong();
+    quint64 registerOffset = registerItem->getAddressValue();
 
     for (QSharedPointer<MemoryItem const> fieldItem : registerItem->getChildItems())
     {
         if (fieldItem->getType().compare(MemoryDesignerConstants::FIELD_TYPE, Qt::CaseInsensitive) == 0)
         {
-            quint64 fieldAddress = fieldItem->getAddress().toULongLong();
-            quint64 fieldRegisteredOffset = fieldItem->getOffset().toULongLong();
+            quint64 fieldAddress = fieldItem->getAddressValue();
+            quint64 fieldRegisteredOffset = fieldItem->getOffsetValue();
 
             quint64 fieldOffset = (fieldAddress - registerOffset) * addressUnitBits_ + fieldRegisteredOffset;
 
-            quint64 fieldWidth = fieldItem->getWidth().toULongLong();
+            quint64 fieldWidth = fieldItem->getWidthValue();
             if (fieldWidth > 0)
             {
                 quint64 lastBit = fieldOffset + fieldWidth - 1;
@@ -0,0 +1,167 @@
+//-----------------------------------------------------------------------------
+// File: ConnectionSegmentIndex.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 17.10.2026
+//
+// Description:
+// Spatial index over the route segments of the connections in a design diagram.
+//-----------------------------------------------------------------------------
+
+#ifndef CONNECTIONSEGMENTINDEX_H
+#define CONNECTIONSEGMENTINDEX_H
+
+#include <QHash>
+#include <QList>
+#include <QLineF>
+#include <QPointF>
+#include <QRectF>
+#include <QSet>
+#include <QVector>
+
+#include <cmath>
+
+//-----------------------------------------------------------------------------
+//! Spatial index over the route segments of the connections in a design diagram.
+//
+// The segments are stored in a uniform grid of square cells. A segment is stored in every cell its bounding
+// rectangle touches, so that finding the segments in an area only visits the cells of the area instead of
+// all the connections in the diagram. The connections update their segments whenever their route changes.
+// The index only stores the connection pointers, so the connection type is given as a template parameter.
+//-----------------------------------------------------------------------------
+template <class Connection>
+class ConnectionSegmentIndex
+{
+public:
+
+    /*!
+     *  The constructor.
+     *
+     *      @param [in] cellSize    The width and height of a grid cell in scene coordinates.
+     */
+    explicit ConnectionSegmentIndex(qreal cellSize = 200.0);
+
+    //! The destructor.
+    ~ConnectionSegmentIndex() = default;
+
+    // Disable copying.
+    ConnectionSegmentIndex(ConnectionSegmentIndex const& rhs) = delete;
+    ConnectionSegmentIndex& operator=(ConnectionSegmentIndex const& rhs) = delete;
+
+    /*!
+     *  Sets the route of a connection, replacing its previous segments in the index.
+     *
+     *      @param [in] connection  The connection whose route to set.
+     *      @param [in] route       The route points of the connection.
+     */
+    void updateConnection(Connection* connection, QList<QPointF> const& route);
+
+    /*!
+     *  Removes a connection from the index.
+     *
+     *      @param [in] connection  The connection to remove.
+     */
+    void removeConnection(Connection* connection);
+
+    /*!
+     *  Checks if a connection is in the index.
+     *
+     *      @param [in] connection  The connection to check.
+     *
+     *      @return True, if the connection is in the index, otherwise false.
+     */
+    bool contains(Connection* connection) const;
+
+    /*!
+     *  Finds the connections that have a segment touching the given area.
+     *
+     *      @param [in] area    The area to search. Areas with zero width or height are allowed.
+     *
+     *      @return The found connections, each once, in the order they were first found.
+     */
+    QVector<Connection*> findConnections(QRectF const& area) const;
+
+    /*!
+     *  Finds the other connections that have a segment touching the indexed segments of a connection.
+     *
+     *      @param [in] connection  The connection whose segments to check.
+     *
+     *      @return The found connections, each once, in the order they were first found.
+     */
+    QVector<Connection*> findCrossingConnections(Connection* connection) const;
+
+    /*!
+     *  Gets the area covered by the indexed segments.
+     *
+     *  The area is not shrunk when connections are removed or rerouted, since that would require visiting all
+     *  the remaining segments. It is therefore a conservative upper bound of the area of the current segments.
+     *  The area is cleared when the last connection is removed.
+     *
+     *      @return The bounding rectangle of the segments added after the index was last empty.
+     */
+    QRectF indexedArea() const;
+
+private:
+
+    //! A route segment stored in a grid cell.
+    struct CellEntry
+    {
+        Connection* connection;         //!< The connection of the segment.
+        QLineF segment;                 //!< The segment in scene coordinates.
+    };
+
+    /*!
+     *  Gets the key of a grid cell.
+     *
+     *      @param [in] column  The cell column.
+     *      @param [in] row     The cell row.
+     *
+     *      @return The cell key.
+     */
+    static quint64 cellKey(int column, int row);
+
+    /*!
+     *  Gets the cell column or row of a coordinate.
+     *
+     *      @param [in] coordinate  The scene coordinate.
+     *
+     *      @return The cell column or row containing the coordinate.
+     */
+    int cellOf(qreal coordinate) const;
+
+    /*!
+     *  Checks if a segment touches an area, including the area edges.
+     *
+     *      @param [in] segment     The segment to check.
+     *      @param [in] area        The area to check against.
+     *
+     *      @return True, if the bounding rectangle of the segment touches the area.
+     */
+    static bool touches(QLineF const& segment, QRectF const& area);
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The width and height of a grid cell.
+    qreal cellSize_;
+
+    //! The segments in each non-empty cell.
+    QHash<quint64, QVector<CellEntry> > cells_;
+
+    //! The cells containing segments of each connection.
+    QHash<Connection*, QVector<quint64> > connectionCells_;
+
+    //! The bounding rectangle of the added segments, including the ones removed since.
+    QRectF indexedArea_;
+
+    //! Flag for having added any segments to the indexed area.
+    bool hasIndexedArea_;
+};
+
+//-----------------------------------------------------------------------------
+
+#include "ConnectionSegmentIndex.inl"
+
+#endif // CONNECTIONSEGMENTINDEX_H
@@ -0,0 +1,236 @@
+//-----------------------------------------------------------------------------
+// File: ConnectionSegmentIndex.inl
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 17.10.2026
+//
+// Description:
+// Spatial index over the route segments of the connections in a design diagram.
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// Function: ConnectionSegmentIndex<Connection>::ConnectionSegmentIndex()
+//-----------------------------------------------------------------------------
+template <class Connection>
+ConnectionSegmentIndex<Connection>::ConnectionSegmentIndex(qreal cellSize):
+cellSize_(cellSize),
+cells_(),
+connectionCells_(),
+indexedArea_(),
+hasIndexedArea_(false)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: ConnectionSegmentIndex<Connection>::updateConnection()
+//-----------------------------------------------------------------------------
+template <class Connection>
+void ConnectionSegmentIndex<Connection>::updateConnection(Connection* connection, QList<QPointF> const& route)
+{
+    removeConnection(connection);
+
+    QVector<quint64>& usedCells = connectionCells_[connection];
+
+    for (int i = 0; i < route.size() - 1; ++i)
+    {
+        QLineF segment(route.at(i), route.at(i + 1));
+
+        QRectF segmentBounds = QRectF(segment.p1(), segment.p2()).normalized();
+        // QRectF::united() ignores the zero width bounds of horizontal and vertical segments.
+        if (hasIndexedArea_ == false)
+        {
+            indexedArea_ = segmentBounds;
+            hasIndexedArea_ = true;
+        }
+        else
+        {
+            indexedArea_.setLeft(qMin(indexedArea_.left(), segmentBounds.left()));
+            indexedArea_.setTop(qMin(indexedArea_.top(), segmentBounds.top()));
+            indexedArea_.setRight(qMax(indexedArea_.right(), segmentBounds.right()));
+            indexedArea_.setBottom(qMax(indexedArea_.bottom(), segmentBounds.bottom()));
+        }
+
+        int const lastColumn = cellOf(segmentBounds.right());
+        int const lastRow = cellOf(segmentBounds.bottom());
+        for (int column = cellOf(segmentBounds.left()); column <= lastColumn; ++column)
+        {
+            for (int row = cellOf(segmentBounds.top()); row <= lastRow; ++row)
+            {
+                quint64 key = cellKey(column, row);
+                cells_[key].append(CellEntry{ connection, segment });
+
+                if (usedCells.isEmpty() || usedCells.last() != key)
+                {
+                    usedCells.append(key);
+                }
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ConnectionSegmentIndex<Connection>::removeConnection()
+//-----------------------------------------------------------------------------
+template <class Connection>
+void ConnectionSegmentIndex<Connection>::removeConnection(Connection* connection)
+{
+    auto connectionPosition = connectionCells_.find(connection);
+    if (connectionPosition == connectionCells_.end())
+    {
+        return;
+    }
+
+    for (quint64 key : *connectionPosition)
+    {
+        auto cellPosition = cells_.find(key);
+        if (cellPosition != cells_.end())
+        {
+            cellPosition->removeIf([connection](CellEntry const& entry) { return entry.connection == connection; });
+            if (cellPosition->isEmpty())
+            {
+                cells_.erase(cellPosition);
+            }
+        }
+    }
+
+    connectionCells_.erase(connectionPosition);
+
+    if (connectionCells_.isEmpty())
+    {
+        indexedArea_ = QRectF();
+        hasIndexedArea_ = false;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ConnectionSegmentIndex<Connection>::contains()
+//-----------------------------------------------------------------------------
+template <class Connection>
+bool ConnectionSegmentIndex<Connection>::contains(Connection* connection) const
+{
+    return connectionCells_.contains(connection);
+}
+
+//-----------------------------------------------------------------------------
+// Function: ConnectionSegmentIndex<Connection>::findConnections()
+//-----------------------------------------------------------------------------
+template <class Connection>
+QVector<Connection*> ConnectionSegmentIndex<Connection>::findConnections(QRectF const& area) const
+{
+    QVector<Connection*> foundConnections;
+    QSet<Connection*> found;
+
+    QRectF const searchArea = area.normalized();
+
+    int const lastColumn = cellOf(searchArea.right());
+    int const lastRow = cellOf(searchArea.bottom());
+    for (int column = cellOf(searchArea.left()); column <= lastColumn; ++column)
+    {
+        for (int row = cellOf(searchArea.top()); row <= lastRow; ++row)
+        {
+            auto cellPosition = cells_.constFind(cellKey(column, row));
+            if (cellPosition == cells_.constEnd())
+            {
+                continue;
+            }
+
+            for (CellEntry const& entry : *cellPosition)
+            {
+                if (found.contains(entry.connection) == false && touches(entry.segment, searchArea))
+                {
+                    found.insert(entry.connection);
+                    foundConnections.append(entry.connection);
+                }
+            }
+        }
+    }
+
+    return foundConnections;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ConnectionSegmentIndex<Connection>::findCrossingConnections()
+//-----------------------------------------------------------------------------
+template <class Connection>
+QVector<Connection*> ConnectionSegmentIndex<Connection>::findCrossingConnections(Connection* connection) const
+{
+    QVector<Connection*> foundConnections;
+    QSet<Connection*> found;
+
+    auto connectionPosition = connectionCells_.constFind(connection);
+    if (connectionPosition == connectionCells_.constEnd())
+    {
+        return foundConnections;
+    }
+
+    // Segments touching each other always share a cell, so only the cells of the connection are checked.
+    for (quint64 key : *connectionPosition)
+    {
+        auto cellPosition = cells_.constFind(key);
+        if (cellPosition == cells_.constEnd())
+        {
+            continue;
+        }
+
+        for (CellEntry const& ownEntry : *cellPosition)
+        {
+            if (ownEntry.connection != connection)
+            {
+                continue;
+            }
+
+            QRectF const segmentBounds = QRectF(ownEntry.segment.p1(), ownEntry.segment.p2()).normalized();
+            for (CellEntry const& entry : *cellPosition)
+            {
+                if (entry.connection != connection && found.contains(entry.connection) == false &&
+                    touches(entry.segment, segmentBounds))
+                {
+                    found.insert(entry.connection);
+                    foundConnections.append(entry.connection);
+                }
+            }
+        }
+    }
+
+    return foundConnections;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ConnectionSegmentIndex<Connection>::indexedArea()
+//-----------------------------------------------------------------------------
+template <class Connection>
+QRectF ConnectionSegmentIndex<Connection>::indexedArea() const
+{
+    return indexedArea_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ConnectionSegmentIndex<Connection>::cellKey()
+//-----------------------------------------------------------------------------
+template <class Connection>
+quint64 ConnectionSegmentIndex<Connection>::cellKey(int column, int row)
+{
+    return (quint64(quint32(column)) << 32) | quint32(row);
+}
+
+//-----------------------------------------------------------------------------
+// Function: ConnectionSegmentIndex<Connection>::cellOf()
+//-----------------------------------------------------------------------------
+template <class Connection>
+int ConnectionSegmentIndex<Connection>::cellOf(qreal coordinate) const
+{
+    return static_cast<int>(std::floor(coordinate / cellSize_));
+}
+
+//-----------------------------------------------------------------------------
+// Function: ConnectionSegmentIndex<Connection>::touches()
+//-----------------------------------------------------------------------------
+template <class Connection>
+bool ConnectionSegmentIndex<Connection>::touches(QLineF const& segment, QRectF const& area)
+{
+    // QRectF::intersects() does not accept the zero width bounds of horizontal and vertical segments.
+    return qMax(segment.x1(), segment.x2()) >= area.left() && qMin(segment.x1(), segment.x2()) <= area.right() &&
+        qMax(segment.y1(), segment.y2()) >= area.top() && qMin(segment.y1(), segment.y2()) <= area.bottom();
+}
@@ -21,6 +21,7 @@
 #include <common/graphicsItems/GraphicsColumnConstants.h>
 
 #include <editors/common/Association/Association.h>
+#include <editors/common/ConnectionSegmentIndex.h>
 #include <editors/common/diagramgrid.h>
 #include <editors/common/StickyNote/StickyNote.h>
 #include <editors/common/StickyNote/StickyNoteAddCommand.h>
@@ -60,7 +61,9 @@ mode_(MODE_SELECT),
 loading_(false),
 locked_(false),
 interactionMode_(NORMAL),
-associationLine_(0)
+associationLine_(0),
+connectionIndex_(new ConnectionSegmentIndex<GraphicsConnection>()),
+componentGeometryRevision_(0)
 {
     setSceneRect(0, 0, 100000, 100000);
 
@@ -224,6 +227,30 @@ QSharedPointer<IEditProvider> DesignDiagram::getEditProvider() const
     return editProvider_;
 }
 
+//-----------------------------------------------------------------------------
+// Function: DesignDiagram::getConnectionIndex()
+//-----------------------------------------------------------------------------
+QSharedPointer<ConnectionSegmentIndex<GraphicsConnection> > DesignDiagram::getConnectionIndex() const
+{
+    return connectionIndex_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DesignDiagram::markComponentGeometryChanged()
+//-----------------------------------------------------------------------------
+void DesignDiagram::markComponentGeometryChanged()
+{
+    ++componentGeometryRevision_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DesignDiagram::getComponentGeometryRevision()
+//-----------------------------------------------------------------------------
+quint64 DesignDiagram::getComponentGeometryRevision() const
+{
+    return componentGeometryRevision_;
+}
+
 //-----------------------------------------------------------------------------
 // Function: DesignDiagram::getEditedComponent()
 //-----------------------------------------------------------------------------
@@ -34,6 +34,7 @@ class ConnectionEndpoint;
 class GraphicsConnection;
 class GraphicsColumnLayout;
 class ComponentItem;
+template <class Connection> class ConnectionSegmentIndex;
 class Design;
 class VLNV;
 class DesignWidget;
@@ -191,6 +192,21 @@ public:
      */
     virtual QSharedPointer<IEditProvider> getEditProvider() const;
 
+    /*!
+     *  Returns the spatial index of the connection route segments in the diagram.
+     */
+    QSharedPointer<ConnectionSegmentIndex<GraphicsConnection> > getConnectionIndex() const;
+
+    /*!
+     *  Marks the position or size of a component item in the diagram changed.
+     */
+    void markComponentGeometryChanged();
+
+    /*!
+     *  Returns the revision of the component item positions and sizes, increased on every change.
+     */
+    quint64 getComponentGeometryRevision() const;
+
     /*!
      *  Returns the component whose design is being edited.
      */
@@ -579,6 +595,12 @@ private:
     interactionMode interactionMode_;
 
     QGraphicsLineItem* associationLine_;
+
+    //! The spatial index of the connection route segments.
+    QSharedPointer<ConnectionSegmentIndex<GraphicsConnection> > connectionIndex_;
+
+    //! The revision of the component item positions and sizes.
+    quint64 componentGeometryRevision_;
 };
 
 //-----------------------------------------------------------------------------
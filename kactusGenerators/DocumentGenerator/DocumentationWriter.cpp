@@ -281,11 +281,12 @@ void DocumentationWriter::writeReferencedDesignConfigurationInstantiation(QTextS
 {
     if (auto const& configurationVLNV = instantiation->getDesignConfigurationReference(); configurationVLNV)
     {
-        QSharedPointer<Document> configurationDocument = libraryHandler->getModel(*configurationVLNV);
+        QSharedPointer<Document const> configurationDocument =
+            libraryHandler->getModelReadOnly(*configurationVLNV);
         if (configurationDocument)
         {
-            QSharedPointer<DesignConfiguration> configuration =
-                configurationDocument.dynamicCast<DesignConfiguration>();
+            QSharedPointer<DesignConfiguration const> configuration =
+                configurationDocument.dynamicCast<DesignConfiguration const>();
 
             if (configuration)
             {
@@ -137,6 +137,9 @@ int main(int argc, char *argv[])
     auto& library = LibraryHandler::getInstance();
     library.setOutputChannel(mediator.data());
 
+    // Parsed documents are kept in memory without limit, unless a limit is set in megabytes.
+    library.setCacheLimit(settings.value(QStringLiteral("Library/CacheLimitMB"), 0).toLongLong() * 1024 * 1024);
+
     QScopedPointer<KactusAPI> coreAPI(new KactusAPI(mediator.data()));
 
     wchar_t *program = Py_DecodeLocale(argv[0], NULL);
@@ -151,6 +154,9 @@ int main(int argc, char *argv[])
 
     if (startGui(argc))
     {
+        // Validate the library in the background to show the library views without delay.
+        library.setValidationMode(LibraryHandler::ValidationMode::Background);
+
         // Create the main window and close the splash after 1.5 seconds.
         MainWindow mainWindow(&library, mediator.data());
 
@@ -189,6 +195,7 @@ int main(int argc, char *argv[])
         
         if (parser.commandlineMode())
         {
+            library.setValidationMode(LibraryHandler::ValidationMode::Parallel);
             library.searchForIPXactFiles();
 
             QScopedPointer<FileChannel> outChannel(new FileChannel(stdout));
@@ -33,4 +33,5 @@ SUBDIRS += \
             tst_DocumentTreeBuilder.pro \
             tst_DocumentGenerator.pro \
             tst_MarkdownGenerator.pro \
-            tst_MasterSlavePathSearch.pro
+            tst_MasterSlavePathSearch.pro \
+            tst_ConnectionSegmentIndex.pro
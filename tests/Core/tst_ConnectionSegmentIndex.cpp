@@ -0,0 +1,275 @@
+//-----------------------------------------------------------------------------
+// File: tst_ConnectionSegmentIndex.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 17.10.2026
+//
+// Description:
+// Unit test for class ConnectionSegmentIndex.
+//-----------------------------------------------------------------------------
+
+#include <editors/common/ConnectionSegmentIndex.h>
+
+#include <QtTest>
+
+//-----------------------------------------------------------------------------
+//! Connection stand-in for the index, which only stores the connection pointers.
+//-----------------------------------------------------------------------------
+struct TestConnection
+{
+    QString name;
+};
+
+class tst_ConnectionSegmentIndex : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_ConnectionSegmentIndex();
+
+private slots:
+
+    void testFindConnectionsInArea();
+
+    void testUpdateConnectionReplacesRoute();
+
+    void testRemoveConnection();
+
+    void testRemoveConnectionWithRevisitedCells();
+
+    void testSegmentsOnCellEdgesAreFound();
+
+    void testNegativeCoordinates();
+
+    void testZeroWidthSegments();
+
+    void testFindCrossingConnections();
+
+    void testIndexedAreaIsUpperBound();
+
+private:
+
+    //! The connection stand-ins and the pointers the index is given.
+    TestConnection firstConnection_;
+    TestConnection secondConnection_;
+    TestConnection thirdConnection_;
+
+    TestConnection* first_;
+    TestConnection* second_;
+    TestConnection* third_;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_ConnectionSegmentIndex::tst_ConnectionSegmentIndex()
+//-----------------------------------------------------------------------------
+tst_ConnectionSegmentIndex::tst_ConnectionSegmentIndex():
+firstConnection_{ QStringLiteral("first") },
+secondConnection_{ QStringLiteral("second") },
+thirdConnection_{ QStringLiteral("third") },
+first_(&firstConnection_),
+second_(&secondConnection_),
+third_(&thirdConnection_)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ConnectionSegmentIndex::testFindConnectionsInArea()
+//-----------------------------------------------------------------------------
+void tst_ConnectionSegmentIndex::testFindConnectionsInArea()
+{
+    ConnectionSegmentIndex<TestConnection> index(100.0);
+    index.updateConnection(first_, { QPointF(10, 10), QPointF(250, 10), QPointF(250, 90) });
+    index.updateConnection(second_, { QPointF(10, 400), QPointF(90, 400) });
+
+    QVERIFY(index.contains(first_));
+    QVERIFY(index.contains(second_));
+    QVERIFY(index.contains(third_) == false);
+
+    QVector<TestConnection*> found = index.findConnections(QRectF(200, 50, 100, 100));
+    QCOMPARE(found.size(), 1);
+    QCOMPARE(found.first(), first_);
+
+    found = index.findConnections(QRectF(0, 0, 300, 500));
+    QCOMPARE(found.size(), 2);
+    QVERIFY(found.contains(first_));
+    QVERIFY(found.contains(second_));
+
+    QVERIFY(index.findConnections(QRectF(100, 200, 50, 50)).isEmpty());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ConnectionSegmentIndex::testUpdateConnectionReplacesRoute()
+//-----------------------------------------------------------------------------
+void tst_ConnectionSegmentIndex::testUpdateConnectionReplacesRoute()
+{
+    ConnectionSegmentIndex<TestConnection> index(100.0);
+    index.updateConnection(first_, { QPointF(10, 10), QPointF(90, 10) });
+    index.updateConnection(first_, { QPointF(510, 510), QPointF(590, 510) });
+
+    QVERIFY(index.findConnections(QRectF(0, 0, 100, 100)).isEmpty());
+    QCOMPARE(index.findConnections(QRectF(500, 500, 100, 100)), QVector<TestConnection*>({ first_ }));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ConnectionSegmentIndex::testRemoveConnection()
+//-----------------------------------------------------------------------------
+void tst_ConnectionSegmentIndex::testRemoveConnection()
+{
+    ConnectionSegmentIndex<TestConnection> index(100.0);
+    index.updateConnection(first_, { QPointF(10, 10), QPointF(90, 10) });
+    index.updateConnection(second_, { QPointF(10, 20), QPointF(90, 20) });
+
+    index.removeConnection(first_);
+
+    QVERIFY(index.contains(first_) == false);
+    QCOMPARE(index.findConnections(QRectF(0, 0, 100, 100)), QVector<TestConnection*>({ second_ }));
+
+    // Removing a connection not in the index does nothing.
+    index.removeConnection(first_);
+    index.removeConnection(third_);
+
+    QCOMPARE(index.findConnections(QRectF(0, 0, 100, 100)), QVector<TestConnection*>({ second_ }));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ConnectionSegmentIndex::testRemoveConnectionWithRevisitedCells()
+//-----------------------------------------------------------------------------
+void tst_ConnectionSegmentIndex::testRemoveConnectionWithRevisitedCells()
+{
+    ConnectionSegmentIndex<TestConnection> index(100.0);
+
+    // The route leaves the first cell and returns to it, so the connection is stored twice in both cells.
+    index.updateConnection(first_,
+        { QPointF(10, 10), QPointF(150, 10), QPointF(150, 20), QPointF(10, 20), QPointF(10, 30),
+          QPointF(150, 30) });
+    index.updateConnection(second_, { QPointF(20, 50), QPointF(180, 50) });
+
+    index.removeConnection(first_);
+
+    QVERIFY(index.contains(first_) == false);
+    QCOMPARE(index.findConnections(QRectF(0, 0, 200, 100)), QVector<TestConnection*>({ second_ }));
+
+    index.removeConnection(second_);
+
+    QVERIFY(index.findConnections(QRectF(0, 0, 200, 100)).isEmpty());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ConnectionSegmentIndex::testSegmentsOnCellEdgesAreFound()
+//-----------------------------------------------------------------------------
+void tst_ConnectionSegmentIndex::testSegmentsOnCellEdgesAreFound()
+{
+    ConnectionSegmentIndex<TestConnection> index(100.0);
+
+    // A vertical segment exactly on the edge between the first two cell columns.
+    index.updateConnection(first_, { QPointF(100, 10), QPointF(100, 50) });
+
+    // A vertical segment ending exactly on the edge between the first two cell rows.
+    index.updateConnection(second_, { QPointF(300, 20), QPointF(300, 100) });
+
+    QCOMPARE(index.findConnections(QRectF(QPointF(50, 10), QPointF(100, 50))),
+        QVector<TestConnection*>({ first_ }));
+    QCOMPARE(index.findConnections(QRectF(QPointF(100, 10), QPointF(150, 50))),
+        QVector<TestConnection*>({ first_ }));
+    QVERIFY(index.findConnections(QRectF(QPointF(50, 10), QPointF(99, 50))).isEmpty());
+
+    QCOMPARE(index.findConnections(QRectF(QPointF(290, 100), QPointF(310, 120))),
+        QVector<TestConnection*>({ second_ }));
+    QVERIFY(index.findConnections(QRectF(QPointF(290, 101), QPointF(310, 120))).isEmpty());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ConnectionSegmentIndex::testNegativeCoordinates()
+//-----------------------------------------------------------------------------
+void tst_ConnectionSegmentIndex::testNegativeCoordinates()
+{
+    ConnectionSegmentIndex<TestConnection> index(100.0);
+    index.updateConnection(first_, { QPointF(-150, -150), QPointF(-120, -150) });
+    index.updateConnection(second_, { QPointF(-50, 50), QPointF(-40, 50) });
+    index.updateConnection(third_, { QPointF(-50, 250), QPointF(50, 250) });
+
+    QCOMPARE(index.findConnections(QRectF(-140, -160, 10, 20)), QVector<TestConnection*>({ first_ }));
+    QVERIFY(index.findConnections(QRectF(120, 140, 30, 20)).isEmpty());
+
+    // The cells at column -1, row 0 and column 0, row -1 must have different keys.
+    QCOMPARE(index.findConnections(QRectF(-60, 40, 30, 20)), QVector<TestConnection*>({ second_ }));
+    QVERIFY(index.findConnections(QRectF(40, -60, 20, 30)).isEmpty());
+
+    // A segment crossing zero is found from both sides.
+    QCOMPARE(index.findConnections(QRectF(-30, 240, 10, 20)), QVector<TestConnection*>({ third_ }));
+    QCOMPARE(index.findConnections(QRectF(20, 240, 10, 20)), QVector<TestConnection*>({ third_ }));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ConnectionSegmentIndex::testZeroWidthSegments()
+//-----------------------------------------------------------------------------
+void tst_ConnectionSegmentIndex::testZeroWidthSegments()
+{
+    ConnectionSegmentIndex<TestConnection> index(100.0);
+    index.updateConnection(first_, { QPointF(0, 50), QPointF(80, 50) });
+    index.updateConnection(second_, { QPointF(30, 30), QPointF(30, 30) });
+
+    // A search area with zero height on the horizontal segment.
+    QCOMPARE(index.findConnections(QRectF(QPointF(20, 50), QPointF(40, 50))),
+        QVector<TestConnection*>({ first_ }));
+    QVERIFY(index.findConnections(QRectF(QPointF(20, 51), QPointF(40, 51))).isEmpty());
+
+    // A segment of a single point.
+    QCOMPARE(index.findConnections(QRectF(QPointF(30, 30), QPointF(30, 30))),
+        QVector<TestConnection*>({ second_ }));
+    QCOMPARE(index.findConnections(QRectF(25, 25, 10, 10)), QVector<TestConnection*>({ second_ }));
+    QVERIFY(index.findConnections(QRectF(31, 25, 10, 10)).isEmpty());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ConnectionSegmentIndex::testFindCrossingConnections()
+//-----------------------------------------------------------------------------
+void tst_ConnectionSegmentIndex::testFindCrossingConnections()
+{
+    ConnectionSegmentIndex<TestConnection> index(100.0);
+    index.updateConnection(first_, { QPointF(0, 50), QPointF(300, 50) });
+    index.updateConnection(second_, { QPointF(150, 0), QPointF(150, 100) });
+    index.updateConnection(third_, { QPointF(0, 80), QPointF(300, 80) });
+
+    QCOMPARE(index.findCrossingConnections(first_), QVector<TestConnection*>({ second_ }));
+
+    QVector<TestConnection*> found = index.findCrossingConnections(second_);
+    QCOMPARE(found.size(), 2);
+    QVERIFY(found.contains(first_));
+    QVERIFY(found.contains(third_));
+
+    index.removeConnection(second_);
+
+    QVERIFY(index.findCrossingConnections(first_).isEmpty());
+    QVERIFY(index.findCrossingConnections(second_).isEmpty());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ConnectionSegmentIndex::testIndexedAreaIsUpperBound()
+//-----------------------------------------------------------------------------
+void tst_ConnectionSegmentIndex::testIndexedAreaIsUpperBound()
+{
+    ConnectionSegmentIndex<TestConnection> index(100.0);
+    QVERIFY(index.indexedArea().isNull());
+
+    index.updateConnection(first_, { QPointF(0, 0), QPointF(100, 0) });
+    index.updateConnection(second_, { QPointF(500, 500), QPointF(600, 500) });
+
+    QCOMPARE(index.indexedArea(), QRectF(QPointF(0, 0), QPointF(600, 500)));
+
+    // The area is not shrunk while other connections remain.
+    index.removeConnection(second_);
+    QCOMPARE(index.indexedArea(), QRectF(QPointF(0, 0), QPointF(600, 500)));
+
+    index.removeConnection(first_);
+    QVERIFY(index.indexedArea().isNull());
+
+    index.updateConnection(third_, { QPointF(-20, 40), QPointF(-20, 80) });
+    QCOMPARE(index.indexedArea(), QRectF(QPointF(-20, 40), QPointF(-20, 80)));
+}
+
+QTEST_APPLESS_MAIN(tst_ConnectionSegmentIndex)
+
+#include "tst_ConnectionSegmentIndex.moc"
@@ -0,0 +1,6 @@
+# ----------------------------------------------------
+# This file is generated by the Qt Visual Studio Add-in.
+# ------------------------------------------------------
+
+HEADERS += ../../editors/common/ConnectionSegmentIndex.h
+SOURCES += ./tst_ConnectionSegmentIndex.cpp
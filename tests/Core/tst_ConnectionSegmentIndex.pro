@@ -0,0 +1,40 @@
+#-----------------------------------------------------------------------------
+# File: tst_ConnectionSegmentIndex.pro
+#-----------------------------------------------------------------------------
+# Project: Kactus2
+# Author: agent
+# Date: 17.10.2026
+#
+# Description:
+# Qt project file for running unit tests for the connection segment index.
+#-----------------------------------------------------------------------------
+
+TEMPLATE = app
+
+TARGET = tst_ConnectionSegmentIndex
+
+QT += core testlib
+CONFIG += c++11 testcase console
+
+win32:CONFIG(release, debug|release) {
+    DESTDIR = ./release
+}
+else:win32:CONFIG(debug, debug|release) {
+    DESTDIR = ./debug
+}
+else:unix {
+    DESTDIR = ./release
+}
+
+INCLUDEPATH += $$PWD/../../
+INCLUDEPATH += $$DESTDIR
+
+DEPENDPATH += $$PWD/../../
+DEPENDPATH += .
+
+OBJECTS_DIR += $$DESTDIR
+
+MOC_DIR += ./generatedFiles
+UI_DIR += ./generatedFiles
+RCC_DIR += ./generatedFiles
+include(tst_ConnectionSegmentIndex.pri)
@@ -82,6 +82,7 @@ HEADERS += ../../editors/HWDesign/undoCommands/AdHocConnectionAddCommand.h \
     ../../common/widgets/componentPreviewBox/ComponentPreviewBox.h \
     ../../editors/common/ComponentInstanceEditor/ConfigurableElementsView.h \
     ../../common/graphicsItems/ConnectionEndpoint.h \
+    ../../editors/common/ConnectionSegmentIndex.h \
     ../../editors/common/DesignDiagram.h \
     ../../editors/common/DesignWidget.h \
     ../../common/views/EditableTreeView/EditableTreeSortFilter.h \
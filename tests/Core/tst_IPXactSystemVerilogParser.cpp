@@ -27,6 +27,28 @@
 
 #include <IPXACTmodels/common/Parameter.h>
 
+//-----------------------------------------------------------------------------
+//! Parameter finder counting the reads of the parameter values.
+//-----------------------------------------------------------------------------
+class CountingParameterFinder : public ComponentParameterFinder
+{
+public:
+
+    explicit CountingParameterFinder(QSharedPointer<Component> component):
+    ComponentParameterFinder(component)
+    {
+
+    }
+
+    QString valueForId(QStringView id) const override
+    {
+        ++valueReadCount_;
+        return ComponentParameterFinder::valueForId(id);
+    }
+
+    //! The number of value reads.
+    mutable int valueReadCount_ = 0;
+};
 
 class tst_IPXactSystemVerilogParser : public QObject
 {
@@ -43,6 +65,10 @@ private slots:
     void testExpressionWithUnknownReference();
     void testParameterWithoutId();
     void testParameterWithGeneratedId();
+    void testRepeatedExpressionFollowsParameterChanges();
+    void testChangeInReferencedParameterUpdatesChain();
+    void testParseExpressionSet();
+    void testParametersAreCheckedOncePerExpression();
 
     void testExpressionWithParameterReferences();
     void testExpressionWithParameterReferences_data();
@@ -165,6 +191,149 @@ void tst_IPXactSystemVerilogParser::testParameterWithGeneratedId()
     QCOMPARE(parser.parseExpression(firstParameter->getValueId()), QString("1"));
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_IPXactSystemVerilogParser::testRepeatedExpressionFollowsParameterChanges()
+//-----------------------------------------------------------------------------
+void tst_IPXactSystemVerilogParser::testRepeatedExpressionFollowsParameterChanges()
+{
+    QSharedPointer<Component> testComponent(new Component(VLNV(), Document::Revision::Std14));
+    QSharedPointer<Parameter> firstParameter(new Parameter());
+    firstParameter->setValueId("firstId");
+    firstParameter->setValue("2");
+    testComponent->getParameters()->append(firstParameter);
+
+    IPXactSystemVerilogParser parser(QSharedPointer<ParameterFinder>(new ComponentParameterFinder(testComponent)));
+
+    bool isValid = true;
+    parser.parseExpression(QString("firstId*firstId + secondId"), &isValid);
+    QCOMPARE(isValid, false);
+
+    firstParameter->setValue("3");
+
+    QSharedPointer<Parameter> secondParameter(new Parameter());
+    secondParameter->setValueId("secondId");
+    secondParameter->setValue("1");
+    testComponent->getParameters()->append(secondParameter);
+
+    QCOMPARE(parser.parseExpression(QString("firstId*firstId + secondId"), &isValid), QString("10"));
+    QCOMPARE(isValid, true);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_IPXactSystemVerilogParser::testChangeInReferencedParameterUpdatesChain()
+//-----------------------------------------------------------------------------
+void tst_IPXactSystemVerilogParser::testChangeInReferencedParameterUpdatesChain()
+{
+    QSharedPointer<Component> testComponent(new Component(VLNV(), Document::Revision::Std14));
+
+    QSharedPointer<Parameter> baseParameter(new Parameter());
+    baseParameter->setValueId("baseId");
+    baseParameter->setValue("4");
+    testComponent->getParameters()->append(baseParameter);
+
+    QSharedPointer<Parameter> middleParameter(new Parameter());
+    middleParameter->setValueId("middleId");
+    middleParameter->setValue("baseId*2");
+    testComponent->getParameters()->append(middleParameter);
+
+    QSharedPointer<Parameter> topParameter(new Parameter());
+    topParameter->setValueId("topId");
+    topParameter->setValue("middleId + baseId");
+    testComponent->getParameters()->append(topParameter);
+
+    IPXactSystemVerilogParser parser(QSharedPointer<ParameterFinder>(new ComponentParameterFinder(testComponent)));
+
+    QCOMPARE(parser.parseExpression(QString("topId")), QString("12"));
+    QCOMPARE(parser.parseExpression(QString("topId")), QString("12"));
+
+    baseParameter->setValue("1");
+    QCOMPARE(parser.parseExpression(QString("topId")), QString("3"));
+    QCOMPARE(parser.parseExpression(QString("middleId")), QString("2"));
+
+    middleParameter->setValue("topId");
+    bool isValid = true;
+    parser.parseExpression(QString("topId"), &isValid);
+    QCOMPARE(isValid, false);
+
+    middleParameter->setValue("10");
+    QCOMPARE(parser.parseExpression(QString("topId"), &isValid), QString("11"));
+    QCOMPARE(isValid, true);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_IPXactSystemVerilogParser::testParseExpressionSet()
+//-----------------------------------------------------------------------------
+void tst_IPXactSystemVerilogParser::testParseExpressionSet()
+{
+    QSharedPointer<Component> testComponent(new Component(VLNV(), Document::Revision::Std14));
+
+    QSharedPointer<Parameter> baseParameter(new Parameter());
+    baseParameter->setValueId("baseId");
+    baseParameter->setValue("'h100");
+    testComponent->getParameters()->append(baseParameter);
+
+    QSharedPointer<Parameter> rangeParameter(new Parameter());
+    rangeParameter->setValueId("rangeId");
+    rangeParameter->setValue("baseId/4");
+    testComponent->getParameters()->append(rangeParameter);
+
+    IPXactSystemVerilogParser parser(QSharedPointer<ParameterFinder>(new ComponentParameterFinder(testComponent)));
+
+    QStringList expressions({ "baseId", "rangeId", "baseId + rangeId", "baseId", "unknownId", "1" });
+    ExpressionParser::ResultTable results = parser.parseExpressions(expressions);
+
+    QCOMPARE(results.size(), 5);
+    for (QString const& expression : expressions)
+    {
+        bool isValid = false;
+        QString value = parser.parseExpression(expression, &isValid);
+
+        QVERIFY(results.contains(expression));
+        QCOMPARE(results.value(expression).valid, isValid);
+        QCOMPARE(results.value(expression).value, value);
+    }
+
+    QCOMPARE(results.value("baseId + rangeId").value, QString("320"));
+    QCOMPARE(results.value("unknownId").value, QString("x"));
+
+    baseParameter->setValue("8");
+    results = parser.parseExpressions(expressions);
+    QCOMPARE(results.value("baseId + rangeId").value, QString("10"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_IPXactSystemVerilogParser::testParametersAreCheckedOncePerExpression()
+//-----------------------------------------------------------------------------
+void tst_IPXactSystemVerilogParser::testParametersAreCheckedOncePerExpression()
+{
+    QSharedPointer<Component> testComponent(new Component(VLNV(), Document::Revision::Std14));
+
+    QSharedPointer<Parameter> baseParameter(new Parameter());
+    baseParameter->setValueId("baseId");
+    baseParameter->setValue("4");
+    testComponent->getParameters()->append(baseParameter);
+
+    QSharedPointer<Parameter> rangeParameter(new Parameter());
+    rangeParameter->setValueId("rangeId");
+    rangeParameter->setValue("baseId*2");
+    testComponent->getParameters()->append(rangeParameter);
+
+    QSharedPointer<CountingParameterFinder> finder(new CountingParameterFinder(testComponent));
+    IPXactSystemVerilogParser parser(finder);
+
+    QString const expression("baseId + rangeId + baseId*rangeId");
+    QCOMPARE(parser.parseExpression(expression), QString("44"));
+
+    // Each memoized parameter is checked for changes once, however many times it is referenced.
+    finder->valueReadCount_ = 0;
+    QCOMPARE(parser.parseExpression(expression), QString("44"));
+    QCOMPARE(finder->valueReadCount_, 2);
+
+    // A change is noticed in the next expression.
+    baseParameter->setValue("1");
+    QCOMPARE(parser.parseExpression(expression), QString("5"));
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_IPXactSystemVerilogParser::testExpressionWithParameterReferences()
 //-----------------------------------------------------------------------------
@@ -49,6 +49,10 @@ private slots:
 
     void testContainedConnectionsAreNotExamined();
 
+    void testIndexedConnectionsGiveSamePaths();
+
+    void testParallelSearchGivesSamePaths();
+
 private:
 
     QSharedPointer<ConnectivityGraph> testGraph_;
@@ -295,6 +299,111 @@ void tst_MasterSlavePathSearch::testContainedConnectionsAreNotExamined()
     QCOMPARE(paths.first().at(2), QSharedPointer<ConnectivityInterface const>(mapInterface1));
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_MasterSlavePathSearch::testIndexedConnectionsGiveSamePaths()
+//-----------------------------------------------------------------------------
+void tst_MasterSlavePathSearch::testIndexedConnectionsGiveSamePaths()
+{
+    QSharedPointer<ConnectivityComponent> spaceComponent1(new ConnectivityComponent("spaceComponent1"));
+    QSharedPointer<ConnectivityComponent> spaceComponent2(new ConnectivityComponent("spaceComponent2"));
+    QSharedPointer<ConnectivityComponent> mapComponent1(new ConnectivityComponent("mapComponent1"));
+
+    QSharedPointer<ConnectivityInterface> spaceInterface1 =
+        createInterfaceWithMemoryItem("spaceInterface1", PathSearchSpace::MASTERMODE, spaceComponent1, false);
+
+    QSharedPointer<ConnectivityInterface> spaceInterface2 =
+        createInterfaceWithMemoryItem("spaceInterface2", PathSearchSpace::MASTERMODE, spaceComponent2, true);
+
+    QSharedPointer<ConnectivityInterface> mapInterface1 =
+        createInterfaceWithMemoryItem("mapInterface1", PathSearchSpace::SLAVEMODE, mapComponent1, false);
+
+    testGraph_->getInstances().append(spaceComponent1);
+    testGraph_->getInstances().append(spaceComponent2);
+    testGraph_->getInstances().append(mapComponent1);
+
+    testGraph_->getInterfaces().append(spaceInterface1);
+    testGraph_->getInterfaces().append(spaceInterface2);
+    testGraph_->getInterfaces().append(mapInterface1);
+
+    QSharedPointer<ConnectivityConnection> spaceChain(
+        new ConnectivityConnection("spaceChain", spaceInterface1, spaceInterface2));
+    QSharedPointer<ConnectivityConnection> spaceToMap(
+        new ConnectivityConnection("spaceToMap", spaceInterface2, mapInterface1));
+
+    testGraph_->getConnections().append(spaceChain);
+    testGraph_->getConnections().append(spaceToMap);
+    addLocalConnection(spaceInterface1);
+
+    QVector<QVector<QSharedPointer<ConnectivityInterface const> > > linearPaths =
+        pathSearcher_.findMasterSlavePaths(testGraph_, true);
+
+    testGraph_->buildConnectionIndex();
+
+    QCOMPARE(testGraph_->getConnectionsFor(spaceInterface1).size(), 2);
+    QCOMPARE(testGraph_->getConnectionsFor(spaceInterface2).size(), 2);
+    QCOMPARE(testGraph_->getConnectionsFor(mapInterface1).size(), 1);
+
+    QVector<QVector<QSharedPointer<ConnectivityInterface const> > > indexedPaths =
+        pathSearcher_.findMasterSlavePaths(testGraph_, true);
+
+    QVERIFY(linearPaths.isEmpty() == false);
+    QCOMPARE(indexedPaths, linearPaths);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_MasterSlavePathSearch::testParallelSearchGivesSamePaths()
+//-----------------------------------------------------------------------------
+void tst_MasterSlavePathSearch::testParallelSearchGivesSamePaths()
+{
+    QSharedPointer<ConnectivityComponent> spaceComponent1(new ConnectivityComponent("spaceComponent1"));
+    QSharedPointer<ConnectivityComponent> spaceComponent2(new ConnectivityComponent("spaceComponent2"));
+    QSharedPointer<ConnectivityComponent> mapComponent1(new ConnectivityComponent("mapComponent1"));
+    QSharedPointer<ConnectivityComponent> mapComponent2(new ConnectivityComponent("mapComponent2"));
+
+    QSharedPointer<ConnectivityInterface> spaceInterface1 =
+        createInterfaceWithMemoryItem("spaceInterface1", PathSearchSpace::MASTERMODE, spaceComponent1, false);
+
+    QSharedPointer<ConnectivityInterface> spaceInterface2 =
+        createInterfaceWithMemoryItem("spaceInterface2", PathSearchSpace::MASTERMODE, spaceComponent2, true);
+
+    QSharedPointer<ConnectivityInterface> mapInterface1 =
+        createInterfaceWithMemoryItem("mapInterface1", PathSearchSpace::SLAVEMODE, mapComponent1, false);
+
+    QSharedPointer<ConnectivityInterface> mapInterface2 =
+        createInterfaceWithMemoryItem("mapInterface2", PathSearchSpace::SLAVEMODE, mapComponent2, false);
+
+    testGraph_->getInstances().append(spaceComponent1);
+    testGraph_->getInstances().append(spaceComponent2);
+    testGraph_->getInstances().append(mapComponent1);
+    testGraph_->getInstances().append(mapComponent2);
+
+    testGraph_->getInterfaces().append(spaceInterface1);
+    testGraph_->getInterfaces().append(spaceInterface2);
+    testGraph_->getInterfaces().append(mapInterface1);
+    testGraph_->getInterfaces().append(mapInterface2);
+
+    testGraph_->getConnections().append(QSharedPointer<ConnectivityConnection>(
+        new ConnectivityConnection("spaceChain", spaceInterface1, spaceInterface2)));
+    testGraph_->getConnections().append(QSharedPointer<ConnectivityConnection>(
+        new ConnectivityConnection("spaceToMap", spaceInterface1, mapInterface1)));
+    testGraph_->getConnections().append(QSharedPointer<ConnectivityConnection>(
+        new ConnectivityConnection("hierarchicalToMap", spaceInterface2, mapInterface2)));
+    testGraph_->buildConnectionIndex();
+
+    for (bool allowOverlappingPaths : { false, true })
+    {
+        QVector<QVector<QSharedPointer<ConnectivityInterface const> > > sequentialPaths =
+            pathSearcher_.findMasterSlavePaths(testGraph_, allowOverlappingPaths);
+
+        QVector<QVector<QSharedPointer<ConnectivityInterface const> > > parallelPaths =
+            pathSearcher_.findMasterSlavePaths(testGraph_, allowOverlappingPaths,
+            MasterSlavePathSearch::SearchMode::Parallel);
+
+        QVERIFY(sequentialPaths.isEmpty() == false);
+        QCOMPARE(parallelPaths, sequentialPaths);
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_MasterSlavePathSearch::createInterfaceWithMemoryItem()
 //-----------------------------------------------------------------------------
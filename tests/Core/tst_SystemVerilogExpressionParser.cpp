@@ -12,6 +12,7 @@
 #include <QTest>
 #include <QtMath>
 
+#include <KactusAPI/include/SystemVerilogExpressionLexer.h>
 #include <KactusAPI/include/SystemVerilogExpressionParser.h>
 
 class tst_SystemVerilogExpressionParser : public QObject
@@ -73,6 +74,16 @@ private slots:
 
     void testParserPerformance();
     void testParserPerformance_data();
+
+    void testTokenizerMatchesRegularExpressions();
+    void testTokenizerMatchesRegularExpressions_data();
+
+    void testTokenizerPerformance();
+    void testTokenizerPerformance_data();
+
+private:
+
+    static QStringList expressionCorpus();
 };
 
 //-----------------------------------------------------------------------------
@@ -173,6 +184,8 @@ void tst_SystemVerilogExpressionParser::testParseConstant_data()
         << "1_000_000" << "1000000" << true;
     QTest::newRow("Decimal number with base and underscores should evaluate") << "'sd10_000" << "10000" << true;
     QTest::newRow("Decimal number 1000005 evaluates to 1000005") << "1000005" << "1000005" << true;
+    QTest::newRow("Largest unsigned 64-bit decimal number") 
+        << "18446744073709551615" << "18446744073709551615" << true;
 
     //! Fixed-point numbers.
     QTest::newRow("Fixed-point number 0.0 should evaluate to 0.0") << "0.0" << "0.0" << true;
@@ -201,6 +214,12 @@ void tst_SystemVerilogExpressionParser::testParseConstant_data()
     QTest::newRow("Hexadecimal number with multiple underscores should evaluate to decimal without underscores") 
         << "'h0_F_F" << "255" << true;
 
+    QTest::newRow("Hexadecimal number with 16 digits is exact") 
+        << "64'h7FFF_FFFF_FFFF_FFFF" << "9223372036854775807" << true;
+    QTest::newRow("Hexadecimal number 2^63 is unsigned") << "'h8000_0000_0000_0000" << "9223372036854775808" << true;
+    QTest::newRow("Hexadecimal number with all 64 bits set is unsigned") 
+        << "'hFFFF_FFFF_FFFF_FFFF" << "18446744073709551615" << true;
+
     //! Binary numbers.
     QTest::newRow("Binary number 'b1 should evaluate to 1") << "'b1" << "1" << true;
     QTest::newRow("Binary number 'b10 should evaluate to 2") << "'b10" << "2" << true;
@@ -218,6 +237,8 @@ void tst_SystemVerilogExpressionParser::testParseConstant_data()
         << "'b1_1" << "3" << true;
     QTest::newRow("Binary number with multiple underscores should evaluate to decimal without underscores") 
         << "'b1_1_1_1" << "15" << true;
+    QTest::newRow("Binary number with 64 digits is unsigned") 
+        << "'b1000000000000000000000000000000000000000000000000000000000000001" << "9223372036854775809" << true;
 
     //! Octal numbers.
     QTest::newRow("Octal number 'o1 should evaluate to 1") << "'o1" << "1" << true;
@@ -280,6 +301,8 @@ void tst_SystemVerilogExpressionParser::testParseAddition_data()
     QTest::newRow("Large decimal sum 1000003+1") << "1000003+1" << "1000004" << true;
     QTest::newRow("Larger decimal sum 1000004+1") << "1000004+1" << "1000005" << true;
     QTest::newRow("Sum of large decimal values 1000003+1000003") << "1000003+1000003" << "2000006" << true;
+    QTest::newRow("Sum over the signed 64-bit range is unsigned") 
+        << "'h7FFF_FFFF_FFFF_FFFF + 1" << "9223372036854775808" << true;
 
     //! Fixed-point numbers.
     QTest::newRow("One plus one equals exactly two") << "1.0+1.0" << "2.0" << true;
@@ -368,6 +391,11 @@ void tst_SystemVerilogExpressionParser::testParseSubtraction_data()
 
     QTest::newRow("Subtraction of multiple values of same base") << "'h12 - 'h8 - 'h01" << "9" << true;
     QTest::newRow("Subtraction of multiple values of different bases") << "'h20 - 'b1010 - 'o12 - 2" << "10" << true;
+    QTest::newRow("Subtraction of 64-bit values is exact") << "'h100000000000003 - 'h1" << "72057594037927938" << true;
+    QTest::newRow("Subtraction of unsigned values") 
+        << "'hFFFF_FFFF_FFFF_FFFF - 'hFFFF_FFFF_FFFF_FFFE" << "1" << true;
+    QTest::newRow("Subtraction of unsigned values with a negative result") 
+        << "'h8000_0000_0000_0000 - 'h8000_0000_0000_0001" << "-1" << true;
 }
 
 //-----------------------------------------------------------------------------
@@ -430,6 +458,9 @@ void tst_SystemVerilogExpressionParser::testParseMultiply_data()
 
     QTest::newRow("Multiply of multiple values of same base") << "'h2 * 'h8 * 'h01" << "16" << true;
     QTest::newRow("Multiply of multiple values of different bases") << "'h04 * 'b0100 * 'o2 * 2" << "64" << true;
+    QTest::newRow("Multiply of 64-bit values is exact") << "'h100000000000001 * 3" << "216172782113783811" << true;
+    QTest::newRow("Multiply over the signed 64-bit range is unsigned") 
+        << "'h8000_0000 * 'h1_0000_0001" << "9223372039002259456" << true;
 }
 
 //-----------------------------------------------------------------------------
@@ -553,6 +584,8 @@ void tst_SystemVerilogExpressionParser::testParsePower_data()
 
     QTest::newRow("Multiple power operations") << "2**2**2" << "16" << true;
     QTest::newRow("Power of multiple different bases") << "'h02 ** 'b0010 ** 'o2 ** 2" << "256" << true;
+    QTest::newRow("Power with a 64-bit result is exact") << "2**62 + 1" << "4611686018427387905" << true;
+    QTest::newRow("Power with an unsigned 64-bit result is exact") << "2**63 + 1" << "9223372036854775809" << true;
 
     //! Fixed-point numbers.
     QTest::newRow("Real gives real reciprocal") << "2.0 ** -1" << "0.5" << true;
@@ -828,6 +861,8 @@ void tst_SystemVerilogExpressionParser::testParseComparison_data()
     QTest::newRow("Single value: 2 is lesser than 10 returns 1") << "2 < 10" << 1;
 
     QTest::newRow("5 is greater than 5 returns 0") << "5>5" << 0;
+    QTest::newRow("Unsigned 64-bit values are compared exactly") 
+        << "'hFFFF_FFFF_FFFF_FFFF > 'hFFFF_FFFF_FFFF_FFFE" << 1;
     QTest::newRow("5 is lesser than 5 returns 0") << "5<5" << 0;
 
     QTest::newRow("Expression: 14*2 is greater than 2-3*2+8 returns 1") << "14*2 > 2-3*2+8" << 1;
@@ -916,6 +951,11 @@ void tst_SystemVerilogExpressionParser::testBitwiseOperations_data()
     QTest::newRow("Negation") << "~4'b001" << "-2" << true;
     QTest::newRow("Shift left") << "4'b0010 << 2" << "8" << true;
     QTest::newRow("Shift right") << "4'b1000 >> 3" << "1" << true;
+    QTest::newRow("Shift left to the highest bit is unsigned") << "1 << 63" << "9223372036854775808" << true;
+    QTest::newRow("Shift right of an unsigned value") << "'hFFFF_FFFF_FFFF_FFFF >> 60" << "15" << true;
+    QTest::newRow("Bitwise and of unsigned values") 
+        << "'hFFFF_FFFF_FFFF_FFFF & 'h8000_0000_0000_00FF" << "9223372036854776063" << true;
+    QTest::newRow("Negation of an unsigned value") << "~'hFFFF_FFFF_FFFF_FFF0" << "15" << true;
 }
 
 //-----------------------------------------------------------------------------
@@ -990,6 +1030,102 @@ void tst_SystemVerilogExpressionParser::testParserPerformance_data()
 
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_SystemVerilogExpressionParser::testTokenizerMatchesRegularExpressions()
+//-----------------------------------------------------------------------------
+void tst_SystemVerilogExpressionParser::testTokenizerMatchesRegularExpressions()
+{
+    QFETCH(QString, expression);
+
+    QCOMPARE(SystemVerilogExpressionLexer::tokenize(expression),
+        SystemVerilogExpressionLexer::tokenizeWithRegularExpressions(expression));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_SystemVerilogExpressionParser::testTokenizerMatchesRegularExpressions_data()
+//-----------------------------------------------------------------------------
+void tst_SystemVerilogExpressionParser::testTokenizerMatchesRegularExpressions_data()
+{
+    QTest::addColumn<QString>("expression");
+
+    for (QString const& expression : expressionCorpus())
+    {
+        QTest::newRow(qPrintable(expression)) << expression;
+    }
+
+    QTest::newRow("Too many decimal digits") << "123456789012345678901 + 1";
+    QTest::newRow("Separators are not counted as digits") << "'hFFFF_FFFF_FFFF_FFFF_F + 'b1_0_1 + 1_000";
+    QTest::newRow("Base without digits") << "8'h + 8'b2 + 'sd";
+    QTest::newRow("Operators without spaces") << "a<<b>=c!==d===e&&f|*g";
+    QTest::newRow("Unknown function") << "$power(2, 4) + $clog2x";
+    QTest::newRow("Unterminated string") << "\"text + 1";
+    QTest::newRow("Symbol starting with a boolean") << "trueValue + FALSE_value";
+    QTest::newRow("Non-ASCII characters") << QStringLiteral("fal\u017Fe + \u00E4\u00E4kk\u00F6set");
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_SystemVerilogExpressionParser::testTokenizerPerformance()
+//-----------------------------------------------------------------------------
+void tst_SystemVerilogExpressionParser::testTokenizerPerformance()
+{
+    QFETCH(QString, expression);
+    QFETCH(bool, useRegularExpressions);
+
+    QVector<SystemVerilogExpressionLexer::Token> tokens;
+
+    if (useRegularExpressions)
+    {
+        QBENCHMARK
+        {
+            tokens = SystemVerilogExpressionLexer::tokenizeWithRegularExpressions(expression);
+        }
+    }
+    else
+    {
+        QBENCHMARK
+        {
+            tokens = SystemVerilogExpressionLexer::tokenize(expression);
+        }
+    }
+
+    QVERIFY(tokens.isEmpty() == false);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_SystemVerilogExpressionParser::testTokenizerPerformance_data()
+//-----------------------------------------------------------------------------
+void tst_SystemVerilogExpressionParser::testTokenizerPerformance_data()
+{
+    QTest::addColumn<QString>("expression");
+    QTest::addColumn<bool>("useRegularExpressions");
+
+    for (QString const& expression : expressionCorpus())
+    {
+        QTest::newRow(qPrintable(QStringLiteral("table: ") + expression)) << expression << false;
+        QTest::newRow(qPrintable(QStringLiteral("regex: ") + expression)) << expression << true;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_SystemVerilogExpressionParser::expressionCorpus()
+//-----------------------------------------------------------------------------
+QStringList tst_SystemVerilogExpressionParser::expressionCorpus()
+{
+    // Expressions as they appear in IP-XACT documents, with parameters referenced by their ids.
+    return {
+        QStringLiteral("uuid_5c4ea0c2_8a5e_4b6f_9d0b_3f2c8e7a1b64"),
+        QStringLiteral("uuid_5c4ea0c2_8a5e_4b6f_9d0b_3f2c8e7a1b64/8 - 1"),
+        QStringLiteral("$clog2(uuid_0d4b3e9f_6c1a_4f2e_8b7d_5a9c3e1f2d60) + 'h1000 * 4"),
+        QStringLiteral("uuid_7e2a9c14_3b5d_4e6f_a1c8_9d0e2f4b6a83 == 1 ? 32'hDEAD_BEEF : 32'h0"),
+        QStringLiteral("{8'h00, 8'hFF, 4'b1010, 16'd65535}"),
+        QStringLiteral("-4'sd3 + 8'So17 - 'sb1"),
+        QStringLiteral("1.5 * -2_0.2_5 + 3"),
+        QStringLiteral("2**4 + ($pow(2, 3) & ~'b0110 | 'hF ^ 1)"),
+        QStringLiteral("$ipxact_mode_condition(mode_1) && $ipxact_port_value(clk) != 0"),
+        QStringLiteral("$ipxact_field_value(uuid_a.b.c) >> 2 << 1"),
+        QStringLiteral("\"mode\" == \"mode\"") };
+}
+
 QTEST_APPLESS_MAIN(tst_SystemVerilogExpressionParser)
 
 #include "tst_SystemVerilogExpressionParser.moc"
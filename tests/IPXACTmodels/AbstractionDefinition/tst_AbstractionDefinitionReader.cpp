@@ -22,6 +22,7 @@
 
 #include <IPXACTmodels/AbstractionDefinition/AbstractionDefinition.h>
 #include <IPXACTmodels/AbstractionDefinition/AbstractionDefinitionReader.h>
+#include <IPXACTmodels/AbstractionDefinition/AbstractionDefinitionWriter.h>
 #include <IPXACTmodels/AbstractionDefinition/PortAbstraction.h>
 #include <IPXACTmodels/AbstractionDefinition/TransactionalAbstraction.h>
 #include <IPXACTmodels/AbstractionDefinition/TransactionalPort.h>
@@ -67,6 +68,11 @@ private slots:
     void testReadAssertions();
     void testReadVendorExtension();
 
+    void testStreamingReadMatchesDomRead();
+
+private:
+
+    QString writtenDefinition(QSharedPointer<AbstractionDefinition> definition) const;
 };
 
 //-----------------------------------------------------------------------------
@@ -1002,6 +1008,77 @@ void tst_AbstractionDefinitionReader::testReadVendorExtension()
     QCOMPARE(TestDefinition->getVersion(), QString("3.0.0"));
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_AbstractionDefinitionReader::testStreamingReadMatchesDomRead()
+//-----------------------------------------------------------------------------
+void tst_AbstractionDefinitionReader::testStreamingReadMatchesDomRead()
+{
+    QString documentContent(
+        "<?xml version=\"1.0\"?>"
+        "<!--Header comment-->"
+        "<ipxact:abstractionDefinition xmlns:xsi=\"http://www.w3.org/2001/XMLSchema-instance\" " 
+        "xmlns:ipxact=\"http://www.accellera.org/XMLSchema/IPXACT/1685-2014\" "
+        "xmlns:kactus2=\"http://kactus2.cs.tut.fi\" "
+        "xsi:schemaLocation=\"http://www.accellera.org/XMLSchema/IPXACT/1685-2014/ "
+        "http://www.accellera.org/XMLSchema/IPXACT/1685-2014/index.xsd\">"
+            "<ipxact:vendor>TUT</ipxact:vendor>"
+            "<ipxact:library>TestLibrary</ipxact:library>"
+            "<ipxact:name>MinimalDefinition</ipxact:name>"
+            "<ipxact:version>1.0</ipxact:version>"
+            "<ipxact:busType vendor=\"TUT\" library=\"TestLibrary\" name=\"TargetBus\" version=\"1.0\"/>"
+            "<ipxact:ports>"
+                "<ipxact:port>"
+                    "<ipxact:logicalName>wirePort</ipxact:logicalName>"
+                    "<ipxact:wire>"
+                        "<ipxact:onMaster>"
+                            "<ipxact:presence>required</ipxact:presence>"
+                            "<ipxact:width>8</ipxact:width>"
+                            "<ipxact:direction>out</ipxact:direction>"
+                        "</ipxact:onMaster>"
+                    "</ipxact:wire>"
+                "</ipxact:port>"
+                "<ipxact:port>"
+                    "<ipxact:logicalName>transactionalPort</ipxact:logicalName>"
+                    "<ipxact:transactional>"
+                        "<ipxact:onMaster>"
+                            "<ipxact:initiative>requires</ipxact:initiative>"
+                        "</ipxact:onMaster>"
+                    "</ipxact:transactional>"
+                "</ipxact:port>"
+            "</ipxact:ports>"
+            "<ipxact:vendorExtensions>"
+                "<testExtension vendorAttribute=\"extension\">testValue</testExtension>"
+            "</ipxact:vendorExtensions>"
+        "</ipxact:abstractionDefinition>");
+
+    QDomDocument document;
+    document.setContent(documentContent);
+
+    QSharedPointer<AbstractionDefinition> domDefinition =
+        AbstractionDefinitionReader::createAbstractionDefinitionFrom(document);
+
+    QXmlStreamReader xmlReader(documentContent);
+    QSharedPointer<AbstractionDefinition> streamedDefinition =
+        AbstractionDefinitionReader::createAbstractionDefinitionFrom(xmlReader);
+
+    QVERIFY(streamedDefinition.isNull() == false);
+    QCOMPARE(streamedDefinition->getLogicalPorts()->size(), 2);
+
+    QCOMPARE(writtenDefinition(streamedDefinition), writtenDefinition(domDefinition));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_AbstractionDefinitionReader::writtenDefinition()
+//-----------------------------------------------------------------------------
+QString tst_AbstractionDefinitionReader::writtenDefinition(QSharedPointer<AbstractionDefinition> definition) const
+{
+    QString output;
+    QXmlStreamWriter xmlWriter(&output);
+    AbstractionDefinitionWriter::writeAbstractionDefinition(xmlWriter, definition);
+
+    return output;
+}
+
 
 QTEST_APPLESS_MAIN(tst_AbstractionDefinitionReader)
 
@@ -12,6 +12,7 @@
 #include <IPXACTmodels/common/TagData.h>
 
 #include <IPXACTmodels/Component/ComponentReader.h>
+#include <IPXACTmodels/Component/ComponentWriter.h>
 
 #include <IPXACTmodels/Component/AddressSpace.h>
 #include <IPXACTmodels/Component/BusInterface.h>
@@ -93,6 +94,12 @@ private slots:
     void readAuthorAndLicense();
 
     void readTags();
+
+    void streamingReadMatchesDomRead();
+
+private:
+
+    QString writtenComponent(QSharedPointer<Component> component) const;
 };
 
 //-----------------------------------------------------------------------------
@@ -1562,6 +1569,96 @@ void tst_ComponentReader::readTags()
     QCOMPARE(testComponent->getTags().first().color_, QLatin1String("#79D173"));
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentReader::streamingReadMatchesDomRead()
+//-----------------------------------------------------------------------------
+void tst_ComponentReader::streamingReadMatchesDomRead()
+{
+    QString documentContent(
+        "<?xml version=\"1.0\"?>"
+        "<!--Header comment-->"
+        "<ipxact:component "
+        "xmlns:xsi=\"http://www.w3.org/2001/XMLSchema-instance\" " 
+        "xmlns:ipxact=\"http://www.accellera.org/XMLSchema/IPXACT/1685-2014\" "
+        "xmlns:kactus2=\"http://kactus2.cs.tut.fi\" "
+        "xsi:schemaLocation=\"http://www.accellera.org/XMLSchema/IPXACT/1685-2014/ "
+        "http://www.accellera.org/XMLSchema/IPXACT/1685-2014/index.xsd\">"
+            "<ipxact:vendor>tuni.fi</ipxact:vendor>"
+            "<ipxact:library>TestLibrary</ipxact:library>"
+            "<ipxact:name>TestComponent</ipxact:name>"
+            "<ipxact:version>0.11</ipxact:version>"
+            "<ipxact:memoryMaps>"
+                "<ipxact:memoryMap>"
+                    "<ipxact:name>firstMap</ipxact:name>"
+                    "<ipxact:addressBlock>"
+                        "<ipxact:name>testBlock</ipxact:name>"
+                        "<ipxact:baseAddress>'h100</ipxact:baseAddress>"
+                        "<ipxact:range>16</ipxact:range>"
+                        "<ipxact:width>32</ipxact:width>"
+                    "</ipxact:addressBlock>"
+                "</ipxact:memoryMap>"
+                "<ipxact:memoryMap>"
+                    "<ipxact:name>secondMap</ipxact:name>"
+                "</ipxact:memoryMap>"
+            "</ipxact:memoryMaps>"
+            "<ipxact:model>"
+                "<ipxact:views>"
+                    "<ipxact:view>"
+                        "<ipxact:name>testView</ipxact:name>"
+                    "</ipxact:view>"
+                "</ipxact:views>"
+                "<ipxact:ports>"
+                    "<ipxact:port>"
+                        "<ipxact:name>inPort</ipxact:name>"
+                        "<ipxact:wire>"
+                            "<ipxact:direction>in</ipxact:direction>"
+                        "</ipxact:wire>"
+                    "</ipxact:port>"
+                    "<ipxact:port>"
+                        "<ipxact:name>outPort</ipxact:name>"
+                        "<ipxact:wire>"
+                            "<ipxact:direction>out</ipxact:direction>"
+                        "</ipxact:wire>"
+                    "</ipxact:port>"
+                "</ipxact:ports>"
+            "</ipxact:model>"
+            "<ipxact:vendorExtensions>"
+                "<kactus2:version>3.0.0</kactus2:version>"
+            "</ipxact:vendorExtensions>"
+        "</ipxact:component>"
+        );
+
+    QDomDocument document;
+    document.setContent(documentContent);
+
+    ComponentReader componentReader;
+    QSharedPointer<Component> domComponent = componentReader.createComponentFrom(document);
+
+    QXmlStreamReader xmlReader(documentContent);
+    QSharedPointer<Component> streamedComponent = componentReader.createComponentFrom(xmlReader);
+
+    QVERIFY(streamedComponent.isNull() == false);
+    QCOMPARE(streamedComponent->getMemoryMaps()->size(), 2);
+    QCOMPARE(streamedComponent->getPorts()->size(), 2);
+    QCOMPARE(streamedComponent->getViews()->size(), 1);
+
+    QCOMPARE(writtenComponent(streamedComponent), writtenComponent(domComponent));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentReader::writtenComponent()
+//-----------------------------------------------------------------------------
+QString tst_ComponentReader::writtenComponent(QSharedPointer<Component> component) const
+{
+    QString output;
+    QXmlStreamWriter xmlWriter(&output);
+
+    ComponentWriter componentWriter;
+    componentWriter.writeComponent(xmlWriter, component);
+
+    return output;
+}
+
 
 QTEST_APPLESS_MAIN(tst_ComponentReader)
 
@@ -10,6 +10,7 @@
 //-----------------------------------------------------------------------------
 
 #include <IPXACTmodels/Design/DesignReader.h>
+#include <IPXACTmodels/Design/DesignWriter.h>
 
 #include <IPXACTmodels/kactusExtensions/Kactus2Placeholder.h>
 
@@ -58,6 +59,12 @@ private slots:
     void testReadHierApiConnections();
     void testReadComConnections();
     void testReadHierComConnections();
+
+    void testStreamingReadMatchesDomRead();
+
+private:
+
+    QString writtenDesign(QSharedPointer<Design> design) const;
 };
 
 //-----------------------------------------------------------------------------
@@ -1667,6 +1674,109 @@ void tst_DesignReader::testReadHierComConnections()
     QCOMPARE(testDesign->getRevision(), Document::Revision::Std14);
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_DesignReader::testStreamingReadMatchesDomRead()
+//-----------------------------------------------------------------------------
+void tst_DesignReader::testStreamingReadMatchesDomRead()
+{
+    QString documentContent(
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+        "<!--Header comment-->"
+        "<ipxact:design xmlns:xsi=\"http://www.w3.org/2001/XMLSchema-instance\" "
+        "xmlns:ipxact=\"http://www.accellera.org/XMLSchema/IPXACT/1685-2014\" "
+        "xmlns:kactus2=\"http://kactus2.cs.tut.fi\" "
+        "xsi:schemaLocation=\"http://www.accellera.org/XMLSchema/IPXACT/1685-2014/ "
+        "http://www.accellera.org/XMLSchema/IPXACT/1685-2014/index.xsd\">"
+            "<ipxact:vendor>tuni.fi</ipxact:vendor>"
+            "<ipxact:library>TestLibrary</ipxact:library>"
+            "<ipxact:name>TestDesign</ipxact:name>"
+            "<ipxact:version>0.1</ipxact:version>"
+            "<ipxact:componentInstances>"
+                "<ipxact:componentInstance>"
+                    "<ipxact:instanceName>firstInstance</ipxact:instanceName>"
+                    "<ipxact:componentRef vendor=\"tuni.fi\" library=\"TestLibrary\" name=\"testComponent\""
+                        " version=\"1.0\">"
+                        "<ipxact:configurableElementValues>"
+                            "<ipxact:configurableElementValue referenceId=\"testReferenceID\">10"
+                                "</ipxact:configurableElementValue>"
+                        "</ipxact:configurableElementValues>"
+                    "</ipxact:componentRef>"
+                    "<ipxact:vendorExtensions>"
+                        "<kactus2:uuid>testUUID</kactus2:uuid>"
+                    "</ipxact:vendorExtensions>"
+                "</ipxact:componentInstance>"
+                "<ipxact:componentInstance>"
+                    "<ipxact:instanceName>secondInstance</ipxact:instanceName>"
+                    "<ipxact:componentRef vendor=\"tuni.fi\" library=\"TestLibrary\" name=\"otherComponent\""
+                        " version=\"1.0\"/>"
+                "</ipxact:componentInstance>"
+            "</ipxact:componentInstances>"
+            "<ipxact:interconnections>"
+                "<ipxact:interconnection>"
+                    "<ipxact:name>testConnection</ipxact:name>"
+                    "<ipxact:activeInterface componentRef=\"firstInstance\" busRef=\"startBus\"/>"
+                    "<ipxact:activeInterface componentRef=\"secondInstance\" busRef=\"otherBus\"/>"
+                "</ipxact:interconnection>"
+                "<ipxact:monitorInterconnection>"
+                    "<ipxact:name>monitorInterconnection</ipxact:name>"
+                    "<ipxact:monitoredActiveInterface componentRef=\"firstInstance\" busRef=\"startBus\"/>"
+                    "<ipxact:monitorInterface componentRef=\"secondInstance\" busRef=\"monitorBus\"/>"
+                "</ipxact:monitorInterconnection>"
+            "</ipxact:interconnections>"
+            "<ipxact:adHocConnections>"
+                "<ipxact:adHocConnection>"
+                    "<ipxact:name>adHoc</ipxact:name>"
+                    "<ipxact:portReferences>"
+                        "<ipxact:internalPortReference componentRef=\"firstInstance\" portRef=\"internalPort\"/>"
+                        "<ipxact:externalPortReference portRef=\"externalPort\"/>"
+                    "</ipxact:portReferences>"
+                "</ipxact:adHocConnection>"
+            "</ipxact:adHocConnections>"
+            "<ipxact:vendorExtensions>"
+                "<kactus2:version>3.0.0</kactus2:version>"
+                "<kactus2:swInstances>"
+                    "<kactus2:swInstance>"
+                        "<kactus2:instanceName>swInstance</kactus2:instanceName>"
+                        "<kactus2:componentRef vendor=\"tuni.fi\" library=\"TestLibrary\" name=\"swComponent\""
+                            " version=\"1.0\"/>"
+                        "<kactus2:mapping hwRef=\"firstInstance\"/>"
+                    "</kactus2:swInstance>"
+                "</kactus2:swInstances>"
+            "</ipxact:vendorExtensions>"
+        "</ipxact:design>\n");
+
+    QDomDocument document;
+    document.setContent(documentContent);
+
+    QSharedPointer<Design> domDesign = DesignReader::createDesignFrom(document);
+
+    QXmlStreamReader xmlReader(documentContent);
+    QSharedPointer<Design> streamedDesign = DesignReader::createDesignFrom(xmlReader);
+
+    QVERIFY(streamedDesign.isNull() == false);
+    QCOMPARE(streamedDesign->getComponentInstances()->size(), 3);
+    QCOMPARE(streamedDesign->getComponentInstances()->first()->getInstanceName(), QString("firstInstance"));
+    QCOMPARE(streamedDesign->getComponentInstances()->last()->getInstanceName(), QString("swInstance"));
+    QCOMPARE(streamedDesign->getInterconnections()->size(), 1);
+    QCOMPARE(streamedDesign->getMonitorInterconnecions()->size(), 1);
+    QCOMPARE(streamedDesign->getAdHocConnections()->size(), 1);
+    QCOMPARE(streamedDesign->getRevision(), domDesign->getRevision());
+
+    QCOMPARE(writtenDesign(streamedDesign), writtenDesign(domDesign));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DesignReader::writtenDesign()
+//-----------------------------------------------------------------------------
+QString tst_DesignReader::writtenDesign(QSharedPointer<Design> design) const
+{
+    QString output;
+    QXmlStreamWriter xmlWriter(&output);
+    DesignWriter::writeDesign(xmlWriter, design);
+
+    return output;
+}
+
 QTEST_APPLESS_MAIN(tst_DesignReader)
 
 #include "tst_DesignReader.moc"
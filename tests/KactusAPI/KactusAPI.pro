@@ -13,4 +13,8 @@ TEMPLATE = subdirs
 
 CONFIG += testcase
 SUBDIRS += \
-            tst_ModeConditionParser.pro 
+            tst_ModeConditionParser.pro \
+            tst_MemoryMapIndex.pro \
+            tst_NameIndex.pro \
+            tst_PortsInterface.pro \
+            tst_RegisterInterface.pro
@@ -0,0 +1,343 @@
+//-----------------------------------------------------------------------------
+// File: tst_MemoryMapIndex.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 17.10.2026
+//
+// Description:
+// Unit test for class MemoryMapIndex.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+#include <QSharedPointer>
+#include <QRandomGenerator>
+
+#include <KactusAPI/include/MemoryMapIndex.h>
+#include <KactusAPI/include/SystemVerilogExpressionParser.h>
+
+#include <IPXACTmodels/Component/AddressBlock.h>
+#include <IPXACTmodels/Component/Component.h>
+#include <IPXACTmodels/Component/Field.h>
+#include <IPXACTmodels/Component/MemoryArray.h>
+#include <IPXACTmodels/Component/MemoryMap.h>
+#include <IPXACTmodels/Component/MemoryRemap.h>
+#include <IPXACTmodels/Component/Register.h>
+#include <IPXACTmodels/Component/RegisterFile.h>
+
+class tst_MemoryMapIndex : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_MemoryMapIndex();
+
+private slots:
+
+    void testFindRegistersAndFields();
+    void testArraysAndRegisterFiles();
+    void testRemapState();
+    void testElementLimit();
+    void testFindMatchesLinearSearch();
+
+private:
+
+    QSharedPointer<Component> createComponent() const;
+
+    QSharedPointer<Register> createRegister(QString const& name, QString const& offset, QString const& size)
+        const;
+
+    QStringList entryNames(QVector<MemoryMapIndex::Entry> const& entries) const;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_MemoryMapIndex::tst_MemoryMapIndex()
+//-----------------------------------------------------------------------------
+tst_MemoryMapIndex::tst_MemoryMapIndex()
+{
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_MemoryMapIndex::testFindRegistersAndFields()
+//-----------------------------------------------------------------------------
+void tst_MemoryMapIndex::testFindRegistersAndFields()
+{
+    QSharedPointer<Component> testComponent = createComponent();
+    QSharedPointer<MemoryMap> testMap = testComponent->getMemoryMaps()->first();
+
+    QSharedPointer<AddressBlock> testBlock(new AddressBlock(QStringLiteral("block"), QStringLiteral("'h100")));
+    testMap->getMemoryBlocks()->append(testBlock);
+
+    QSharedPointer<Register> control = createRegister(QStringLiteral("control"), QStringLiteral("0"),
+        QStringLiteral("32"));
+
+    QSharedPointer<Field> enable(new Field(QStringLiteral("enable")));
+    enable->setBitOffset(QStringLiteral("0"));
+    enable->setBitWidth(QStringLiteral("1"));
+    control->getFields()->append(enable);
+
+    QSharedPointer<Field> mode(new Field(QStringLiteral("mode")));
+    mode->setBitOffset(QStringLiteral("8"));
+    mode->setBitWidth(QStringLiteral("16"));
+    control->getFields()->append(mode);
+
+    QSharedPointer<Field> hidden(new Field(QStringLiteral("hidden")));
+    hidden->setBitOffset(QStringLiteral("24"));
+    hidden->setBitWidth(QStringLiteral("8"));
+    hidden->setIsPresent(QStringLiteral("0"));
+    control->getFields()->append(hidden);
+
+    testBlock->getRegisterData()->append(control);
+    testBlock->getRegisterData()->append(createRegister(QStringLiteral("status"), QStringLiteral("4"),
+        QStringLiteral("8")));
+
+    MemoryMapIndex index(QSharedPointer<ExpressionParser>(new SystemVerilogExpressionParser()));
+    index.build(testComponent);
+
+    QCOMPARE(index.size(), 4);
+
+    QCOMPARE(entryNames(index.findAt(0x100)), QStringList({ "control", "control.enable" }));
+    QCOMPARE(entryNames(index.findAt(0x101)), QStringList({ "control", "control.mode" }));
+    QCOMPARE(entryNames(index.findAt(0x103)), QStringList({ "control" }));
+    QCOMPARE(entryNames(index.findAt(0x104)), QStringList({ "status" }));
+    QVERIFY(index.findAt(0x105).isEmpty());
+    QVERIFY(index.findAt(0xFF).isEmpty());
+
+    MemoryMapIndex::Entry modeEntry = index.findAt(0x102).last();
+    QCOMPARE(modeEntry.memoryMapName, QString("map"));
+    QCOMPARE(modeEntry.addressBlockName, QString("block"));
+    QCOMPARE(modeEntry.firstAddress, quint64(0x101));
+    QCOMPARE(modeEntry.lastAddress, quint64(0x102));
+    QCOMPARE(modeEntry.bitOffset, quint64(8));
+    QCOMPARE(modeEntry.bitWidth, quint64(16));
+
+    QCOMPARE(entryNames(index.findInRange(0x103, 0x200)), QStringList({ "control", "status" }));
+    QVERIFY(index.findAt(0x100, QStringLiteral("other")).isEmpty());
+
+    index.clear();
+    QCOMPARE(index.size(), 0);
+    QVERIFY(index.findAt(0x100).isEmpty());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_MemoryMapIndex::testArraysAndRegisterFiles()
+//-----------------------------------------------------------------------------
+void tst_MemoryMapIndex::testArraysAndRegisterFiles()
+{
+    QSharedPointer<Component> testComponent = createComponent();
+    QSharedPointer<MemoryMap> testMap = testComponent->getMemoryMaps()->first();
+
+    QSharedPointer<AddressBlock> testBlock(new AddressBlock(QStringLiteral("block"), QStringLiteral("0")));
+    testMap->getMemoryBlocks()->append(testBlock);
+
+    QSharedPointer<Register> arrayRegister = createRegister(QStringLiteral("data"), QStringLiteral("0"),
+        QStringLiteral("16"));
+
+    QSharedPointer<MemoryArray> registerArray(new MemoryArray());
+    registerArray->getDimensions()->append(QSharedPointer<MemoryArray::Dimension>(
+        new MemoryArray::Dimension({ QStringLiteral("2"), QString() })));
+    registerArray->getDimensions()->append(QSharedPointer<MemoryArray::Dimension>(
+        new MemoryArray::Dimension({ QStringLiteral("3"), QString() })));
+    registerArray->setStride(QStringLiteral("4"));
+    arrayRegister->setMemoryArray(registerArray);
+    testBlock->getRegisterData()->append(arrayRegister);
+
+    QSharedPointer<RegisterFile> registerFile(new RegisterFile(QStringLiteral("channel"), QStringLiteral("'h40"),
+        QStringLiteral("16")));
+
+    QSharedPointer<MemoryArray> fileArray(new MemoryArray());
+    fileArray->getDimensions()->append(QSharedPointer<MemoryArray::Dimension>(
+        new MemoryArray::Dimension({ QStringLiteral("2"), QString() })));
+    registerFile->setMemoryArray(fileArray);
+    registerFile->getRegisterData()->append(createRegister(QStringLiteral("config"), QStringLiteral("8"),
+        QStringLiteral("32")));
+    testBlock->getRegisterData()->append(registerFile);
+
+    MemoryMapIndex index(QSharedPointer<ExpressionParser>(new SystemVerilogExpressionParser()));
+    index.build(testComponent);
+
+    QCOMPARE(index.size(), 8);
+
+    QCOMPARE(entryNames(index.findAt(0)), QStringList({ "data[0][0]" }));
+    QVERIFY(index.findAt(2).isEmpty());
+    QCOMPARE(entryNames(index.findAt(13)), QStringList({ "data[1][0]" }));
+    QCOMPARE(entryNames(index.findAt(20)), QStringList({ "data[1][2]" }));
+
+    QCOMPARE(entryNames(index.findAt(0x4B)), QStringList({ "channel[0].config" }));
+    QCOMPARE(entryNames(index.findAt(0x58)), QStringList({ "channel[1].config" }));
+    QVERIFY(index.findAt(0x50).isEmpty());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_MemoryMapIndex::testRemapState()
+//-----------------------------------------------------------------------------
+void tst_MemoryMapIndex::testRemapState()
+{
+    QSharedPointer<Component> testComponent = createComponent();
+    QSharedPointer<MemoryMap> testMap = testComponent->getMemoryMaps()->first();
+
+    QSharedPointer<AddressBlock> defaultBlock(new AddressBlock(QStringLiteral("default"), QStringLiteral("0")));
+    defaultBlock->getRegisterData()->append(createRegister(QStringLiteral("normal"), QStringLiteral("0"),
+        QStringLiteral("8")));
+    testMap->getMemoryBlocks()->append(defaultBlock);
+
+    QSharedPointer<MemoryRemap> testRemap(new MemoryRemap(QStringLiteral("remap"), QStringLiteral("boot")));
+    QSharedPointer<AddressBlock> remapBlock(new AddressBlock(QStringLiteral("remapped"), QStringLiteral("0")));
+    remapBlock->getRegisterData()->append(createRegister(QStringLiteral("bootRegister"), QStringLiteral("0"),
+        QStringLiteral("8")));
+    testRemap->getMemoryBlocks()->append(remapBlock);
+    testMap->getMemoryRemaps()->append(testRemap);
+
+    MemoryMapIndex index(QSharedPointer<ExpressionParser>(new SystemVerilogExpressionParser()));
+
+    index.build(testComponent);
+    QCOMPARE(entryNames(index.findAt(0)), QStringList({ "normal" }));
+
+    index.build(testComponent, QStringLiteral("boot"));
+    QCOMPARE(entryNames(index.findAt(0)), QStringList({ "bootRegister" }));
+    QCOMPARE(index.findAt(0).first().addressBlockName, QString("remapped"));
+
+    index.build(testComponent, QStringLiteral("unknown"));
+    QCOMPARE(entryNames(index.findAt(0)), QStringList({ "normal" }));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_MemoryMapIndex::testElementLimit()
+//-----------------------------------------------------------------------------
+void tst_MemoryMapIndex::testElementLimit()
+{
+    QSharedPointer<Component> testComponent = createComponent();
+    QSharedPointer<MemoryMap> testMap = testComponent->getMemoryMaps()->first();
+
+    QSharedPointer<AddressBlock> testBlock(new AddressBlock(QStringLiteral("block"), QStringLiteral("0")));
+    testMap->getMemoryBlocks()->append(testBlock);
+
+    testBlock->getRegisterData()->append(createRegister(QStringLiteral("first"), QStringLiteral("0"),
+        QStringLiteral("8")));
+
+    // An array far too large to expand, with dimensions whose element count overflows 64 bits.
+    QSharedPointer<Register> hugeRegister = createRegister(QStringLiteral("huge"), QStringLiteral("'h100"),
+        QStringLiteral("8"));
+
+    QSharedPointer<MemoryArray> hugeArray(new MemoryArray());
+    hugeArray->getDimensions()->append(QSharedPointer<MemoryArray::Dimension>(
+        new MemoryArray::Dimension({ QStringLiteral("'h100000000"), QString() })));
+    hugeArray->getDimensions()->append(QSharedPointer<MemoryArray::Dimension>(
+        new MemoryArray::Dimension({ QStringLiteral("'h100000000"), QString() })));
+    hugeRegister->setMemoryArray(hugeArray);
+    testBlock->getRegisterData()->append(hugeRegister);
+
+    testBlock->getRegisterData()->append(createRegister(QStringLiteral("last"), QStringLiteral("'h80"),
+        QStringLiteral("8")));
+
+    MemoryMapIndex index(QSharedPointer<ExpressionParser>(new SystemVerilogExpressionParser()), 4);
+    index.build(testComponent);
+
+    QCOMPARE(index.size(), 4);
+    QCOMPARE(entryNames(index.findAt(0)), QStringList({ "first" }));
+    QCOMPARE(entryNames(index.findAt(0x100)), QStringList({ "huge[0][0]" }));
+    QCOMPARE(entryNames(index.findAt(0x101)), QStringList({ "huge[0][1]" }));
+    QCOMPARE(entryNames(index.findAt(0x102)), QStringList({ "huge[0][2]" }));
+    QVERIFY(index.findAt(0x103).isEmpty());
+    QVERIFY(index.findAt(0x80).isEmpty());
+
+    QCOMPARE(index.getTruncatedItems(), QStringList({ "map.block.huge", "map.block.last" }));
+
+    // A rebuild within the limit is complete.
+    hugeArray->getDimensions()->first()->value_ = QStringLiteral("1");
+    hugeArray->getDimensions()->last()->value_ = QStringLiteral("2");
+
+    index.build(testComponent);
+
+    QCOMPARE(index.size(), 4);
+    QVERIFY(index.getTruncatedItems().isEmpty());
+    QCOMPARE(entryNames(index.findAt(0x80)), QStringList({ "last" }));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_MemoryMapIndex::testFindMatchesLinearSearch()
+//-----------------------------------------------------------------------------
+void tst_MemoryMapIndex::testFindMatchesLinearSearch()
+{
+    QSharedPointer<Component> testComponent = createComponent();
+    QSharedPointer<MemoryMap> testMap = testComponent->getMemoryMaps()->first();
+
+    QSharedPointer<AddressBlock> testBlock(new AddressBlock(QStringLiteral("block"), QStringLiteral("0")));
+    testMap->getMemoryBlocks()->append(testBlock);
+
+    // Overlapping registers of different sizes test the subtree limits of the tree.
+    QRandomGenerator generator(42);
+
+    QVector<QPair<quint64, quint64> > ranges;
+    for (int i = 0; i < 500; ++i)
+    {
+        quint64 offset = generator.bounded(2000);
+        quint64 sizeInBytes = 1 + generator.bounded(i % 10 == 0 ? 64 : 4);
+
+        testBlock->getRegisterData()->append(createRegister(QString("reg%1").arg(i), QString::number(offset),
+            QString::number(sizeInBytes * 8)));
+        ranges.append(qMakePair(offset, offset + sizeInBytes - 1));
+    }
+
+    MemoryMapIndex index(QSharedPointer<ExpressionParser>(new SystemVerilogExpressionParser()));
+    index.build(testComponent);
+
+    QCOMPARE(index.size(), ranges.size());
+
+    for (quint64 address = 0; address < 2100; ++address)
+    {
+        QStringList expected;
+        for (int i = 0; i < ranges.size(); ++i)
+        {
+            if (ranges.at(i).first <= address && address <= ranges.at(i).second)
+            {
+                expected.append(QString("reg%1").arg(i));
+            }
+        }
+
+        QStringList found = entryNames(index.findAt(address));
+
+        expected.sort();
+        found.sort();
+        QCOMPARE(found, expected);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_MemoryMapIndex::createComponent()
+//-----------------------------------------------------------------------------
+QSharedPointer<Component> tst_MemoryMapIndex::createComponent() const
+{
+    QSharedPointer<Component> testComponent(new Component(VLNV(), Document::Revision::Std22));
+    testComponent->getMemoryMaps()->append(QSharedPointer<MemoryMap>(new MemoryMap(QStringLiteral("map"))));
+
+    return testComponent;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_MemoryMapIndex::createRegister()
+//-----------------------------------------------------------------------------
+QSharedPointer<Register> tst_MemoryMapIndex::createRegister(QString const& name, QString const& offset,
+    QString const& size) const
+{
+    return QSharedPointer<Register>(new Register(name, offset, size));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_MemoryMapIndex::entryNames()
+//-----------------------------------------------------------------------------
+QStringList tst_MemoryMapIndex::entryNames(QVector<MemoryMapIndex::Entry> const& entries) const
+{
+    QStringList names;
+    for (MemoryMapIndex::Entry const& entry : entries)
+    {
+        names.append(entry.isField() ? entry.registerName + QLatin1Char('.') + entry.fieldName :
+            entry.registerName);
+    }
+
+    return names;
+}
+
+QTEST_MAIN(tst_MemoryMapIndex)
+
+#include "tst_MemoryMapIndex.moc"
@@ -0,0 +1,5 @@
+# ----------------------------------------------------
+# This file is generated by the Qt Visual Studio Add-in.
+# ------------------------------------------------------
+
+SOURCES += ./tst_MemoryMapIndex.cpp
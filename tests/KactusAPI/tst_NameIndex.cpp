@@ -0,0 +1,180 @@
+//-----------------------------------------------------------------------------
+// File: tst_NameIndex.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 17.10.2026
+//
+// Description:
+// Unit test for class NameIndex.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+#include <QSharedPointer>
+
+#include <KactusAPI/include/NameIndex.h>
+
+#include <IPXACTmodels/Component/Port.h>
+
+class tst_NameIndex : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_NameIndex();
+
+private slots:
+
+    void init();
+
+    void testFindItems();
+    void testLookupAfterInvalidate();
+    void testLookupAfterExternalAdd();
+    void testLookupAfterExternalRemove();
+    void testLookupAfterExternalRename();
+    void testBatchLookupWithoutRebuild();
+
+private:
+
+    //! The indexed ports.
+    QList<QSharedPointer<Port> > ports_;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_NameIndex::tst_NameIndex()
+//-----------------------------------------------------------------------------
+tst_NameIndex::tst_NameIndex():
+ports_()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_NameIndex::init()
+//-----------------------------------------------------------------------------
+void tst_NameIndex::init()
+{
+    ports_.clear();
+    ports_.append(QSharedPointer<Port>(new Port("clk")));
+    ports_.append(QSharedPointer<Port>(new Port("rst_n")));
+    ports_.append(QSharedPointer<Port>(new Port("data")));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_NameIndex::testFindItems()
+//-----------------------------------------------------------------------------
+void tst_NameIndex::testFindItems()
+{
+    NameIndex index;
+
+    QCOMPARE(index.indexOf("clk", ports_), 0);
+    QCOMPARE(index.indexOf("data", ports_), 2);
+    QCOMPARE(index.indexOf("missing", ports_), -1);
+    QCOMPARE(index.find("rst_n", ports_), ports_.at(1));
+    QVERIFY(index.find("missing", ports_).isNull());
+
+    // The first item is found for duplicate names, like in a linear search.
+    ports_.append(QSharedPointer<Port>(new Port("clk")));
+    index.invalidate();
+
+    QCOMPARE(index.indexOf("clk", ports_), 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_NameIndex::testLookupAfterInvalidate()
+//-----------------------------------------------------------------------------
+void tst_NameIndex::testLookupAfterInvalidate()
+{
+    NameIndex index;
+    QCOMPARE(index.indexOf("data", ports_), 2);
+
+    ports_.insert(0, QSharedPointer<Port>(new Port("enable")));
+    ports_.removeAt(2);
+    index.invalidate();
+
+    QCOMPARE(index.indexOf("enable", ports_), 0);
+    QCOMPARE(index.indexOf("clk", ports_), 1);
+    QCOMPARE(index.indexOf("rst_n", ports_), -1);
+    QCOMPARE(index.indexOf("data", ports_), 2);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_NameIndex::testLookupAfterExternalAdd()
+//-----------------------------------------------------------------------------
+void tst_NameIndex::testLookupAfterExternalAdd()
+{
+    NameIndex index;
+    QCOMPARE(index.indexOf("clk", ports_), 0);
+
+    // The list is changed without invalidating the index, like in an undo command.
+    ports_.append(QSharedPointer<Port>(new Port("enable")));
+    QCOMPARE(index.indexOf("enable", ports_), 3);
+
+    ports_.insert(0, QSharedPointer<Port>(new Port("full")));
+    QCOMPARE(index.indexOf("full", ports_), 0);
+    QCOMPARE(index.indexOf("clk", ports_), 1);
+    QCOMPARE(index.indexOf("enable", ports_), 4);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_NameIndex::testLookupAfterExternalRemove()
+//-----------------------------------------------------------------------------
+void tst_NameIndex::testLookupAfterExternalRemove()
+{
+    NameIndex index;
+    QCOMPARE(index.indexOf("data", ports_), 2);
+
+    ports_.removeAt(0);
+
+    QCOMPARE(index.indexOf("clk", ports_), -1);
+    QCOMPARE(index.indexOf("rst_n", ports_), 0);
+    QCOMPARE(index.indexOf("data", ports_), 1);
+
+    ports_.removeLast();
+
+    QCOMPARE(index.indexOf("data", ports_), -1);
+    QVERIFY(index.find("data", ports_).isNull());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_NameIndex::testLookupAfterExternalRename()
+//-----------------------------------------------------------------------------
+void tst_NameIndex::testLookupAfterExternalRename()
+{
+    NameIndex index;
+    QCOMPARE(index.indexOf("rst_n", ports_), 1);
+
+    // The item is renamed directly, like in the name editors.
+    ports_.at(1)->setName("reset");
+
+    QCOMPARE(index.indexOf("reset", ports_), 1);
+    QCOMPARE(index.indexOf("rst_n", ports_), -1);
+    QCOMPARE(index.find("reset", ports_), ports_.at(1));
+
+    ports_.at(1)->setName("rst_n");
+
+    QCOMPARE(index.indexOf("rst_n", ports_), 1);
+    QCOMPARE(index.indexOf("reset", ports_), -1);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_NameIndex::testBatchLookupWithoutRebuild()
+//-----------------------------------------------------------------------------
+void tst_NameIndex::testBatchLookupWithoutRebuild()
+{
+    NameIndex index;
+    index.rebuild(ports_);
+
+    QCOMPARE(index.indexOf("enable", ports_, false), -1);
+
+    ports_.append(QSharedPointer<Port>(new Port("enable")));
+    index.append("enable", ports_.size() - 1);
+
+    QCOMPARE(index.indexOf("enable", ports_, false), 3);
+    QCOMPARE(index.indexOf("clk", ports_, false), 0);
+    QCOMPARE(index.indexOf("full", ports_, false), -1);
+}
+
+QTEST_APPLESS_MAIN(tst_NameIndex)
+
+#include "tst_NameIndex.moc"
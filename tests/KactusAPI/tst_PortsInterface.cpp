@@ -0,0 +1,213 @@
+//-----------------------------------------------------------------------------
+// File: tst_PortsInterface.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 17.10.2026
+//
+// Description:
+// Unit test for the batch functions of class PortsInterface.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+#include <QSharedPointer>
+
+#include <KactusAPI/include/PortsInterface.h>
+#include <KactusAPI/include/SystemVerilogExpressionParser.h>
+#include <KactusAPI/include/ExpressionFormatter.h>
+#include <KactusAPI/include/ListParameterFinder.h>
+
+#include <IPXACTmodels/Component/Port.h>
+#include <IPXACTmodels/Component/View.h>
+#include <IPXACTmodels/Component/validators/PortValidator.h>
+
+class tst_PortsInterface : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_PortsInterface();
+
+private slots:
+
+    void init();
+
+    void testColumnGetters();
+    void testWidthsMatchSinglePortWidth();
+
+    void testSetWirePortsChangesAndAddsPorts();
+    void testSetWirePortsWithRepeatedName();
+    void testSetWirePortsWithColumnSizeMismatch();
+    void testSetWirePortsWithInvalidPortChangesNothing();
+    void testSetWirePortsWithTransactionalPort();
+
+private:
+
+    //! The ports of the tested interface.
+    Port::List ports_;
+
+    //! The tested interface.
+    QSharedPointer<PortsInterface> interface_;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_PortsInterface::tst_PortsInterface()
+//-----------------------------------------------------------------------------
+tst_PortsInterface::tst_PortsInterface():
+ports_(),
+interface_()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PortsInterface::init()
+//-----------------------------------------------------------------------------
+void tst_PortsInterface::init()
+{
+    QSharedPointer<Port> clockPort(new Port("clk"));
+    clockPort->setWire(QSharedPointer<Wire>(new Wire()));
+    clockPort->setDirection(DirectionTypes::IN);
+    clockPort->getWire()->setDefaultDriverValue("1");
+
+    QSharedPointer<Port> dataPort(new Port("data"));
+    dataPort->setWire(QSharedPointer<Wire>(new Wire()));
+    dataPort->setDirection(DirectionTypes::OUT);
+    dataPort->setLeftBound("2*4-1");
+    dataPort->setRightBound("0");
+    dataPort->getWire()->setDefaultDriverValue("'h10");
+
+    QSharedPointer<Port> busPort(new Port("bus"));
+    busPort->setTransactional(QSharedPointer<Transactional>(new Transactional()));
+
+    ports_ = Port::List(new QList<QSharedPointer<Port> >());
+    ports_->append(clockPort);
+    ports_->append(dataPort);
+    ports_->append(busPort);
+
+    QSharedPointer<ExpressionParser> parser(new SystemVerilogExpressionParser());
+    QSharedPointer<ExpressionFormatter> formatter(
+        new ExpressionFormatter(QSharedPointer<ParameterFinder>(new ListParameterFinder())));
+    QSharedPointer<PortValidator> validator(
+        new PortValidator(parser, QSharedPointer<QList<QSharedPointer<View> > >(new QList<QSharedPointer<View> >())));
+
+    interface_ = QSharedPointer<PortsInterface>(new PortsInterface(validator, parser, formatter));
+    interface_->setPorts(ports_);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PortsInterface::testColumnGetters()
+//-----------------------------------------------------------------------------
+void tst_PortsInterface::testColumnGetters()
+{
+    QCOMPARE(interface_->getItemNames(), std::vector<std::string>({ "clk", "data", "bus" }));
+
+    QCOMPARE(interface_->getDirections(), std::vector<std::string>({ "in", "out", "" }));
+    QCOMPARE(interface_->getLeftBoundValues(), std::vector<std::string>({ "", "7", "" }));
+    QCOMPARE(interface_->getRightBoundValues(), std::vector<std::string>({ "", "0", "" }));
+    QCOMPARE(interface_->getDefaultValues(), std::vector<std::string>({ "1", "16", "" }));
+
+    QCOMPARE(interface_->getLeftBoundValues(16), std::vector<std::string>({ "", "'h7", "" }));
+    QCOMPARE(interface_->getDefaultValues(2), std::vector<std::string>({ "'b1", "'b10000", "" }));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PortsInterface::testWidthsMatchSinglePortWidth()
+//-----------------------------------------------------------------------------
+void tst_PortsInterface::testWidthsMatchSinglePortWidth()
+{
+    std::vector<std::string> const widths = interface_->getWidths();
+    QCOMPARE(widths, std::vector<std::string>({ "1", "8", "1" }));
+
+    std::vector<std::string> const names = interface_->getItemNames();
+    for (std::size_t i = 0; i < names.size(); ++i)
+    {
+        QCOMPARE(widths.at(i), interface_->getWidth(names.at(i)));
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PortsInterface::testSetWirePortsChangesAndAddsPorts()
+//-----------------------------------------------------------------------------
+void tst_PortsInterface::testSetWirePortsChangesAndAddsPorts()
+{
+    QSharedPointer<Port> dataPort = ports_->at(1);
+
+    std::vector<std::string> invalidPorts = interface_->setWirePorts({ "data", "enable" }, { "inout", "in" },
+        { "15", "0" }, { "0", "0" });
+
+    QVERIFY(invalidPorts.empty());
+    QCOMPARE(ports_->size(), 4);
+
+    // The existing port object is changed, not replaced.
+    QCOMPARE(ports_->at(1), dataPort);
+    QCOMPARE(dataPort->getDirection(), DirectionTypes::INOUT);
+    QCOMPARE(dataPort->getLeftBound(), QString("15"));
+    QCOMPARE(dataPort->getWire()->getDefaultDriverValue(), QString("'h10"));
+
+    QCOMPARE(ports_->last()->name(), QString("enable"));
+    QCOMPARE(ports_->last()->getDirection(), DirectionTypes::IN);
+
+    QCOMPARE(interface_->getItemIndex("enable"), 3);
+    QCOMPARE(interface_->getWidths(), std::vector<std::string>({ "1", "16", "1", "1" }));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PortsInterface::testSetWirePortsWithRepeatedName()
+//-----------------------------------------------------------------------------
+void tst_PortsInterface::testSetWirePortsWithRepeatedName()
+{
+    std::vector<std::string> invalidPorts = interface_->setWirePorts({ "enable", "enable" }, { "in", "out" });
+
+    QVERIFY(invalidPorts.empty());
+    QCOMPARE(ports_->size(), 4);
+    QCOMPARE(ports_->last()->getDirection(), DirectionTypes::OUT);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PortsInterface::testSetWirePortsWithColumnSizeMismatch()
+//-----------------------------------------------------------------------------
+void tst_PortsInterface::testSetWirePortsWithColumnSizeMismatch()
+{
+    std::vector<std::string> invalidPorts = interface_->setWirePorts({ "clk", "enable" }, { "out" });
+
+    QCOMPARE(invalidPorts, std::vector<std::string>({ "clk", "enable" }));
+    QCOMPARE(ports_->size(), 3);
+    QCOMPARE(ports_->first()->getDirection(), DirectionTypes::IN);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PortsInterface::testSetWirePortsWithInvalidPortChangesNothing()
+//-----------------------------------------------------------------------------
+void tst_PortsInterface::testSetWirePortsWithInvalidPortChangesNothing()
+{
+    std::vector<std::string> invalidPorts = interface_->setWirePorts({ "data", "enable", "clk" },
+        { "in", "in", "sideways" }, { "31", "3", "0" }, { "0", "0", "0" });
+
+    QCOMPARE(invalidPorts, std::vector<std::string>({ "clk" }));
+
+    QCOMPARE(ports_->size(), 3);
+    QCOMPARE(ports_->at(0)->getDirection(), DirectionTypes::IN);
+    QCOMPARE(ports_->at(0)->getWire()->getVectors()->isEmpty(), true);
+    QCOMPARE(ports_->at(1)->getDirection(), DirectionTypes::OUT);
+    QCOMPARE(ports_->at(1)->getLeftBound(), QString("2*4-1"));
+    QCOMPARE(interface_->getItemIndex("enable"), -1);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PortsInterface::testSetWirePortsWithTransactionalPort()
+//-----------------------------------------------------------------------------
+void tst_PortsInterface::testSetWirePortsWithTransactionalPort()
+{
+    std::vector<std::string> invalidPorts = interface_->setWirePorts({ "bus", "clk" }, { "in", "out" });
+
+    QCOMPARE(invalidPorts, std::vector<std::string>({ "bus" }));
+
+    QVERIFY(ports_->at(2)->getTransactional());
+    QVERIFY(ports_->at(2)->getWire().isNull());
+    QCOMPARE(ports_->at(0)->getDirection(), DirectionTypes::IN);
+}
+
+QTEST_APPLESS_MAIN(tst_PortsInterface)
+
+#include "tst_PortsInterface.moc"
@@ -0,0 +1,261 @@
+//-----------------------------------------------------------------------------
+// File: tst_RegisterInterface.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: agent
+// Date: 17.10.2026
+//
+// Description:
+// Unit test for the batch functions of classes RegisterInterface and FieldInterface.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+#include <QSharedPointer>
+
+#include <KactusAPI/include/RegisterInterface.h>
+#include <KactusAPI/include/FieldInterface.h>
+#include <KactusAPI/include/ResetInterface.h>
+#include <KactusAPI/include/AccessPolicyInterface.h>
+#include <KactusAPI/include/ModeReferenceInterface.h>
+#include <KactusAPI/include/SystemVerilogExpressionParser.h>
+#include <KactusAPI/include/ExpressionFormatter.h>
+#include <KactusAPI/include/ListParameterFinder.h>
+
+#include <IPXACTmodels/Component/Register.h>
+#include <IPXACTmodels/Component/Field.h>
+#include <IPXACTmodels/Component/validators/RegisterValidator.h>
+#include <IPXACTmodels/Component/validators/FieldValidator.h>
+#include <IPXACTmodels/Component/validators/EnumeratedValueValidator.h>
+#include <IPXACTmodels/common/validators/ParameterValidator.h>
+
+class tst_RegisterInterface : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_RegisterInterface();
+
+private slots:
+
+    void init();
+
+    void testRegisterColumnGetters();
+    void testSetRegisterValues();
+    void testSetRegisterValuesReportsInvalidRegisters();
+    void testSetRegisterValuesWithColumnSizeMismatch();
+
+    void testFieldColumnGetters();
+    void testSetFieldValues();
+    void testSetFieldValuesReportsInvalidFields();
+    void testSetFieldValuesWithColumnSizeMismatch();
+
+private:
+
+    //! The registers of the tested register interface.
+    QSharedPointer<QList<QSharedPointer<RegisterBase> > > registers_;
+
+    //! The fields of the tested field interface.
+    QSharedPointer<QList<QSharedPointer<Field> > > fields_;
+
+    //! The sub interfaces of the tested interfaces.
+    QSharedPointer<ModeReferenceInterface> modeReferenceInterface_;
+    QSharedPointer<AccessPolicyInterface> accessPolicyInterface_;
+    QSharedPointer<ResetInterface> resetInterface_;
+
+    //! The tested interfaces.
+    QSharedPointer<FieldInterface> fieldInterface_;
+    QSharedPointer<RegisterInterface> registerInterface_;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_RegisterInterface::tst_RegisterInterface()
+//-----------------------------------------------------------------------------
+tst_RegisterInterface::tst_RegisterInterface():
+registers_(),
+fields_(),
+modeReferenceInterface_(),
+accessPolicyInterface_(),
+resetInterface_(),
+fieldInterface_(),
+registerInterface_()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_RegisterInterface::init()
+//-----------------------------------------------------------------------------
+void tst_RegisterInterface::init()
+{
+    QSharedPointer<Field> enableField(new Field("enable"));
+    enableField->setBitOffset("0");
+    enableField->setBitWidth("1");
+
+    QSharedPointer<Field> modeField(new Field("mode"));
+    modeField->setBitOffset("2*2");
+    modeField->setBitWidth("'h4");
+
+    fields_ = QSharedPointer<QList<QSharedPointer<Field> > >(new QList<QSharedPointer<Field> >());
+    fields_->append(enableField);
+    fields_->append(modeField);
+
+    QSharedPointer<Register> controlRegister(new Register("control", "0", "32"));
+    controlRegister->getFields()->append(enableField);
+
+    QSharedPointer<Register> statusRegister(new Register("status", "4*1", "16"));
+    statusRegister->getFields()->append(modeField);
+
+    registers_ = QSharedPointer<QList<QSharedPointer<RegisterBase> > >(
+        new QList<QSharedPointer<RegisterBase> >());
+    registers_->append(controlRegister);
+    registers_->append(statusRegister);
+
+    QSharedPointer<ExpressionParser> parser(new SystemVerilogExpressionParser());
+    QSharedPointer<ExpressionFormatter> formatter(
+        new ExpressionFormatter(QSharedPointer<ParameterFinder>(new ListParameterFinder())));
+
+    QSharedPointer<ParameterValidator> parameterValidator(new ParameterValidator(parser,
+        QSharedPointer<QList<QSharedPointer<Choice> > >(new QList<QSharedPointer<Choice> >()),
+        Document::Revision::Std14));
+    QSharedPointer<FieldValidator> fieldValidator(new FieldValidator(parser,
+        QSharedPointer<EnumeratedValueValidator>(new EnumeratedValueValidator(parser)), parameterValidator));
+    QSharedPointer<RegisterValidator> registerValidator(
+        new RegisterValidator(parser, fieldValidator, parameterValidator));
+
+    modeReferenceInterface_ = QSharedPointer<ModeReferenceInterface>(new ModeReferenceInterface());
+    accessPolicyInterface_ =
+        QSharedPointer<AccessPolicyInterface>(new AccessPolicyInterface(modeReferenceInterface_.data()));
+    resetInterface_ = QSharedPointer<ResetInterface>(new ResetInterface(fieldValidator, parser, formatter));
+
+    fieldInterface_ = QSharedPointer<FieldInterface>(
+        new FieldInterface(fieldValidator, parser, formatter, resetInterface_.data()));
+    fieldInterface_->setFields(fields_);
+
+    registerInterface_ = QSharedPointer<RegisterInterface>(new RegisterInterface(registerValidator, parser,
+        formatter, fieldInterface_.data(), accessPolicyInterface_.data()));
+    registerInterface_->setRegisters(registers_);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_RegisterInterface::testRegisterColumnGetters()
+//-----------------------------------------------------------------------------
+void tst_RegisterInterface::testRegisterColumnGetters()
+{
+    QCOMPARE(registerInterface_->getItemNames(), std::vector<std::string>({ "control", "status" }));
+
+    QCOMPARE(registerInterface_->getOffsetValues(), std::vector<std::string>({ "0", "4" }));
+    QCOMPARE(registerInterface_->getOffsetValues(16), std::vector<std::string>({ "'h0", "'h4" }));
+    QCOMPARE(registerInterface_->getSizeValues(), std::vector<std::string>({ "32", "16" }));
+
+    // The columns match the single register getters.
+    QCOMPARE(registerInterface_->getOffsetValues(16).back(), registerInterface_->getOffsetValue("status", 16));
+    QCOMPARE(registerInterface_->getSizeValues().front(), registerInterface_->getSizeValue("control"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_RegisterInterface::testSetRegisterValues()
+//-----------------------------------------------------------------------------
+void tst_RegisterInterface::testSetRegisterValues()
+{
+    std::vector<std::string> invalidRegisters = registerInterface_->setRegisterValues({ "status", "control" },
+        { "8", "'h10" }, { "8", "64" }, { "2", "1+1" });
+
+    QVERIFY(invalidRegisters.empty());
+    QCOMPARE(registerInterface_->getOffsetValues(), std::vector<std::string>({ "16", "8" }));
+    QCOMPARE(registerInterface_->getSizeValues(), std::vector<std::string>({ "64", "8" }));
+    QCOMPARE(registerInterface_->getDimensionValues(), std::vector<std::string>({ "2", "2" }));
+
+    // An empty column keeps the current values.
+    invalidRegisters = registerInterface_->setRegisterValues({ "control" }, {}, { "32" });
+
+    QVERIFY(invalidRegisters.empty());
+    QCOMPARE(registerInterface_->getOffsetValues(), std::vector<std::string>({ "16", "8" }));
+    QCOMPARE(registerInterface_->getSizeValues(), std::vector<std::string>({ "32", "8" }));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_RegisterInterface::testSetRegisterValuesReportsInvalidRegisters()
+//-----------------------------------------------------------------------------
+void tst_RegisterInterface::testSetRegisterValuesReportsInvalidRegisters()
+{
+    std::vector<std::string> invalidRegisters = registerInterface_->setRegisterValues(
+        { "control", "missing", "status" }, {}, { "0", "8", "16" });
+
+    QCOMPARE(invalidRegisters, std::vector<std::string>({ "missing", "control" }));
+    QCOMPARE(registerInterface_->getSizeValues(), std::vector<std::string>({ "0", "16" }));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_RegisterInterface::testSetRegisterValuesWithColumnSizeMismatch()
+//-----------------------------------------------------------------------------
+void tst_RegisterInterface::testSetRegisterValuesWithColumnSizeMismatch()
+{
+    std::vector<std::string> invalidRegisters = registerInterface_->setRegisterValues({ "control", "status" },
+        { "8" }, {});
+
+    QCOMPARE(invalidRegisters, std::vector<std::string>({ "control", "status" }));
+    QCOMPARE(registerInterface_->getOffsetValues(), std::vector<std::string>({ "0", "4" }));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_RegisterInterface::testFieldColumnGetters()
+//-----------------------------------------------------------------------------
+void tst_RegisterInterface::testFieldColumnGetters()
+{
+    QCOMPARE(fieldInterface_->getItemNames(), std::vector<std::string>({ "enable", "mode" }));
+
+    QCOMPARE(fieldInterface_->getOffsetValues(), std::vector<std::string>({ "0", "4" }));
+    QCOMPARE(fieldInterface_->getWidthValues(), std::vector<std::string>({ "1", "4" }));
+    QCOMPARE(fieldInterface_->getWidthValues(2), std::vector<std::string>({ "'b1", "'b100" }));
+
+    QCOMPARE(fieldInterface_->getOffsetValues().back(), fieldInterface_->getOffsetValue("mode"));
+    QCOMPARE(fieldInterface_->getWidthValues().front(), fieldInterface_->getWidthValue("enable"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_RegisterInterface::testSetFieldValues()
+//-----------------------------------------------------------------------------
+void tst_RegisterInterface::testSetFieldValues()
+{
+    std::vector<std::string> invalidFields = fieldInterface_->setFieldValues({ "mode", "enable" },
+        { "8", "1" }, { "2", "2+1" });
+
+    QVERIFY(invalidFields.empty());
+    QCOMPARE(fieldInterface_->getOffsetValues(), std::vector<std::string>({ "1", "8" }));
+    QCOMPARE(fieldInterface_->getWidthValues(), std::vector<std::string>({ "3", "2" }));
+
+    // An empty column keeps the current values.
+    invalidFields = fieldInterface_->setFieldValues({ "enable" }, {}, { "1" });
+
+    QVERIFY(invalidFields.empty());
+    QCOMPARE(fieldInterface_->getOffsetValues(), std::vector<std::string>({ "1", "8" }));
+    QCOMPARE(fieldInterface_->getWidthValues(), std::vector<std::string>({ "1", "2" }));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_RegisterInterface::testSetFieldValuesReportsInvalidFields()
+//-----------------------------------------------------------------------------
+void tst_RegisterInterface::testSetFieldValuesReportsInvalidFields()
+{
+    std::vector<std::string> invalidFields = fieldInterface_->setFieldValues({ "enable", "missing", "mode" },
+        { "0", "0", "4" }, { "unknown+", "1", "2" });
+
+    QCOMPARE(invalidFields, std::vector<std::string>({ "missing", "enable" }));
+    QCOMPARE(fieldInterface_->getWidthValues().back(), std::string("2"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_RegisterInterface::testSetFieldValuesWithColumnSizeMismatch()
+//-----------------------------------------------------------------------------
+void tst_RegisterInterface::testSetFieldValuesWithColumnSizeMismatch()
+{
+    std::vector<std::string> invalidFields = fieldInterface_->setFieldValues({ "enable", "mode" },
+        {}, { "2", "2", "2" });
+
+    QCOMPARE(invalidFields, std::vector<std::string>({ "enable", "mode" }));
+    QCOMPARE(fieldInterface_->getWidthValues(), std::vector<std::string>({ "1", "4" }));
+}
+
+QTEST_APPLESS_MAIN(tst_RegisterInterface)
+
+#include "tst_RegisterInterface.moc"
@@ -0,0 +1,46 @@
+#-----------------------------------------------------------------------------
+# File: tst_RegisterInterface.pro
+#-----------------------------------------------------------------------------
+# Project: Kactus2
+# Author: agent
+# Date: 17.10.2026
+#
+# Description:
+# Qt project file for running unit tests for RegisterInterface.
+#-----------------------------------------------------------------------------
+
+TEMPLATE = app
+
+TARGET = tst_RegisterInterface
+
+QT += core xml testlib
+QT -= gui widgets
+CONFIG += c++17 testcase console
+
+win32:CONFIG(release, debug|release) {
+    LIBS += -L$$PWD/../../executable/ -lIPXACTmodels -lKactusAPI
+    DESTDIR = ./release
+}
+else:win32:CONFIG(debug, debug|release) {
+    LIBS += -L$$PWD/../../executable/ -lIPXACTmodelsd -lKactusAPId
+    DESTDIR = ./debug
+}
+else:unix {
+    LIBS += -L$$PWD/../../executable/ -lIPXACTmodels -lKactusAPI
+    DESTDIR = ./release
+}
+
+INCLUDEPATH += $$PWD/../../
+INCLUDEPATH += $$PWD/../../executable
+INCLUDEPATH += $$DESTDIR
+
+DEPENDPATH += $$PWD/../../
+DEPENDPATH += $$PWD/../../executable
+DEPENDPATH += .
+
+OBJECTS_DIR += $$DESTDIR
+
+MOC_DIR += ./generatedFiles
+UI_DIR += ./generatedFiles
+RCC_DIR += ./generatedFiles
+include(tst_RegisterInterface.pri)
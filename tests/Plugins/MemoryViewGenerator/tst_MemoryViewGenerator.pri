@@ -8,11 +8,13 @@ HEADERS += ../../../editors/MemoryDesigner/ConnectivityComponent.h \
     ../../../editors/MemoryDesigner/ConnectivityGraphFactory.h \
     ../../../editors/MemoryDesigner/ConnectivityInterface.h \
     ../../../Plugins/PluginSystem/GeneratorPlugin/GenerationControl.h \
+    ../../../Plugins/PluginSystem/GeneratorPlugin/OutputFileSink.h \
     ../../../editors/MemoryDesigner/MasterSlavePathSearch.h \
     ../../../editors/MemoryDesigner/MemoryItem.h \
     ../../../Plugins/MemoryViewGenerator/MemoryViewGenerator.h \
     ../../../Plugins/common/HDLParser/MetaComponent.h \
     ../../../Plugins/common/HDLParser/MetaDesign.h \
+    ../../../Plugins/common/HDLParser/ReadOnlyLibraryView.h \
     ../../../Plugins/common/HDLParser/MetaInstance.h \
     ../../../Plugins/PluginSystem/GeneratorPlugin/OutputControl.h \
     ../../../Plugins/PluginSystem/GeneratorPlugin/ViewSelection.h \
@@ -25,6 +27,7 @@ SOURCES += ../../../editors/MemoryDesigner/ConnectivityComponent.cpp \
     ../../../editors/MemoryDesigner/ConnectivityGraphFactory.cpp \
     ../../../editors/MemoryDesigner/ConnectivityInterface.cpp \
     ../../../Plugins/PluginSystem/GeneratorPlugin/GenerationControl.cpp \
+    ../../../Plugins/PluginSystem/GeneratorPlugin/OutputFileSink.cpp \
     ../../MockObjects/LibraryMock.cpp \
     ../../../editors/MemoryDesigner/MasterSlavePathSearch.cpp \
     ../../../editors/MemoryDesigner/MemoryItem.cpp \
@@ -32,6 +35,7 @@ SOURCES += ../../../editors/MemoryDesigner/ConnectivityComponent.cpp \
     ../../../Plugins/MemoryViewGenerator/MemoryViewGeneratorPlugin.cpp \
     ../../../Plugins/common/HDLParser/MetaComponent.cpp \
     ../../../Plugins/common/HDLParser/MetaDesign.cpp \
+    ../../../Plugins/common/HDLParser/ReadOnlyLibraryView.cpp \
     ../../../Plugins/common/HDLParser/MetaInstance.cpp \
     ../../../Plugins/PluginSystem/GeneratorPlugin/OutputControl.cpp \
     ../../../Plugins/PluginSystem/GeneratorPlugin/ViewSelection.cpp \
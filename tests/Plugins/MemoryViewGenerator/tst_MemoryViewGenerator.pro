@@ -13,7 +13,7 @@ TEMPLATE = app
 
 TARGET = tst_MemoryViewGenerator
 
-QT += core xml testlib widgets
+QT += core xml testlib widgets concurrent
 CONFIG += c++11 testcase console
 
 DEFINES += MEMORYVIEWGENERATOR_LIB
@@ -21,6 +21,7 @@
 #include <Plugins/common/HDLParser/MetaComponent.h>
 #include <Plugins/VerilogImport/VerilogSyntax.h>
 #include <Plugins/PluginSystem/GeneratorPlugin/GenerationControl.h>
+#include <Plugins/PluginSystem/GeneratorPlugin/OutputFileSink.h>
 
 #include <IPXACTmodels/AbstractionDefinition/AbstractionDefinition.h>
 #include <IPXACTmodels/AbstractionDefinition/PortAbstraction.h>
@@ -35,6 +36,24 @@
 #include <IPXACTmodels/Component/Component.h>
 #include <IPXACTmodels/Component/BusInterface.h>
 #include <IPXACTmodels/Component/PortMap.h>
+#include <IPXACTmodels/Component/FileSet.h>
+
+//-----------------------------------------------------------------------------
+//! Library mock, which saves the documents it knows a path for.
+//-----------------------------------------------------------------------------
+class SavingLibraryMock : public LibraryMock
+{
+public:
+
+    SavingLibraryMock(QObject* parent): LibraryMock(parent) {}
+
+    using LibraryMock::writeModelToFile;
+
+    bool writeModelToFile(QSharedPointer<Document> model) override
+    {
+        return getPath(model->getVlnv()).isEmpty() == false;
+    }
+};
 
 class tst_VerilogWriterFactory : public QObject
 {
@@ -97,10 +116,14 @@ private slots:
 	void testGenerationWithImplementationWithTag();
 	void testGenerationWithImplementationWithPostModule();
 
+    void testUnchangedOutputFileIsNotRewritten();
+
 private slots:
 
     void gatherErrorMessage(QString const& errorMessage);
 
+    void gatherNoticeMessage(QString const& noticeMessage);
+
 private:
 
     QSharedPointer<MetaInterconnection> addInterconnectToDesign(QSharedPointer<MetaInterface> first,
@@ -123,6 +146,8 @@ private:
 
     void runGenerator(bool useDesign);
 
+    bool writeOutputFile(QString const& outputPath = QDir::currentPath());
+
     void createPortAssignment(QSharedPointer<MetaPort> mPort, QSharedPointer<MetaWire> wire, bool up,
         QString const& logicalLeft, QString const& logicalRight, QString const& physicalLeft, 
         QString const& physicalRight);
@@ -206,13 +231,16 @@ private:
     LibraryMock library_;
 
     QStringList errorMessages_;
+
+    QStringList noticeMessages_;
 };
 
 //-----------------------------------------------------------------------------
 // Function: tst_VerilogWriterFactory::tst_VerilogWriterFactory()
 //-----------------------------------------------------------------------------
 tst_VerilogWriterFactory::tst_VerilogWriterFactory(): output_(), generationTime_(), library_(this),
-errorMessages_()
+errorMessages_(),
+noticeMessages_()
 {
 }
 
@@ -253,6 +281,7 @@ void tst_VerilogWriterFactory::init()
 
     library_.clear();
     errorMessages_.clear();
+    noticeMessages_.clear();
 }
 
 //-----------------------------------------------------------------------------
@@ -2676,6 +2705,14 @@ void tst_VerilogWriterFactory::gatherErrorMessage(QString const& errorMessage)
     errorMessages_.append(errorMessage);
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_VerilogWriterFactory::gatherNoticeMessage()
+//-----------------------------------------------------------------------------
+void tst_VerilogWriterFactory::gatherNoticeMessage(QString const& noticeMessage)
+{
+    noticeMessages_.append(noticeMessage);
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_VerilogWriterFactory::testGenerationWithImplementation()
 //-----------------------------------------------------------------------------
@@ -2826,6 +2863,103 @@ void tst_VerilogWriterFactory::testGenerationWithImplementationWithPostModule()
 	verifyOutputContains(content);
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_VerilogWriterFactory::testUnchangedOutputFileIsNotRewritten()
+//-----------------------------------------------------------------------------
+void tst_VerilogWriterFactory::testUnchangedOutputFileIsNotRewritten()
+{
+    addPort("clk", 1, DirectionTypes::IN, flatComponent_);
+    addPort("dataIn", 8, DirectionTypes::IN, flatComponent_);
+
+    QSharedPointer<FileSet> fileSet(new FileSet("verilogSource"));
+    flatComponent_->getComponent()->getFileSets()->append(fileSet);
+
+    QVERIFY(writeOutputFile());
+    QCOMPARE(errorMessages_.isEmpty(), true);
+    QCOMPARE(fileSet->getFiles()->size(), 1);
+    QCOMPARE(fileSet->getFiles()->first()->name(), QString("TestComponent.v"));
+
+    // The file is made to look like an earlier generation, which only differs in the creation time.
+    QFile writtenFile("TestComponent.v");
+    QVERIFY(writtenFile.open(QIODevice::ReadOnly));
+
+    QByteArray earlierContent;
+    while (writtenFile.atEnd() == false)
+    {
+        QByteArray line = writtenFile.readLine();
+        if (line.startsWith("// Creation time : "))
+        {
+            line = "// Creation time : 00:00:00\n";
+        }
+
+        earlierContent.append(line);
+    }
+    writtenFile.close();
+
+    QDateTime const earlierModified(QDate(2020, 1, 1), QTime(12, 0));
+
+    QVERIFY(writtenFile.open(QIODevice::WriteOnly));
+    QCOMPARE(writtenFile.write(earlierContent), earlierContent.size());
+    writtenFile.flush();
+    QVERIFY(writtenFile.setFileTime(earlierModified, QFileDevice::FileModificationTime));
+    writtenFile.close();
+
+    QVERIFY(writeOutputFile());
+    QCOMPARE(QFileInfo("TestComponent.v").lastModified(), earlierModified);
+    QCOMPARE(noticeMessages_.filter("Output file is unchanged").size(), 1);
+
+    // The unchanged file is still kept in the file set, without adding it again.
+    QCOMPARE(fileSet->getFiles()->size(), 1);
+
+    addPort("dataOut", 8, DirectionTypes::OUT, flatComponent_);
+
+    QVERIFY(writeOutputFile());
+    QVERIFY(QFileInfo("TestComponent.v").lastModified() > earlierModified);
+    QCOMPARE(noticeMessages_.filter("Output file is unchanged").size(), 1);
+    QCOMPARE(fileSet->getFiles()->size(), 1);
+
+    QFile outputFile("TestComponent.v");
+    QVERIFY(outputFile.open(QIODevice::ReadOnly));
+    QVERIFY(outputFile.readAll().contains("dataOut"));
+    outputFile.close();
+
+    // A file which cannot be opened fails the generation.
+    QVERIFY(writeOutputFile(QDir::currentPath() + "/nonExistingFolder") == false);
+    QCOMPARE(errorMessages_.filter("Could not open output file for writing").size(), 1);
+    QCOMPARE(errorMessages_.size(), 1);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VerilogWriterFactory::writeOutputFile()
+//-----------------------------------------------------------------------------
+bool tst_VerilogWriterFactory::writeOutputFile(QString const& outputPath)
+{
+    GenerationSettings settings;
+    settings.generateInterfaces_ = false;
+
+    MessagePasser messages;
+    connect(&messages, SIGNAL(errorMessage(QString const&)),
+        this, SLOT(gatherErrorMessage(QString const&)), Qt::UniqueConnection);
+    connect(&messages, SIGNAL(noticeMessage(QString const&)),
+        this, SLOT(gatherNoticeMessage(QString const&)), Qt::UniqueConnection);
+
+    // The component is saved next to the generated file, so that the file set gets a relative path.
+    SavingLibraryMock library(this);
+    library.writeModelToFile(QDir::currentPath() + "/TestComponent.1.0.xml", flatComponent_->getComponent());
+
+    GenerationTuple input;
+    input.component = flatComponent_->getComponent();
+    input.messages = &messages;
+
+    VerilogWriterFactory factory(&library, &messages, &settings, "bogusToolVersion", "bogusGeneratorVersion");
+    GenerationControl control(&library, &factory, input, &settings);
+
+    control.getOutputControl()->setOutputPath(outputPath);
+    control.getOutputControl()->getOutputs()->append(factory.prepareComponent(outputPath, flatComponent_));
+
+    return control.writeDocuments();
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_VerilogWriterFactory::verifyOutputContains()
 //-----------------------------------------------------------------------------
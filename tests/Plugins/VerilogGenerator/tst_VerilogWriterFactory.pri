@@ -12,14 +12,17 @@ HEADERS += ../../../Plugins/VerilogGenerator/CommentWriter/CommentWriter.h \
     ../../../IPXACTmodels/utilities/ComponentSearch.h \
     ../../../Plugins/VerilogGenerator/ComponentVerilogWriter/ComponentVerilogWriter.h \
     ../../../Plugins/PluginSystem/GeneratorPlugin/GenerationControl.h \
+    ../../../Plugins/PluginSystem/GeneratorPlugin/ViewSelection.h \
     ../../../Plugins/common/HDLParser/HDLParserCommon.h \
     ../../../Plugins/PluginSystem/GeneratorPlugin/IWriterFactory.h \
     ../../../Plugins/common/PortSorter/InterfaceDirectionNameSorter.h \
     ../../../Plugins/common/HDLParser/MetaComponent.h \
     ../../../Plugins/common/HDLParser/MetaDesign.h \
+    ../../../Plugins/common/HDLParser/ReadOnlyLibraryView.h \
     ../../../Plugins/common/HDLParser/MetaInstance.h \
     ../../../Plugins/VerilogGenerator/ModelParameterVerilogWriter/ModelParameterVerilogWriter.h \
     ../../../Plugins/PluginSystem/GeneratorPlugin/OutputControl.h \
+    ../../../Plugins/PluginSystem/GeneratorPlugin/OutputFileSink.h \
     ../../../Plugins/common/PortSorter/PortSorter.h \
     ../../../Plugins/VerilogGenerator/TextBodyWriter/TextBodyWriter.h \
     ../../../editors/common/TopComponentParameterFinder.h \
@@ -43,11 +46,15 @@ SOURCES += ../../../Plugins/VerilogGenerator/CommentWriter/CommentWriter.cpp \
     ../../../Plugins/common/PortSorter/InterfaceDirectionNameSorter.cpp \
     ../../MockObjects/LibraryMock.cpp \
     ../../../Plugins/PluginSystem/GeneratorPlugin/MessagePasser.cpp \
+    ../../../Plugins/PluginSystem/GeneratorPlugin/GenerationControl.cpp \
+    ../../../Plugins/PluginSystem/GeneratorPlugin/ViewSelection.cpp \
     ../../../Plugins/common/HDLParser/MetaComponent.cpp \
     ../../../Plugins/common/HDLParser/MetaDesign.cpp \
+    ../../../Plugins/common/HDLParser/ReadOnlyLibraryView.cpp \
     ../../../Plugins/common/HDLParser/MetaInstance.cpp \
     ../../../Plugins/VerilogGenerator/ModelParameterVerilogWriter/ModelParameterVerilogWriter.cpp \
     ../../../Plugins/PluginSystem/GeneratorPlugin/OutputControl.cpp \
+    ../../../Plugins/PluginSystem/GeneratorPlugin/OutputFileSink.cpp \
     ../../../Plugins/VerilogGenerator/TextBodyWriter/TextBodyWriter.cpp \
     ../../../editors/common/TopComponentParameterFinder.cpp \
     ../../../Plugins/VerilogGenerator/VerilogAssignmentWriter/VerilogAssignmentWriter.cpp \
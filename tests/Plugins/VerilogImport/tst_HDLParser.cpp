@@ -79,6 +79,8 @@ private slots:
     void testInstanceParametersAreCulled();
     void testDesignParametersAreUtilized();
 	void testTopComponentParametersAreUtilized();
+    void testIdenticalSubDesignsAreShared();
+    void testParallelParsingGivesSameDesigns();
 
     // Flat test cases:
     void testFlatComponent();
@@ -102,6 +104,8 @@ private:
 
     QSharedPointer<View> addTestComponentToLibrary(VLNV vlnv);
 
+    QSharedPointer<View> addHierarchicalComponentToLibrary(VLNV vlnv);
+
     QSharedPointer<ComponentInstance> addInstanceToDesign(QString instanceName, VLNV instanceVlnv, QSharedPointer<View> activeView);
 
     QSharedPointer<PortMap> mapPortToInterface(QString const& portName, QString const& logicalName, 
@@ -685,6 +689,31 @@ QSharedPointer<View> tst_HDLParser::addTestComponentToLibrary(VLNV vlnv)
 	return activeView;
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_HDLParser::addHierarchicalComponentToLibrary()
+//-----------------------------------------------------------------------------
+QSharedPointer<View> tst_HDLParser::addHierarchicalComponentToLibrary(VLNV vlnv)
+{
+    QSharedPointer<ConfigurableVLNVReference> subDesignVLNV(
+        new ConfigurableVLNVReference(VLNV::DESIGN, "Test", "TestLibrary", "TestSubDesign", "1.0"));
+    QSharedPointer<Design> subDesign(new Design(*subDesignVLNV, Document::Revision::Std14));
+    library_.addComponent(subDesign);
+
+    QSharedPointer<DesignInstantiation> subDesignInstantiation(new DesignInstantiation("subDesignInstantiation"));
+    subDesignInstantiation->setDesignReference(subDesignVLNV);
+
+    QSharedPointer<View> hierarchicalView(new View("structural"));
+    hierarchicalView->setDesignInstantiationRef(subDesignInstantiation->name());
+
+    QSharedPointer<Component> hierarchicalComponent(new Component(vlnv, Document::Revision::Std14));
+    hierarchicalComponent->getDesignInstantiations()->append(subDesignInstantiation);
+    hierarchicalComponent->getViews()->append(hierarchicalView);
+    addParameter("width", "8", "widthId", hierarchicalComponent);
+    library_.addComponent(hierarchicalComponent);
+
+    return hierarchicalView;
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_HDLParser::addInstanceToDesign()
 //-----------------------------------------------------------------------------
@@ -2313,6 +2342,88 @@ void tst_HDLParser::testTopComponentParametersAreUtilized()
     QCOMPARE(mInstance->getParameters()->value(0)->getValue(), QString("55"));
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_HDLParser::testIdenticalSubDesignsAreShared()
+//-----------------------------------------------------------------------------
+void tst_HDLParser::testIdenticalSubDesignsAreShared()
+{
+    VLNV hierarchicalVLNV(VLNV::COMPONENT, "Test", "TestLibrary", "TestHierarchical", "1.0");
+    QSharedPointer<View> hierarchicalView = addHierarchicalComponentToLibrary(hierarchicalVLNV);
+
+    addInstanceToDesign("first", hierarchicalVLNV, hierarchicalView);
+    addInstanceToDesign("second", hierarchicalVLNV, hierarchicalView);
+    QSharedPointer<ComponentInstance> wideInstance =
+        addInstanceToDesign("wide", hierarchicalVLNV, hierarchicalView);
+
+    QSharedPointer<ConfigurableElementValue> widthOverride(new ConfigurableElementValue());
+    widthOverride->setReferenceId("widthId");
+    widthOverride->setConfigurableValue("16");
+    wideInstance->getConfigurableElementValues()->append(widthOverride);
+
+    QList<QSharedPointer<MetaDesign> > designs = MetaDesign::parseHierarchy(&library_, input_, topView_);
+
+    // The top design and one sub design for each distinct width.
+    QCOMPARE(designs.size(), 3);
+
+    QSharedPointer<MetaDesign> design = designs.first();
+    QSharedPointer<MetaInstance> firstInstance = design->getInstances()->value("first");
+    QSharedPointer<MetaInstance> secondInstance = design->getInstances()->value("second");
+    QSharedPointer<MetaInstance> wideMetaInstance = design->getInstances()->value("wide");
+
+    QCOMPARE(firstInstance->getModuleName(), QString("TestHierarchical_0"));
+    QCOMPARE(secondInstance->getModuleName(), firstInstance->getModuleName());
+    QCOMPARE(wideMetaInstance->getModuleName(), QString("TestHierarchical_1"));
+
+    QCOMPARE(designs.at(1)->getTopInstance(), firstInstance);
+    QCOMPARE(designs.at(2)->getTopInstance(), wideMetaInstance);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_HDLParser::testParallelParsingGivesSameDesigns()
+//-----------------------------------------------------------------------------
+void tst_HDLParser::testParallelParsingGivesSameDesigns()
+{
+    VLNV hierarchicalVLNV(VLNV::COMPONENT, "Test", "TestLibrary", "TestHierarchical", "1.0");
+    QSharedPointer<View> hierarchicalView = addHierarchicalComponentToLibrary(hierarchicalVLNV);
+
+    // Each instance has a different width, so each of them is elaborated into its own sub design.
+    for (int i = 0; i < 4; ++i)
+    {
+        QSharedPointer<ComponentInstance> instance =
+            addInstanceToDesign("instance" + QString::number(i), hierarchicalVLNV, hierarchicalView);
+
+        QSharedPointer<ConfigurableElementValue> widthOverride(new ConfigurableElementValue());
+        widthOverride->setReferenceId("widthId");
+        widthOverride->setConfigurableValue(QString::number(8 * (i + 1)));
+        instance->getConfigurableElementValues()->append(widthOverride);
+    }
+
+    QList<QSharedPointer<MetaDesign> > sequentialDesigns = MetaDesign::parseHierarchy(&library_, input_,
+        topView_, MetaDesign::ParseMode::Sequential);
+    QList<QSharedPointer<MetaDesign> > parallelDesigns = MetaDesign::parseHierarchy(&library_, input_,
+        topView_, MetaDesign::ParseMode::Parallel);
+
+    QCOMPARE(sequentialDesigns.size(), 5);
+    QCOMPARE(parallelDesigns.size(), sequentialDesigns.size());
+
+    for (int i = 0; i < sequentialDesigns.size(); ++i)
+    {
+        QSharedPointer<MetaInstance> sequentialTop = sequentialDesigns.at(i)->getTopInstance();
+        QSharedPointer<MetaInstance> parallelTop = parallelDesigns.at(i)->getTopInstance();
+
+        QCOMPARE(parallelTop->getModuleName(), sequentialTop->getModuleName());
+        QCOMPARE(parallelDesigns.at(i)->getInstances()->keys(), sequentialDesigns.at(i)->getInstances()->keys());
+    }
+
+    QSharedPointer<QMap<QString, QSharedPointer<MetaInstance> > > parallelInstances =
+        parallelDesigns.first()->getInstances();
+    for (int i = 0; i < 4; ++i)
+    {
+        QCOMPARE(parallelInstances->value("instance" + QString::number(i))->getModuleName(),
+            QString("TestHierarchical_") + QString::number(i));
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_HDLParser::testFlatComponent()
 //-----------------------------------------------------------------------------
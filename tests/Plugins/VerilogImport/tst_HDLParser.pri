@@ -11,6 +11,7 @@ HEADERS += ../../../IPXACTmodels/utilities/ComponentSearch.h \
     ../../../Plugins/common/HDLParser/HDLParserCommon.h \
     ../../../Plugins/common/HDLParser/MetaComponent.h \
     ../../../Plugins/common/HDLParser/MetaDesign.h \
+    ../../../Plugins/common/HDLParser/ReadOnlyLibraryView.h \
     ../../../Plugins/common/HDLParser/MetaInstance.h \
     ../../../Plugins/VerilogGenerator/ModelParameterVerilogWriter/ModelParameterVerilogWriter.h \
     ../../../Plugins/common/PortSorter/PortSorter.h \
@@ -23,6 +24,7 @@ SOURCES += ../../../IPXACTmodels/utilities/ComponentSearch.cpp \
     ../../../Plugins/PluginSystem/GeneratorPlugin/MessagePasser.cpp \
     ../../../Plugins/common/HDLParser/MetaComponent.cpp \
     ../../../Plugins/common/HDLParser/MetaDesign.cpp \
+    ../../../Plugins/common/HDLParser/ReadOnlyLibraryView.cpp \
     ../../../Plugins/common/HDLParser/MetaInstance.cpp \
     ../../../editors/common/TopComponentParameterFinder.cpp \
     ./tst_HDLParser.cpp